@@ -2,6 +2,7 @@
 
 #include <iostream>
 #include <sstream>
+#include <vector>
 
 #include <triton/api.hpp>
 #include <triton/bitsVector.hpp>
@@ -11,6 +12,8 @@
 #include <triton/memoryAccess.hpp>
 #include <triton/operandWrapper.hpp>
 #include <triton/register.hpp>
+#include <triton/symbolicEngine.hpp>
+#include <triton/taintEngine.hpp>
 #include <triton/x8664Cpu.hpp>
 #include <triton/x86Cpu.hpp>
 #include <triton/x86Specifications.hpp>
@@ -517,6 +520,188 @@ int test_9(void) {
 }
 
 
+int test_10(void) {
+  triton::arch::x86::x8664Cpu cpu;
+
+  cpu.setConcreteMemoryValue(0x1000, 0x11);
+  cpu.setConcreteMemoryValue(0x5000, 0x22);
+
+  /* The copy shares its pages with the original until a write */
+  triton::arch::x86::x8664Cpu fork(cpu);
+  fork.setConcreteMemoryValue(0x1000, 0x33);
+  fork.clearConcreteMemoryValue(0x5000);
+  fork.setConcreteMemoryValue(0x9000, 0x44);
+
+  if (cpu.getConcreteMemoryValue(0x1000) != 0x11 || fork.getConcreteMemoryValue(0x1000) != 0x33) {
+    std::cerr << "test_10: KO (forked memory is not copy-on-write)" << std::endl;
+    return 1;
+  }
+
+  if (!cpu.isConcreteMemoryValueDefined(0x5000) || fork.isConcreteMemoryValueDefined(0x5000)) {
+    std::cerr << "test_10: KO (clearing forked memory changed the original)" << std::endl;
+    return 1;
+  }
+
+  if (cpu.isConcreteMemoryValueDefined(0x9000) || fork.getConcreteMemoryValue(0x9000) != 0x44) {
+    std::cerr << "test_10: KO (new forked page visible in the original)" << std::endl;
+    return 1;
+  }
+
+  triton::API api;
+  api.setArchitecture(triton::arch::ARCH_X86_64);
+  api.taintMemory(0x2000);
+  api.setConcreteMemoryValue(0x2000, 0x55);
+  api.symbolizeMemory(triton::arch::MemoryAccess(0x2000, 1));
+
+  triton::engines::taint::TaintEngine taintFork(*api.getTaintEngine());
+  triton::engines::symbolic::SymbolicEngine symFork(*api.getSymbolicEngine());
+  taintFork.untaintMemory(0x2000);
+  taintFork.taintMemory(0x3000);
+  symFork.concretizeMemory(0x2000);
+
+  if (!api.isMemoryTainted(0x2000) || api.isMemoryTainted(0x3000) || taintFork.isMemoryTainted(0x2000)) {
+    std::cerr << "test_10: KO (forked taint state is not copy-on-write)" << std::endl;
+    return 1;
+  }
+
+  if (api.getSymbolicMemory(0x2000) == nullptr || symFork.getSymbolicMemory(0x2000) != nullptr) {
+    std::cerr << "test_10: KO (forked symbolic state is not copy-on-write)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_10: OK" << std::endl;
+  return 0;
+}
+
+
+int test_11(void) {
+  triton::API api;
+  std::vector<triton::uint8> area(0x3000, 0xaa);
+  std::vector<triton::uint8> out(0x10);
+
+  api.setArchitecture(triton::arch::ARCH_AARCH64);
+  api.setConcreteMemoryValue(0x10000, 0x11);
+  api.mapConcreteMemoryArea(0x10000, area.data(), area.size());
+
+  /* Mapped bytes are read in place, previous values are discarded */
+  area[0x1fff] = 0xbb;
+  api.getConcreteMemoryAreaValue(0x11ff8, out.data(), out.size());
+  if (api.getConcreteMemoryValue(0x10000) != 0xaa || out[7] != 0xbb || out[8] != 0xaa) {
+    std::cerr << "test_11: KO (invalid mapped value)" << std::endl;
+    return 1;
+  }
+
+  /* Writes go to the pages, the mapped area is never modified */
+  api.setConcreteMemoryValue(triton::arch::MemoryAccess(0x12ffe, triton::size::dword), 0x44332211);
+  if (area[0x2ffe] != 0xaa || api.getConcreteMemoryValue(triton::arch::MemoryAccess(0x12ffe, triton::size::dword)) != 0x44332211) {
+    std::cerr << "test_11: KO (invalid write on a mapped area)" << std::endl;
+    return 1;
+  }
+
+  api.clearConcreteMemoryValue(0x10001, 2);
+  if (api.isConcreteMemoryValueDefined(0x10000, 4) || !api.isConcreteMemoryValueDefined(0x10003, 1)) {
+    std::cerr << "test_11: KO (invalid cleared bytes on a mapped area)" << std::endl;
+    return 1;
+  }
+
+  api.unmapConcreteMemoryArea(0x10000);
+  if (api.isConcreteMemoryValueDefined(0x10003, 1) || api.isConcreteMemoryValueDefined(0x12ffe, 2) || !api.isConcreteMemoryValueDefined(0x13000, 1)) {
+    std::cerr << "test_11: KO (invalid unmapped area)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_11: OK" << std::endl;
+  return 0;
+}
+
+
+int test_12(void) {
+  triton::API api;
+
+  api.setArchitecture(triton::arch::ARCH_X86_64);
+  auto ast = api.getAstContext();
+  auto x   = ast->variable(api.newSymbolicVariable(8));
+
+  /* A chain of expressions: e0 = x, ei = e(i-1) + x */
+  auto expr = api.newSymbolicExpression(x);
+  for (triton::uint32 i = 0; i < 50; i++)
+    expr = api.newSymbolicExpression(ast->bvadd(ast->reference(expr), x));
+
+  auto first  = triton::ast::unroll(ast->reference(expr));
+  auto second = triton::ast::unroll(ast->bvnot(ast->reference(expr)));
+
+  /* The unrolled expression is shared between the calls */
+  if (second->getChildren()[0] != first || first->evaluate() != 0 || first->getBitvectorSize() != 8) {
+    std::cerr << "test_12: KO (unrolled expression not reused)" << std::endl;
+    return 1;
+  }
+
+  /* Replacing the AST of an expression invalidates its unrolled copy */
+  expr->setAst(ast->bv(1, 8));
+  auto third = triton::ast::unroll(ast->reference(expr));
+  if (third == first || third->evaluate() != 1) {
+    std::cerr << "test_12: KO (stale unrolled expression)" << std::endl;
+    return 1;
+  }
+
+  /* Replacing the AST of a referenced expression invalidates the unrolled copies of its users */
+  auto e1 = api.newSymbolicExpression(ast->bv(5, 8));
+  auto e2 = api.newSymbolicExpression(ast->bvadd(ast->reference(e1), ast->bv(1, 8)));
+  if (triton::ast::unroll(ast->reference(e2))->evaluate() != 6) {
+    std::cerr << "test_12: KO (unrolled expression)" << std::endl;
+    return 1;
+  }
+
+  api.symbolizeExpression(e1->getId(), 8);
+  auto fourth = triton::ast::unroll(ast->reference(e2));
+  if (fourth->getChildren()[0]->getType() != triton::ast::VARIABLE_NODE) {
+    std::cerr << "test_12: KO (stale referenced expression)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_12: OK" << std::endl;
+  return 0;
+}
+
+
+int test_13(void) {
+  triton::API api;
+
+  api.setArchitecture(triton::arch::ARCH_X86_64);
+  api.symbolizeMemory(triton::arch::MemoryAccess(0x1000, triton::size::word));
+  api.taintMemory(triton::arch::MemoryAccess(0x2000, triton::size::dword));
+
+  /* The iteration APIs walk the state without building a container */
+  triton::uint64 sum = 0;
+  triton::usize count = 0;
+  api.forEachSymbolicMemory([&] (triton::uint64 addr, const triton::engines::symbolic::SharedSymbolicExpression& expr) {
+    if (expr == api.getSymbolicMemory(addr)) {
+      sum += addr;
+      count++;
+    }
+  });
+
+  if (count != 2 || sum != 0x1000 + 0x1001 || api.getSymbolicMemory().size() != count) {
+    std::cerr << "test_13: KO (forEachSymbolicMemory)" << std::endl;
+    return 1;
+  }
+
+  count = 0;
+  api.forEachTaintedMemory([&] (triton::uint64 addr) {
+    if (addr >= 0x2000 && addr < 0x2004)
+      count++;
+  });
+
+  if (count != 4 || api.getTaintedMemory().size() != count) {
+    std::cerr << "test_13: KO (forEachTaintedMemory)" << std::endl;
+    return 1;
+  }
+
+  std::cout << "test_13: OK" << std::endl;
+  return 0;
+}
+
+
 int main(int ac, const char **av) {
   if (test_1())
     return 1;
@@ -545,5 +730,17 @@ int main(int ac, const char **av) {
   if (test_9())
     return 1;
 
+  if (test_10())
+    return 1;
+
+  if (test_11())
+    return 1;
+
+  if (test_12())
+    return 1;
+
+  if (test_13())
+    return 1;
+
   return 0;
 }
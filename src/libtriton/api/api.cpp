@@ -6,8 +6,13 @@
 */
 
 #include <triton/api.hpp>
+#include <triton/astSmtRepresentation.hpp>
 #include <triton/config.hpp>
 #include <triton/exceptions.hpp>
+#include <triton/executionTrace.hpp>
+#include <triton/mappedFile.hpp>
+#include <triton/symbolicSerializer.hpp>
+#include <triton/synthesizer.hpp>
 
 #include <list>
 #include <map>
@@ -228,7 +233,7 @@ namespace triton {
 
   API::API() :
     callbacks(*this),
-    arch(&this->callbacks) {
+    arch(&this->callbacks, &this->journal) {
     this->modes   = std::make_shared<triton::modes::Modes>();
     this->astCtxt = std::make_shared<triton::ast::AstContext>(this->modes);
   }
@@ -275,6 +280,12 @@ namespace triton {
   }
 
 
+  inline void API::checkSnapshot(void) const {
+    if (!this->snapshot)
+      throw triton::exceptions::API("API::checkSnapshot(): Snapshot engine is undefined, you should define an architecture first.");
+  }
+
+
 
   /* Architecture API ============================================================================== */
 
@@ -312,6 +323,8 @@ namespace triton {
 
   void API::clearArchitecture(void) {
     this->checkArchitecture();
+    this->checkSnapshot();
+    this->snapshot->clearCheckpoints();
     this->arch.clearArchitecture();
   }
 
@@ -421,6 +434,12 @@ namespace triton {
   }
 
 
+  void API::getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::uint8* area, triton::usize size, bool execCallbacks) const {
+    this->checkArchitecture();
+    this->arch.getConcreteMemoryAreaValue(baseAddr, area, size, execCallbacks);
+  }
+
+
   triton::uint512 API::getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks) const {
     this->checkArchitecture();
     return this->arch.getConcreteRegisterValue(reg, execCallbacks);
@@ -456,9 +475,7 @@ namespace triton {
      * In order to synchronize the concrete state with the symbolic
      * one, the symbolic expression is concretized.
      */
-    for (triton::usize index = 0 ; index < values.size() ; index++) {
-      this->concretizeMemory(baseAddr + index);
-    }
+    this->concretizeMemory(baseAddr, values.size());
   }
 
 
@@ -469,9 +486,7 @@ namespace triton {
      * In order to synchronize the concrete state with the symbolic
      * one, the symbolic expression is concretized.
      */
-    for (triton::usize index = 0 ; index < size ; index++) {
-      this->concretizeMemory(baseAddr + index);
-    }
+    this->concretizeMemory(baseAddr, size);
   }
 
 
@@ -510,6 +525,36 @@ namespace triton {
   }
 
 
+  void API::mapConcreteMemoryArea(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size, const std::shared_ptr<const void>& owner) {
+    this->checkArchitecture();
+    this->arch.mapConcreteMemoryArea(baseAddr, area, size, owner);
+    /*
+     * In order to synchronize the concrete state with the symbolic
+     * one, the symbolic expression is concretized.
+     */
+    this->concretizeMemory(baseAddr, size);
+  }
+
+
+  void API::mapConcreteMemoryFile(triton::uint64 baseAddr, const std::string& path, triton::uint64 offset, triton::usize size) {
+    this->checkArchitecture();
+    auto file = std::make_shared<triton::utils::MappedFile>(path, offset, size);
+    this->mapConcreteMemoryArea(baseAddr, file->getData(), file->getSize(), file);
+  }
+
+
+  void API::unmapConcreteMemoryArea(triton::uint64 baseAddr) {
+    this->checkArchitecture();
+    this->arch.unmapConcreteMemoryArea(baseAddr);
+  }
+
+
+  std::map<triton::uint64, triton::usize> API::getMappedConcreteMemoryAreas(void) const {
+    this->checkArchitecture();
+    return this->arch.getMappedConcreteMemoryAreas();
+  }
+
+
   void API::disassembly(triton::arch::Instruction& inst) const {
     this->checkArchitecture();
     this->arch.disassembly(inst);
@@ -522,7 +567,7 @@ namespace triton {
   void API::initEngines(void) {
     this->checkArchitecture();
 
-    this->symbolic = new(std::nothrow) triton::engines::symbolic::SymbolicEngine(&this->arch, this->modes, this->astCtxt, &this->callbacks);
+    this->symbolic = new(std::nothrow) triton::engines::symbolic::SymbolicEngine(&this->arch, this->modes, this->astCtxt, &this->callbacks, &this->journal);
     if (this->symbolic == nullptr)
       throw triton::exceptions::API("API::initEngines(): Not enough memory.");
 
@@ -530,10 +575,14 @@ namespace triton {
     if (this->solver == nullptr)
       throw triton::exceptions::API("API::initEngines(): Not enough memory.");
 
-    this->taint = new(std::nothrow) triton::engines::taint::TaintEngine(this->modes, this->symbolic, *this->getCpuInstance());
+    this->taint = new(std::nothrow) triton::engines::taint::TaintEngine(this->modes, this->symbolic, *this->getCpuInstance(), &this->journal);
     if (this->taint == nullptr)
       throw triton::exceptions::API("API::initEngines(): Not enough memory.");
 
+    this->snapshot = new(std::nothrow) triton::engines::snapshot::SnapshotEngine(&this->arch, this->symbolic, this->taint, this->astCtxt, &this->journal);
+    if (this->snapshot == nullptr)
+      throw triton::exceptions::API("API::initEngines(): Not enough memory.");
+
     this->irBuilder = new(std::nothrow) triton::arch::IrBuilder(&this->arch, this->modes, this->astCtxt, this->symbolic, this->taint);
     if (this->irBuilder == nullptr)
       throw triton::exceptions::API("API::initEngines(): Not enough memory.");
@@ -544,19 +593,29 @@ namespace triton {
 
 
   void API::removeEngines(void) {
+    /* The nodes may outlive the context, release its cached copies now */
+    if (this->astCtxt != nullptr)
+      this->astCtxt->clearUnrolledAsts();
+
     if (this->isArchitectureValid()) {
       delete this->irBuilder;
+      delete this->snapshot;
       delete this->solver;
       delete this->symbolic;
       delete this->taint;
 
       this->astCtxt   = nullptr;
       this->irBuilder = nullptr;
+      this->snapshot  = nullptr;
       this->solver    = nullptr;
       this->symbolic  = nullptr;
       this->taint     = nullptr;
     }
 
+    // Clean up the journal
+    this->journal.clear();
+    this->journal.enable(false);
+
     // Clean up the ast context
     this->astCtxt = std::make_shared<triton::ast::AstContext>(this->modes);
 
@@ -583,6 +642,101 @@ namespace triton {
   }
 
 
+  triton::uint64 API::run(triton::uint64 pc, triton::usize maxInstructions, const std::set<triton::uint64>& stopAddrs, const std::map<triton::uint64, std::function<bool(triton::uint64)>>& hooks) {
+    this->checkArchitecture();
+
+    const triton::arch::Register& pcReg = this->arch.getProgramCounter();
+    triton::uint8 opcode[16];
+    triton::usize count = 0;
+
+    this->setConcreteRegisterValue(pcReg, pc);
+
+    while (maxInstructions == 0 || count < maxInstructions) {
+      if (stopAddrs.find(pc) != stopAddrs.end())
+        break;
+
+      auto hook = hooks.find(pc);
+      if (hook != hooks.end()) {
+        if (hook->second(pc))
+          break;
+        /* The hook may have redirected the execution, a redirection counts as an instruction */
+        triton::uint64 next = static_cast<triton::uint64>(this->getConcreteRegisterValue(pcReg, false));
+        if (next != pc) {
+          pc = next;
+          count++;
+          continue;
+        }
+      }
+
+      /* Fetching the opcode is not a memory access of the program */
+      this->getConcreteMemoryAreaValue(pc, opcode, sizeof(opcode), false);
+      triton::arch::Instruction inst(pc, opcode, sizeof(opcode));
+      if (!this->processing(inst))
+        break;
+
+      pc = static_cast<triton::uint64>(this->getConcreteRegisterValue(pcReg, false));
+      count++;
+    }
+
+    return pc;
+  }
+
+
+  triton::usize API::replayTrace(std::istream& stream, triton::uint64 begin, triton::uint64 end) {
+    this->checkArchitecture();
+
+    triton::utils::TraceReader reader(stream);
+    triton::utils::TraceRecord record;
+    triton::usize count = 0;
+
+    if (reader.getArchitecture() != this->getArchitecture())
+      throw triton::exceptions::API("API::replayTrace(): The trace has been recorded on another architecture.");
+
+    reader.seek(begin);
+    while ((end == 0 || reader.tell() < end) && reader.next(record)) {
+      switch (record.kind) {
+        case triton::utils::TRACE_RECORD_SYNC:
+          for (const auto& reg : record.registers) {
+            if (!this->isRegisterValid(reg.first))
+              continue;
+            /*
+             * Like the pintool, a register is only concretized if its symbolic
+             * value diverges from the recorded one, otherwise its expression is kept.
+             */
+            const triton::arch::Register& r = this->getRegister(reg.first);
+            if (this->getSymbolicRegister(r) && this->getSymbolicRegisterValue(r) != reg.second)
+              this->setConcreteRegisterValue(r, reg.second);
+            else
+              this->arch.setConcreteRegisterValue(r, reg.second);
+          }
+          break;
+
+        case triton::utils::TRACE_RECORD_INSTRUCTION: {
+          /* The concrete state is synchronized without concretizing the symbolic one */
+          for (const auto& read : record.memory)
+            this->arch.setConcreteMemoryAreaValue(read.address, read.data);
+
+          triton::arch::Instruction inst(record.pc, record.opcode.data(), static_cast<triton::uint32>(record.opcode.size()));
+          inst.setThreadId(record.tid);
+          this->processing(inst);
+          count++;
+          break;
+        }
+
+        case triton::utils::TRACE_RECORD_WRITE:
+          for (const auto& write : record.memory)
+            this->arch.setConcreteMemoryAreaValue(write.address, write.data);
+          break;
+
+        default:
+          break;
+      }
+    }
+
+    return count;
+  }
+
+
 
   /* IR builder API ================================================================================= */
 
@@ -610,18 +764,31 @@ namespace triton {
   }
 
 
+  std::ostream& API::printSmtDag(std::ostream& stream, const triton::ast::SharedAbstractNode& node, bool assert_) {
+    return triton::ast::representations::AstSmtRepresentation().printDag(stream, node, assert_);
+  }
+
+
 
   /* Callbacks API ================================================================================= */
 
   template TRITON_EXPORT void API::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&)> cb);
+  template TRITON_EXPORT void API::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&)> cb, triton::uint64 baseAddr, triton::usize size);
+  template TRITON_EXPORT void API::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, triton::uint64, triton::usize)> cb);
+  template TRITON_EXPORT void API::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, triton::uint64, triton::usize)> cb, triton::uint64 baseAddr, triton::usize size);
   template TRITON_EXPORT void API::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::Register&)> cb);
   template TRITON_EXPORT void API::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&, const triton::uint512& value)> cb);
+  template TRITON_EXPORT void API::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&, const triton::uint512& value)> cb, triton::uint64 baseAddr, triton::usize size);
+  template TRITON_EXPORT void API::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, triton::uint64, const triton::uint8*, triton::usize)> cb);
+  template TRITON_EXPORT void API::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, triton::uint64, const triton::uint8*, triton::usize)> cb, triton::uint64 baseAddr, triton::usize size);
   template TRITON_EXPORT void API::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::Register&, const triton::uint512& value)> cb);
   template TRITON_EXPORT void API::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<triton::ast::SharedAbstractNode(triton::API&, const triton::ast::SharedAbstractNode&)> cb);
 
   template TRITON_EXPORT void API::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&)> cb);
+  template TRITON_EXPORT void API::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, triton::uint64, triton::usize)> cb);
   template TRITON_EXPORT void API::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::Register&)> cb);
   template TRITON_EXPORT void API::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&, const triton::uint512& value)> cb);
+  template TRITON_EXPORT void API::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, triton::uint64, const triton::uint8*, triton::usize)> cb);
   template TRITON_EXPORT void API::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::Register&, const triton::uint512& value)> cb);
   template TRITON_EXPORT void API::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<triton::ast::SharedAbstractNode(triton::API&, const triton::ast::SharedAbstractNode&)> cb);
 
@@ -657,11 +824,15 @@ namespace triton {
   /* Modes API======================================================================================= */
 
   void API::setMode(triton::modes::mode_e mode, bool flag) {
+    if (mode >= triton::modes::MODE_LAST_ITEM)
+      throw triton::exceptions::API("API::setMode(): Invalid mode.");
     this->modes->setMode(mode, flag);
   }
 
 
   bool API::isModeEnabled(triton::modes::mode_e mode) const {
+    if (mode >= triton::modes::MODE_LAST_ITEM)
+      return false;
     return this->modes->isModeEnabled(mode);
   }
 
@@ -818,6 +989,12 @@ namespace triton {
   }
 
 
+  void API::forEachSymbolicMemory(const std::function<void(triton::uint64, const triton::engines::symbolic::SharedSymbolicExpression&)>& f) const {
+    this->checkSymbolic();
+    this->symbolic->forEachSymbolicMemory(f);
+  }
+
+
   const triton::engines::symbolic::SharedSymbolicExpression& API::getSymbolicRegister(const triton::arch::Register& reg) const {
     this->checkSymbolic();
     return this->symbolic->getSymbolicRegister(reg);
@@ -848,6 +1025,54 @@ namespace triton {
   }
 
 
+  void API::addSimplificationRule(const std::string& rule) {
+    this->checkSymbolic();
+    this->symbolic->addSimplificationRule(rule);
+  }
+
+
+  void API::clearSimplificationRules(void) {
+    this->checkSymbolic();
+    this->symbolic->clearSimplificationRules();
+  }
+
+
+  std::vector<std::string> API::getSimplificationRules(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getSimplificationRules();
+  }
+
+
+  void API::addSaturationRule(const std::string& rule) {
+    this->checkSymbolic();
+    this->symbolic->addSaturationRule(rule);
+  }
+
+
+  void API::clearSaturationRules(void) {
+    this->checkSymbolic();
+    this->symbolic->clearSaturationRules();
+  }
+
+
+  std::vector<std::string> API::getSaturationRules(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getSaturationRules();
+  }
+
+
+  triton::ast::SharedAbstractNode API::processEqualitySaturation(const triton::ast::SharedAbstractNode& node, triton::usize nodeLimit, triton::usize timeLimit, triton::engines::symbolic::cost_e cost) const {
+    this->checkSymbolic();
+    return this->symbolic->processEqualitySaturation(node, nodeLimit, timeLimit, cost);
+  }
+
+
+  triton::ast::SharedAbstractNode API::processMbaSimplification(const triton::ast::SharedAbstractNode& node) const {
+    this->checkSymbolic();
+    return this->symbolic->processMbaSimplification(node);
+  }
+
+
   triton::ast::SharedAbstractNode API::processSimplification(const triton::ast::SharedAbstractNode& node, bool z3) const {
     this->checkSymbolic();
     if (z3 == true) {
@@ -1008,6 +1233,12 @@ namespace triton {
   }
 
 
+  void API::concretizeMemory(triton::uint64 baseAddr, triton::usize size) {
+    this->checkSymbolic();
+    this->symbolic->concretizeMemory(baseAddr, size);
+  }
+
+
   void API::concretizeRegister(const triton::arch::Register& reg) {
     this->checkSymbolic();
     this->symbolic->concretizeRegister(reg);
@@ -1020,12 +1251,37 @@ namespace triton {
   }
 
 
+  std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicExpression> API::sliceExpressions(const std::vector<triton::engines::symbolic::SharedSymbolicExpression>& exprs) {
+    this->checkSymbolic();
+    return this->symbolic->sliceExpressions(exprs);
+  }
+
+
   std::ostream& API::printSlicedExpressions(std::ostream& stream, const triton::engines::symbolic::SharedSymbolicExpression& expr, bool assert_) {
     this->checkSymbolic();
     return this->symbolic->printSlicedExpressions(stream, expr, assert_);
   }
 
 
+  void API::serializeSymbolic(std::ostream& stream,
+                              const std::vector<triton::ast::SharedAbstractNode>& nodes,
+                              const std::vector<triton::engines::symbolic::SharedSymbolicExpression>& exprs,
+                              const std::vector<triton::engines::symbolic::PathConstraint>& pcs) {
+    this->checkSymbolic();
+    triton::engines::symbolic::SymbolicSerializer(&this->arch, this->symbolic, this->astCtxt).serialize(stream, nodes, exprs, pcs);
+  }
+
+
+  void API::deserializeSymbolic(std::istream& stream,
+                                std::vector<triton::ast::SharedAbstractNode>& nodes,
+                                std::vector<triton::engines::symbolic::SharedSymbolicExpression>& exprs,
+                                std::vector<triton::engines::symbolic::PathConstraint>& pcs,
+                                bool reuseVariables) {
+    this->checkSymbolic();
+    triton::engines::symbolic::SymbolicSerializer(&this->arch, this->symbolic, this->astCtxt).deserialize(stream, nodes, exprs, pcs, reuseVariables);
+  }
+
+
   std::vector<triton::engines::symbolic::SharedSymbolicExpression> API::getTaintedSymbolicExpressions(void) const {
     this->checkSymbolic();
     return this->symbolic->getTaintedSymbolicExpressions();
@@ -1044,6 +1300,18 @@ namespace triton {
   }
 
 
+  triton::usize API::compactSymbolicExpressions(void) {
+    this->checkSymbolic();
+    return this->symbolic->compactSymbolicExpressions();
+  }
+
+
+  triton::usize API::trimSymbolicExpressions(void) {
+    this->checkSymbolic();
+    return this->symbolic->trimSymbolicExpressions();
+  }
+
+
 
   /* Solver engine API ============================================================================= */
 
@@ -1129,6 +1397,89 @@ namespace triton {
   }
 
 
+  triton::ast::SharedAbstractNode API::synthesize(const triton::ast::SharedAbstractNode& node, bool constant) {
+    this->checkSolver();
+    if (this->oracles.isEmpty())
+      this->oracles.build();
+    return triton::engines::synthesis::Synthesizer(this->oracles, *this->solver, constant).synthesize(node);
+  }
+
+
+  void API::loadSynthesisOracles(const std::string& path) {
+    this->oracles.load(path);
+  }
+
+
+  void API::saveSynthesisOracles(const std::string& path) {
+    if (this->oracles.isEmpty())
+      this->oracles.build();
+    this->oracles.save(path);
+  }
+
+
+
+  /* Snapshot engine API ============================================================================ */
+
+  triton::engines::snapshot::SnapshotEngine* API::getSnapshotEngine(void) {
+    this->checkSnapshot();
+    return this->snapshot;
+  }
+
+
+  triton::usize API::takeSnapshot(void) {
+    this->checkSnapshot();
+    return this->snapshot->takeSnapshot();
+  }
+
+
+  void API::restoreSnapshot(triton::usize id) {
+    this->checkSnapshot();
+    this->snapshot->restoreSnapshot(id);
+  }
+
+
+  void API::removeSnapshot(triton::usize id) {
+    this->checkSnapshot();
+    this->snapshot->removeSnapshot(id);
+  }
+
+
+  bool API::isSnapshot(triton::usize id) const {
+    this->checkSnapshot();
+    return this->snapshot->isSnapshot(id);
+  }
+
+
+  triton::usize API::getNumberOfSnapshots(void) const {
+    this->checkSnapshot();
+    return this->snapshot->getNumberOfSnapshots();
+  }
+
+
+  triton::usize API::checkpoint(void) {
+    this->checkSnapshot();
+    return this->snapshot->checkpoint();
+  }
+
+
+  void API::rollback(triton::usize checkpoint) {
+    this->checkSnapshot();
+    this->snapshot->rollback(checkpoint);
+  }
+
+
+  void API::clearCheckpoints(void) {
+    this->checkSnapshot();
+    this->snapshot->clearCheckpoints();
+  }
+
+
+  triton::usize API::getNumberOfCheckpoints(void) const {
+    this->checkSnapshot();
+    return this->snapshot->getNumberOfCheckpoints();
+  }
+
+
 
   /* Taint engine API ============================================================================== */
 
@@ -1138,12 +1489,18 @@ namespace triton {
   }
 
 
-  const std::unordered_set<triton::uint64>& API::getTaintedMemory(void) const {
+  std::unordered_set<triton::uint64> API::getTaintedMemory(void) const {
     this->checkTaint();
     return this->taint->getTaintedMemory();
   }
 
 
+  void API::forEachTaintedMemory(const std::function<void(triton::uint64)>& f) const {
+    this->checkTaint();
+    this->taint->forEachTaintedMemory(f);
+  }
+
+
   std::unordered_set<const triton::arch::Register*> API::getTaintedRegisters(void) const {
     this->checkTaint();
     return this->taint->getTaintedRegisters();
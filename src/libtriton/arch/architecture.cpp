@@ -6,6 +6,8 @@
 */
 
 #include <new>
+#include <utility>
+#include <vector>
 
 #include <triton/aarch64Cpu.hpp>
 #include <triton/architecture.hpp>
@@ -19,9 +21,32 @@
 namespace triton {
   namespace arch {
 
-    Architecture::Architecture(triton::callbacks::Callbacks* callbacks) {
+    Architecture::Architecture(triton::callbacks::Callbacks* callbacks, triton::engines::snapshot::Journal* journal) {
       this->arch      = triton::arch::ARCH_INVALID;
       this->callbacks = callbacks;
+      this->journal   = journal;
+    }
+
+
+    void Architecture::journalMemory(triton::uint64 baseAddr, triton::usize size) {
+      if (this->journal == nullptr || !this->journal->isEnabled() || size == 0)
+        return;
+
+      /* One entry for the whole range, the defined flags are only saved if some cells were undefined */
+      if (this->cpu->isConcreteMemoryValueDefined(baseAddr, size)) {
+        std::vector<triton::uint8> values = this->cpu->getConcreteMemoryAreaValue(baseAddr, size, false);
+        this->journal->recordConcreteMemory(baseAddr, values.data(), nullptr, size);
+      }
+      else {
+        std::vector<triton::uint8> values(size);
+        std::vector<triton::uint8> defined(size);
+        for (triton::usize index = 0; index < size; index++) {
+          triton::uint64 addr = baseAddr + index;
+          defined[index] = this->cpu->isConcreteMemoryValueDefined(addr);
+          values[index]  = defined[index] ? this->cpu->getConcreteMemoryValue(addr, false) : 0;
+        }
+        this->journal->recordConcreteMemory(baseAddr, values.data(), defined.data(), size);
+      }
     }
 
 
@@ -254,6 +279,13 @@ namespace triton {
     }
 
 
+    void Architecture::getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::uint8* area, triton::usize size, bool execCallbacks) const {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::getConcreteMemoryAreaValue(): You must define an architecture.");
+      this->cpu->getConcreteMemoryAreaValue(baseAddr, area, size, execCallbacks);
+    }
+
+
     triton::uint512 Architecture::getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks) const {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::getConcreteRegisterValue(): You must define an architecture.");
@@ -264,6 +296,7 @@ namespace triton {
     void Architecture::setConcreteMemoryValue(triton::uint64 addr, triton::uint8 value) {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::setConcreteMemoryValue(): You must define an architecture.");
+      this->journalMemory(addr, 1);
       this->cpu->setConcreteMemoryValue(addr, value);
     }
 
@@ -271,6 +304,7 @@ namespace triton {
     void Architecture::setConcreteMemoryValue(const triton::arch::MemoryAccess& mem, const triton::uint512& value) {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::setConcreteMemoryValue(): You must define an architecture.");
+      this->journalMemory(mem.getAddress(), mem.getSize());
       this->cpu->setConcreteMemoryValue(mem, value);
     }
 
@@ -278,6 +312,7 @@ namespace triton {
     void Architecture::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const std::vector<triton::uint8>& values) {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::setConcreteMemoryAreaValue(): You must define an architecture.");
+      this->journalMemory(baseAddr, values.size());
       this->cpu->setConcreteMemoryAreaValue(baseAddr, values);
     }
 
@@ -285,6 +320,7 @@ namespace triton {
     void Architecture::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size) {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::setConcreteMemoryAreaValue(): You must define an architecture.");
+      this->journalMemory(baseAddr, size);
       this->cpu->setConcreteMemoryAreaValue(baseAddr, area, size);
     }
 
@@ -292,6 +328,13 @@ namespace triton {
     void Architecture::setConcreteRegisterValue(const triton::arch::Register& reg, const triton::uint512& value) {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::setConcreteRegisterValue(): You must define an architecture.");
+      if (this->journal && this->journal->isEnabled()) {
+        /* Record once the register has been written, an invalid write has nothing to undo */
+        triton::uint512 old = this->cpu->getConcreteRegisterValue(reg, false);
+        this->cpu->setConcreteRegisterValue(reg, value);
+        this->journal->recordConcreteRegister(reg.getId(), old);
+        return;
+      }
       this->cpu->setConcreteRegisterValue(reg, value);
     }
 
@@ -313,6 +356,7 @@ namespace triton {
     void Architecture::clearConcreteMemoryValue(const triton::arch::MemoryAccess& mem) {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::clearConcreteMemoryValue(): You must define an architecture.");
+      this->journalMemory(mem.getAddress(), mem.getSize());
       this->cpu->clearConcreteMemoryValue(mem);
     }
 
@@ -320,8 +364,63 @@ namespace triton {
     void Architecture::clearConcreteMemoryValue(triton::uint64 baseAddr, triton::usize size) {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::clearConcreteMemoryValue(): You must define an architecture.");
+      this->journalMemory(baseAddr, size);
       this->cpu->clearConcreteMemoryValue(baseAddr, size);
     }
 
+
+    void Architecture::mapConcreteMemoryArea(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size, const std::shared_ptr<const void>& owner) {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::mapConcreteMemoryArea(): You must define an architecture.");
+      /* A rollback restores the previous memory, whatever the size of the area */
+      if (this->journal && this->journal->isEnabled())
+        this->journal->recordConcreteMemoryState(this->cpu->getConcreteMemory());
+      this->cpu->mapConcreteMemoryArea(baseAddr, area, size, owner);
+    }
+
+
+    void Architecture::unmapConcreteMemoryArea(triton::uint64 baseAddr) {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::unmapConcreteMemoryArea(): You must define an architecture.");
+      if (this->journal && this->journal->isEnabled())
+        this->journal->recordConcreteMemoryState(this->cpu->getConcreteMemory());
+      this->cpu->unmapConcreteMemoryArea(baseAddr);
+    }
+
+
+    std::map<triton::uint64, triton::usize> Architecture::getMappedConcreteMemoryAreas(void) const {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::getMappedConcreteMemoryAreas(): You must define an architecture.");
+      return this->cpu->getMappedConcreteMemoryAreas();
+    }
+
+
+    void Architecture::undo(const triton::engines::snapshot::JournalEntry& entry) {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::undo(): You must define an architecture.");
+
+      switch (entry.kind) {
+        case triton::engines::snapshot::JOURNAL_CONCRETE_MEMORY:
+          for (triton::usize index = 0; index < entry.size; index++) {
+            if (entry.defined == nullptr || entry.defined[index])
+              this->cpu->setConcreteMemoryValue(entry.key + index, entry.values[index]);
+            else
+              this->cpu->clearConcreteMemoryValue(entry.key + index);
+          }
+          break;
+
+        case triton::engines::snapshot::JOURNAL_CONCRETE_MEMORY_STATE:
+          this->cpu->setConcreteMemory(*entry.state);
+          break;
+
+        case triton::engines::snapshot::JOURNAL_CONCRETE_REGISTER:
+          this->cpu->setConcreteRegisterValue(this->cpu->getRegister(static_cast<triton::arch::register_e>(entry.key)), *entry.value);
+          break;
+
+        default:
+          throw triton::exceptions::Architecture("Architecture::undo(): Not a concrete journal entry.");
+      }
+    }
+
   }; /* arch namespace */
 }; /* triton namespace */
@@ -26,7 +26,6 @@ namespace triton {
             #define REG_SPEC(UPPER_NAME, LOWER_NAME, AARCH64_UPPER, AARCH64_LOWER, AARCH64_PARENT, MUTABLE) \
               id2reg.emplace(ID_REG_AARCH64_##UPPER_NAME,                                                   \
                                  triton::arch::Register(triton::arch::ID_REG_AARCH64_##UPPER_NAME,          \
-                                                        #LOWER_NAME,                                        \
                                                         triton::arch::ID_REG_AARCH64_##AARCH64_PARENT,      \
                                                         AARCH64_UPPER,                                      \
                                                         AARCH64_LOWER,                                      \
@@ -7,6 +7,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <mutex>
 
 #include <triton/architecture.hpp>
 #include <triton/arm32Cpu.hpp>
@@ -35,12 +36,17 @@ namespace triton {
 
 
         Arm32Cpu::Arm32Cpu(const Arm32Cpu& other) : Arm32Specifications(ARCH_ARM32) {
+          /* The disassembler is opened at the first disassembly, a snapshot never needs it */
+          this->handle_arm   = 0;
+          this->handle_thumb = 0;
+
           this->copy(other);
         }
 
 
         Arm32Cpu::~Arm32Cpu() {
           this->memory.clear();
+          std::lock_guard<std::mutex> lock(triton::extlibs::capstone::getHandleMutex());
 
           if (this->handle_arm) {
             triton::extlibs::capstone::cs_close(&this->handle_arm);
@@ -52,7 +58,9 @@ namespace triton {
         }
 
 
-        void Arm32Cpu::disassInit(void) {
+        void Arm32Cpu::disassInit(void) const {
+          std::lock_guard<std::mutex> lock(triton::extlibs::capstone::getHandleMutex());
+
           /* Open capstone in ARM mode. */
           if (this->handle_arm) {
             triton::extlibs::capstone::cs_close(&this->handle_arm);
@@ -79,6 +87,7 @@ namespace triton {
         void Arm32Cpu::copy(const Arm32Cpu& other) {
           this->callbacks = other.callbacks;
           this->memory    = other.memory;
+          this->thumb     = other.thumb;
 
           std::memcpy(this->r0,   other.r0,   sizeof(this->r0));
           std::memcpy(this->r1,   other.r1,   sizeof(this->r1));
@@ -245,6 +254,10 @@ namespace triton {
           if (inst.getOpcode() == nullptr || inst.getSize() == 0)
             throw triton::exceptions::Disassembly("Arm32Cpu::disassembly(): Opcode and opcodeSize must be definied.");
 
+          /* Copies open the disassembler lazily */
+          if (!this->handle_arm)
+            this->disassInit();
+
           /* Select capstone handler (based on execution mode) */
           handle = (this->thumb ? this->handle_thumb : this->handle_arm);
 
@@ -538,14 +551,16 @@ namespace triton {
 
 
         triton::uint8 Arm32Cpu::getConcreteMemoryValue(triton::uint64 addr, bool execCallbacks) const {
-          if (execCallbacks && this->callbacks)
+          if (execCallbacks && this->callbacks) {
+            this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_AREA_VALUE, addr, triton::size::byte);
             this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, MemoryAccess(addr, triton::size::byte));
+          }
 
-          auto it = this->memory.find(addr);
-          if (it == this->memory.end())
+          const triton::uint8* value = this->memory.get(addr);
+          if (value == nullptr)
             return 0x00;
 
-          return it->second;
+          return *value;
         }
 
 
@@ -554,8 +569,10 @@ namespace triton {
           triton::uint64 addr = 0;
           triton::uint32 size = 0;
 
-          if (execCallbacks && this->callbacks)
+          if (execCallbacks && this->callbacks) {
+            this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_AREA_VALUE, mem.getAddress(), mem.getSize());
             this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, mem);
+          }
 
           addr = mem.getAddress();
           size = mem.getSize();
@@ -571,15 +588,28 @@ namespace triton {
 
 
         std::vector<triton::uint8> Arm32Cpu::getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks) const {
-          std::vector<triton::uint8> area;
+          std::vector<triton::uint8> area(size);
 
-          for (triton::usize index = 0; index < size; index++)
-            area.push_back(this->getConcreteMemoryValue(baseAddr+index));
+          this->getConcreteMemoryAreaValue(baseAddr, area.data(), size, execCallbacks);
 
           return area;
         }
 
 
+        void Arm32Cpu::getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::uint8* area, triton::usize size, bool execCallbacks) const {
+          if (execCallbacks && this->callbacks) {
+            this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_AREA_VALUE, baseAddr, size);
+            /* Per-byte callbacks are only fired if one of them watches the area */
+            if (this->callbacks->isDefined(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, baseAddr, size)) {
+              for (triton::usize index = 0; index < size; index++)
+                this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, MemoryAccess(baseAddr+index, triton::size::byte));
+            }
+          }
+
+          this->memory.read(baseAddr, area, size);
+        }
+
+
         triton::uint512 Arm32Cpu::getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks) const {
           triton::uint512 value = 0;
 
@@ -617,9 +647,11 @@ namespace triton {
 
 
         void Arm32Cpu::setConcreteMemoryValue(triton::uint64 addr, triton::uint8 value) {
-          if (this->callbacks)
+          if (this->callbacks) {
+            this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_MEMORY_AREA_VALUE, addr, &value, triton::size::byte);
             this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_MEMORY_VALUE, MemoryAccess(addr, triton::size::byte), value);
-          this->memory[addr] = value;
+          }
+          this->memory.set(addr, value);
         }
 
 
@@ -627,6 +659,7 @@ namespace triton {
           triton::uint64 addr = mem.getAddress();
           triton::uint32 size = mem.getSize();
           triton::uint512 cv  = value;
+          triton::uint8 area[triton::size::dqqword];
 
           if (cv > mem.getMaxValue())
             throw triton::exceptions::Register("Arm32Cpu::setConcreteMemoryValue(): You cannot set this concrete value (too big) to this memory access.");
@@ -634,27 +667,36 @@ namespace triton {
           if (size == 0 || size > triton::size::dqqword)
             throw triton::exceptions::Cpu("Arm32Cpu::setConcreteMemoryValue(): Invalid size memory.");
 
-          if (this->callbacks)
-            this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_MEMORY_VALUE, mem, value);
-
           for (triton::uint32 i = 0; i < size; i++) {
-            this->memory[addr+i] = (cv & 0xff).convert_to<triton::uint8>();
+            area[i] = (cv & 0xff).convert_to<triton::uint8>();
             cv >>= 8;
           }
+
+          if (this->callbacks) {
+            this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_MEMORY_AREA_VALUE, addr, area, size);
+            this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_MEMORY_VALUE, mem, value);
+          }
+
+          this->memory.write(addr, area, size);
         }
 
 
         void Arm32Cpu::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const std::vector<triton::uint8>& values) {
-          for (triton::usize index = 0; index < values.size(); index++) {
-            this->setConcreteMemoryValue(baseAddr+index, values[index]);
-          }
+          this->setConcreteMemoryAreaValue(baseAddr, values.data(), values.size());
         }
 
 
         void Arm32Cpu::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size) {
-          for (triton::usize index = 0; index < size; index++) {
-            this->setConcreteMemoryValue(baseAddr+index, area[index]);
+          if (this->callbacks) {
+            this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_MEMORY_AREA_VALUE, baseAddr, area, size);
+            /* Per-byte callbacks are only fired if one of them watches the area */
+            if (this->callbacks->isDefined(triton::callbacks::SET_CONCRETE_MEMORY_VALUE, baseAddr, size)) {
+              for (triton::usize index = 0; index < size; index++)
+                this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_MEMORY_VALUE, MemoryAccess(baseAddr+index, triton::size::byte), area[index]);
+            }
           }
+
+          this->memory.write(baseAddr, area, size);
         }
 
 
@@ -739,11 +781,7 @@ namespace triton {
 
 
         bool Arm32Cpu::isConcreteMemoryValueDefined(triton::uint64 baseAddr, triton::usize size) const {
-          for (triton::usize index = 0; index < size; index++) {
-            if (this->memory.find(baseAddr + index) == this->memory.end())
-              return false;
-          }
-          return true;
+          return this->memory.isDefined(baseAddr, size);
         }
 
 
@@ -753,11 +791,32 @@ namespace triton {
 
 
         void Arm32Cpu::clearConcreteMemoryValue(triton::uint64 baseAddr, triton::usize size) {
-          for (triton::usize index = 0; index < size; index++) {
-            if (this->memory.find(baseAddr + index) != this->memory.end()) {
-              this->memory.erase(baseAddr + index);
-            }
-          }
+          this->memory.erase(baseAddr, size);
+        }
+
+
+        void Arm32Cpu::mapConcreteMemoryArea(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size, const std::shared_ptr<const void>& owner) {
+          this->memory.map(baseAddr, area, size, owner);
+        }
+
+
+        void Arm32Cpu::unmapConcreteMemoryArea(triton::uint64 baseAddr) {
+          this->memory.unmap(baseAddr);
+        }
+
+
+        std::map<triton::uint64, triton::usize> Arm32Cpu::getMappedConcreteMemoryAreas(void) const {
+          return this->memory.getMappedAreas();
+        }
+
+
+        const triton::arch::ConcreteMemory& Arm32Cpu::getConcreteMemory(void) const {
+          return this->memory;
+        }
+
+
+        void Arm32Cpu::setConcreteMemory(const triton::arch::ConcreteMemory& memory) {
+          this->memory = memory;
         }
 
       }; /* arm32 namespace */
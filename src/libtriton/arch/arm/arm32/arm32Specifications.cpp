@@ -26,7 +26,6 @@ namespace triton {
             #define REG_SPEC(UPPER_NAME, LOWER_NAME, ARM32_UPPER, ARM32_LOWER, ARM32_PARENT, MUTABLE) \
               id2reg.emplace(ID_REG_ARM32_##UPPER_NAME,                                               \
                                  triton::arch::Register(triton::arch::ID_REG_ARM32_##UPPER_NAME,      \
-                                                        #LOWER_NAME,                                  \
                                                         triton::arch::ID_REG_ARM32_##ARM32_PARENT,    \
                                                         ARM32_UPPER,                                  \
                                                         ARM32_LOWER,                                  \
@@ -24,27 +24,6 @@ namespace triton {
       }
 
 
-      ArmOperandProperties::ArmOperandProperties(const ArmOperandProperties& other) {
-        this->extendSize          = other.extendSize;
-        this->extendType          = other.extendType;
-        this->shiftType           = other.shiftType;
-        this->shiftValueImmediate = other.shiftValueImmediate;
-        this->shiftValueRegister  = other.shiftValueRegister;
-        this->subtracted          = other.subtracted;
-      }
-
-
-      ArmOperandProperties& ArmOperandProperties::operator=(const ArmOperandProperties& other) {
-        this->extendSize          = other.extendSize;
-        this->extendType          = other.extendType;
-        this->shiftType           = other.shiftType;
-        this->shiftValueImmediate = other.shiftValueImmediate;
-        this->shiftValueRegister  = other.shiftValueRegister;
-        this->subtracted          = other.subtracted;
-        return *this;
-      }
-
-
       triton::arch::arm::shift_e ArmOperandProperties::getShiftType(void) const {
         return this->shiftType;
       }
@@ -0,0 +1,212 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <cstring>
+
+#include <triton/concreteMemory.hpp>
+#include <triton/exceptions.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+
+    const MappedMemoryArea* ConcreteMemory::findArea(triton::uint64 addr, triton::uint64* base) const {
+      if (this->areas == nullptr)
+        return nullptr;
+
+      auto it = this->areas->upper_bound(addr);
+      if (it == this->areas->begin())
+        return nullptr;
+
+      --it;
+      if (addr - it->first >= it->second.size)
+        return nullptr;
+
+      if (base)
+        *base = it->first;
+
+      return &it->second;
+    }
+
+
+    const triton::uint8* ConcreteMemory::get(triton::uint64 addr) const {
+      const triton::uint8* value = this->pages.get(addr);
+      if (value != nullptr || this->areas == nullptr)
+        return value;
+
+      triton::uint64 base = 0;
+      const MappedMemoryArea* area = this->findArea(addr, &base);
+      if (area == nullptr || this->holes.has(addr))
+        return nullptr;
+
+      return &area->data[addr - base];
+    }
+
+
+    bool ConcreteMemory::has(triton::uint64 addr) const {
+      return this->get(addr) != nullptr;
+    }
+
+
+    void ConcreteMemory::set(triton::uint64 addr, triton::uint8 value) {
+      this->pages.set(addr, value);
+      if (!this->holes.empty())
+        this->holes.erase(addr);
+    }
+
+
+    void ConcreteMemory::erase(triton::uint64 addr) {
+      this->pages.erase(addr);
+      if (this->findArea(addr, nullptr) != nullptr)
+        this->holes.insert(addr);
+    }
+
+
+    void ConcreteMemory::read(triton::uint64 addr, triton::uint8* out, triton::usize size) const {
+      /* Split an area which wraps around the address space */
+      if (size && addr + size - 1 < addr) {
+        triton::usize head = static_cast<triton::usize>(0 - addr);
+        this->read(addr, out, head);
+        this->read(0, out + head, size - head);
+        return;
+      }
+
+      std::memset(out, 0, size);
+
+      if (this->areas != nullptr && size) {
+        triton::uint64 last = addr + size - 1;
+        auto it = this->areas->upper_bound(addr);
+
+        if (it != this->areas->begin())
+          --it;
+
+        for (; it != this->areas->end() && it->first <= last; it++) {
+          triton::uint64 areaLast = it->first + it->second.size - 1;
+          if (areaLast < addr)
+            continue;
+
+          triton::uint64 from = std::max(addr, it->first);
+          triton::uint64 to   = std::min(last, areaLast);
+          std::memcpy(out + (from - addr), it->second.data + (from - it->first), static_cast<size_t>(to - from + 1));
+        }
+
+        if (!this->holes.empty()) {
+          for (triton::usize i = 0; i < size; i++) {
+            if (this->holes.has(addr + i))
+              out[i] = 0x00;
+          }
+        }
+      }
+
+      this->pages.getRange(addr, out, size);
+    }
+
+
+    void ConcreteMemory::write(triton::uint64 addr, const triton::uint8* values, triton::usize size) {
+      this->pages.setRange(addr, values, size);
+      if (!this->holes.empty())
+        this->holes.eraseRange(addr, size);
+    }
+
+
+    bool ConcreteMemory::isDefined(triton::uint64 addr, triton::usize size) const {
+      for (triton::usize index = 0; index < size; index++) {
+        if (!this->has(addr + index))
+          return false;
+      }
+      return true;
+    }
+
+
+    void ConcreteMemory::erase(triton::uint64 addr, triton::usize size) {
+      this->pages.eraseRange(addr, size);
+
+      if (this->areas == nullptr)
+        return;
+
+      for (triton::usize index = 0; index < size;) {
+        triton::uint64 base = 0;
+        const MappedMemoryArea* area = this->findArea(addr + index, &base);
+        if (area == nullptr) {
+          index++;
+          continue;
+        }
+        /* Cleared bytes of a mapped area are recorded as holes */
+        triton::usize count = std::min<triton::uint64>(size - index, base + area->size - (addr + index));
+        this->holes.insertRange(addr + index, count);
+        index += count;
+      }
+    }
+
+
+    void ConcreteMemory::map(triton::uint64 base, const triton::uint8* data, triton::usize size, const std::shared_ptr<const void>& owner) {
+      if (data == nullptr || size == 0)
+        throw triton::exceptions::Cpu("ConcreteMemory::map(): Cannot map an empty area.");
+
+      if (base + size - 1 < base)
+        throw triton::exceptions::Cpu("ConcreteMemory::map(): The area wraps around the address space.");
+
+      if (this->areas != nullptr) {
+        auto it = this->areas->upper_bound(base + size - 1);
+        if (it != this->areas->begin()) {
+          --it;
+          if (it->first + it->second.size - 1 >= base)
+            throw triton::exceptions::Cpu("ConcreteMemory::map(): The area overlaps an already mapped area.");
+        }
+      }
+
+      std::shared_ptr<MappedAreas> areas = (this->areas == nullptr) ? std::make_shared<MappedAreas>() : std::make_shared<MappedAreas>(*this->areas);
+      (*areas)[base] = MappedMemoryArea{data, size, owner};
+      this->areas = areas;
+
+      this->pages.eraseRange(base, size);
+      this->holes.eraseRange(base, size);
+    }
+
+
+    void ConcreteMemory::unmap(triton::uint64 base) {
+      if (this->areas == nullptr || this->areas->find(base) == this->areas->end())
+        throw triton::exceptions::Cpu("ConcreteMemory::unmap(): No area is mapped at this address.");
+
+      triton::usize size = this->areas->at(base).size;
+
+      std::shared_ptr<MappedAreas> areas = std::make_shared<MappedAreas>(*this->areas);
+      areas->erase(base);
+      this->areas = areas->empty() ? nullptr : areas;
+
+      this->pages.eraseRange(base, size);
+      this->holes.eraseRange(base, size);
+    }
+
+
+    bool ConcreteMemory::isMapped(triton::uint64 addr) const {
+      return this->findArea(addr, nullptr) != nullptr;
+    }
+
+
+    std::map<triton::uint64, triton::usize> ConcreteMemory::getMappedAreas(void) const {
+      std::map<triton::uint64, triton::usize> ret;
+
+      if (this->areas != nullptr) {
+        for (const auto& area : *this->areas)
+          ret[area.first] = area.second.size;
+      }
+
+      return ret;
+    }
+
+
+    void ConcreteMemory::clear(void) {
+      this->pages.clear();
+      this->holes.clear();
+      this->areas = nullptr;
+    }
+
+  }; /* arch namespace */
+}; /* triton namespace */
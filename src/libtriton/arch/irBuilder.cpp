@@ -230,6 +230,10 @@ namespace triton {
         this->removeSymbolicExpressions(inst);
       }
 
+      /* Forget the ids of the unreachable symbolic expressions (amortized) */
+      if (this->symbolicEngine->isEnabled() && this->modes->isModeEnabled(triton::modes::TRIM_SYMBOLIC_EXPRESSIONS))
+        this->symbolicEngine->trimSymbolicExpressions(false);
+
       this->astCtxt->garbage();
     }
 
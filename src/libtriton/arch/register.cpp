@@ -5,6 +5,8 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <type_traits>
+
 #include <triton/cpuInterface.hpp>
 #include <triton/register.hpp>
 
@@ -13,14 +15,37 @@
 namespace triton {
   namespace arch {
 
+    /* Names of registers indexed by their id. The order follows the register_e enum. */
+    static const char* const registerNames[] = {
+      "unknown",
+
+      #define REG_SPEC(_0, LOWER_NAME, _2, _3, _4, _5, _6, _7, _8) \
+      #LOWER_NAME,
+      #define REG_SPEC_NO_CAPSTONE REG_SPEC
+      #include "triton/x86.spec"
+
+      #define REG_SPEC(_0, LOWER_NAME, _2, _3, _4, _5) \
+      #LOWER_NAME,
+      #define REG_SPEC_NO_CAPSTONE REG_SPEC
+      #include "triton/aarch64.spec"
+
+      #define REG_SPEC(_0, LOWER_NAME, _2, _3, _4, _5) \
+      #LOWER_NAME,
+      #define REG_SPEC_NO_CAPSTONE REG_SPEC
+      #include "triton/arm32.spec"
+    };
+
+    static_assert(sizeof(registerNames) / sizeof(registerNames[0]) == triton::arch::ID_REG_LAST_ITEM, "registerNames must be synchronized with register_e");
+    static_assert(std::is_trivially_copyable<Register>::value, "Register must be trivially copyable");
+
+
     Register::Register()
-      : Register(triton::arch::ID_REG_INVALID, "unknown", triton::arch::ID_REG_INVALID, 0, 0, true) {
+      : Register(triton::arch::ID_REG_INVALID, triton::arch::ID_REG_INVALID, 0, 0, true) {
     }
 
 
-    Register::Register(triton::arch::register_e regId, std::string name, triton::arch::register_e parent, triton::uint32 high, triton::uint32 low, bool vmutable)
+    Register::Register(triton::arch::register_e regId, triton::arch::register_e parent, triton::uint32 high, triton::uint32 low, bool vmutable)
       : BitsVector(high, low),
-        name(name),
         id(regId),
         parent(parent),
         vmutable(vmutable) {
@@ -30,26 +55,11 @@ namespace triton {
     Register::Register(const triton::arch::CpuInterface& cpu, triton::arch::register_e regId)
       : Register(
           (regId == triton::arch::ID_REG_INVALID) ?
-          triton::arch::Register(triton::arch::ID_REG_INVALID, "unknown", triton::arch::ID_REG_INVALID, 0, 0, true) : cpu.getRegister(regId)
+          triton::arch::Register() : cpu.getRegister(regId)
         ) {
     }
 
 
-    Register::Register(const Register& other)
-      : BitsVector(other),
-        ArmOperandProperties(other) {
-      this->copy(other);
-    }
-
-
-    void Register::copy(const Register& other) {
-      this->id       = other.id;
-      this->name     = other.name;
-      this->parent   = other.parent;
-      this->vmutable = other.vmutable;
-    }
-
-
     triton::arch::register_e Register::getId(void) const {
       return this->id;
     }
@@ -71,7 +81,9 @@ namespace triton {
 
 
     std::string Register::getName(void) const {
-      return this->name;
+      if (this->id >= triton::arch::ID_REG_LAST_ITEM)
+        return registerNames[triton::arch::ID_REG_INVALID];
+      return registerNames[this->id];
     }
 
 
@@ -104,14 +116,6 @@ namespace triton {
     }
 
 
-    Register& Register::operator=(const Register& other) {
-      ArmOperandProperties::operator=(other);
-      BitsVector::operator=(other);
-      this->copy(other);
-      return *this;
-    }
-
-
     std::ostream& operator<<(std::ostream& stream, const Register& reg) {
       stream << reg.getName()
              << ":"
@@ -7,6 +7,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <mutex>
 
 #include <triton/architecture.hpp>
 #include <triton/coreUtils.hpp>
@@ -31,19 +32,25 @@ namespace triton {
 
 
       x86Cpu::x86Cpu(const x86Cpu& other) : x86Specifications(ARCH_X86) {
+        /* The disassembler is opened at the first disassembly, a snapshot never needs it */
+        this->handle = 0;
+
         this->copy(other);
       }
 
 
       x86Cpu::~x86Cpu() {
         this->memory.clear();
+        std::lock_guard<std::mutex> lock(triton::extlibs::capstone::getHandleMutex());
         if (this->handle) {
           triton::extlibs::capstone::cs_close(&this->handle);
         }
       }
 
 
-      void x86Cpu::disassInit(void) {
+      void x86Cpu::disassInit(void) const {
+        std::lock_guard<std::mutex> lock(triton::extlibs::capstone::getHandleMutex());
+
         if (this->handle) {
           triton::extlibs::capstone::cs_close(&this->handle);
         }
@@ -371,6 +378,10 @@ namespace triton {
           inst.setAddress(this->getConcreteRegisterValue(this->getProgramCounter()).convert_to<triton::uint64>());
         }
 
+        /* Copies open the disassembler lazily */
+        if (!this->handle)
+          this->disassInit();
+
         /* Let's disass and build our operands */
         count = triton::extlibs::capstone::cs_disasm(this->handle, inst.getOpcode(), inst.getSize(), inst.getAddress(), 0, &insn);
         if (count > 0) {
@@ -466,14 +477,16 @@ namespace triton {
 
 
       triton::uint8 x86Cpu::getConcreteMemoryValue(triton::uint64 addr, bool execCallbacks) const {
-        if (execCallbacks && this->callbacks)
+        if (execCallbacks && this->callbacks) {
+          this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_AREA_VALUE, addr, triton::size::byte);
           this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, MemoryAccess(addr, triton::size::byte));
+        }
 
-        auto it = this->memory.find(addr);
-        if (it == this->memory.end())
+        const triton::uint8* value = this->memory.get(addr);
+        if (value == nullptr)
           return 0x00;
 
-        return it->second;
+        return *value;
       }
 
 
@@ -482,8 +495,10 @@ namespace triton {
         triton::uint64 addr = 0;
         triton::uint32 size = 0;
 
-        if (execCallbacks && this->callbacks)
+        if (execCallbacks && this->callbacks) {
+          this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_AREA_VALUE, mem.getAddress(), mem.getSize());
           this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, mem);
+        }
 
         addr = mem.getAddress();
         size = mem.getSize();
@@ -499,15 +514,28 @@ namespace triton {
 
 
       std::vector<triton::uint8> x86Cpu::getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks) const {
-        std::vector<triton::uint8> area;
+        std::vector<triton::uint8> area(size);
 
-        for (triton::usize index = 0; index < size; index++)
-          area.push_back(this->getConcreteMemoryValue(baseAddr+index));
+        this->getConcreteMemoryAreaValue(baseAddr, area.data(), size, execCallbacks);
 
         return area;
       }
 
 
+      void x86Cpu::getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::uint8* area, triton::usize size, bool execCallbacks) const {
+        if (execCallbacks && this->callbacks) {
+          this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_AREA_VALUE, baseAddr, size);
+          /* Per-byte callbacks are only fired if one of them watches the area */
+          if (this->callbacks->isDefined(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, baseAddr, size)) {
+            for (triton::usize index = 0; index < size; index++)
+              this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, MemoryAccess(baseAddr+index, triton::size::byte));
+          }
+        }
+
+        this->memory.read(baseAddr, area, size);
+      }
+
+
       triton::uint512 x86Cpu::getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks) const {
         triton::uint512 value = 0;
 
@@ -659,9 +687,11 @@ namespace triton {
 
 
       void x86Cpu::setConcreteMemoryValue(triton::uint64 addr, triton::uint8 value) {
-        if (this->callbacks)
+        if (this->callbacks) {
+          this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_MEMORY_AREA_VALUE, addr, &value, triton::size::byte);
           this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_MEMORY_VALUE, MemoryAccess(addr, triton::size::byte), value);
-        this->memory[addr] = value;
+        }
+        this->memory.set(addr, value);
       }
 
 
@@ -669,6 +699,7 @@ namespace triton {
         triton::uint64 addr = mem.getAddress();
         triton::uint32 size = mem.getSize();
         triton::uint512 cv  = value;
+        triton::uint8 area[triton::size::dqqword];
 
         if (cv > mem.getMaxValue())
           throw triton::exceptions::Register("x86Cpu::setConcreteMemoryValue(): You cannot set this concrete value (too big) to this memory access.");
@@ -676,27 +707,36 @@ namespace triton {
         if (size == 0 || size > triton::size::dqqword)
           throw triton::exceptions::Cpu("x86Cpu::setConcreteMemoryValue(): Invalid size memory.");
 
-        if (this->callbacks)
-          this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_MEMORY_VALUE, mem, value);
-
         for (triton::uint32 i = 0; i < size; i++) {
-          this->memory[addr+i] = (cv & 0xff).convert_to<triton::uint8>();
+          area[i] = (cv & 0xff).convert_to<triton::uint8>();
           cv >>= 8;
         }
+
+        if (this->callbacks) {
+          this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_MEMORY_AREA_VALUE, addr, area, size);
+          this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_MEMORY_VALUE, mem, value);
+        }
+
+        this->memory.write(addr, area, size);
       }
 
 
       void x86Cpu::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const std::vector<triton::uint8>& values) {
-        for (triton::usize index = 0; index < values.size(); index++) {
-          this->setConcreteMemoryValue(baseAddr+index, values[index]);
-        }
+        this->setConcreteMemoryAreaValue(baseAddr, values.data(), values.size());
       }
 
 
       void x86Cpu::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size) {
-        for (triton::usize index = 0; index < size; index++) {
-          this->setConcreteMemoryValue(baseAddr+index, area[index]);
+        if (this->callbacks) {
+          this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_MEMORY_AREA_VALUE, baseAddr, area, size);
+          /* Per-byte callbacks are only fired if one of them watches the area */
+          if (this->callbacks->isDefined(triton::callbacks::SET_CONCRETE_MEMORY_VALUE, baseAddr, size)) {
+            for (triton::usize index = 0; index < size; index++)
+              this->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_MEMORY_VALUE, MemoryAccess(baseAddr+index, triton::size::byte), area[index]);
+          }
         }
+
+        this->memory.write(baseAddr, area, size);
       }
 
 
@@ -994,11 +1034,7 @@ namespace triton {
 
 
       bool x86Cpu::isConcreteMemoryValueDefined(triton::uint64 baseAddr, triton::usize size) const {
-        for (triton::usize index = 0; index < size; index++) {
-          if (this->memory.find(baseAddr + index) == this->memory.end())
-            return false;
-        }
-        return true;
+        return this->memory.isDefined(baseAddr, size);
       }
 
 
@@ -1008,11 +1044,32 @@ namespace triton {
 
 
       void x86Cpu::clearConcreteMemoryValue(triton::uint64 baseAddr, triton::usize size) {
-        for (triton::usize index = 0; index < size; index++) {
-          if (this->memory.find(baseAddr + index) != this->memory.end()) {
-            this->memory.erase(baseAddr + index);
-          }
-        }
+        this->memory.erase(baseAddr, size);
+      }
+
+
+      void x86Cpu::mapConcreteMemoryArea(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size, const std::shared_ptr<const void>& owner) {
+        this->memory.map(baseAddr, area, size, owner);
+      }
+
+
+      void x86Cpu::unmapConcreteMemoryArea(triton::uint64 baseAddr) {
+        this->memory.unmap(baseAddr);
+      }
+
+
+      std::map<triton::uint64, triton::usize> x86Cpu::getMappedConcreteMemoryAreas(void) const {
+        return this->memory.getMappedAreas();
+      }
+
+
+      const triton::arch::ConcreteMemory& x86Cpu::getConcreteMemory(void) const {
+        return this->memory;
+      }
+
+
+      void x86Cpu::setConcreteMemory(const triton::arch::ConcreteMemory& memory) {
+        this->memory = memory;
       }
 
     }; /* x86 namespace */
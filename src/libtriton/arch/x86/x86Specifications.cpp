@@ -26,7 +26,6 @@ namespace triton {
           #define REG_SPEC(UPPER_NAME, LOWER_NAME, X86_64_UPPER, X86_64_LOWER, X86_64_PARENT, X86_UPPER, X86_LOWER, X86_PARENT, X86_AVAIL)  \
             id2reg.emplace(ID_REG_X86_##UPPER_NAME,                                                       \
                                triton::arch::Register(triton::arch::ID_REG_X86_##UPPER_NAME,              \
-                                                      #LOWER_NAME,                                        \
                                                       triton::arch::ID_REG_X86_##X86_64_PARENT,           \
                                                       X86_64_UPPER,                                       \
                                                       X86_64_LOWER,                                       \
@@ -44,7 +43,6 @@ namespace triton {
           if (X86_AVAIL)                                                                                    \
             id2reg.emplace(ID_REG_X86_##UPPER_NAME,                                                         \
                                triton::arch::Register(triton::arch::ID_REG_X86_##UPPER_NAME,                \
-                                                      #LOWER_NAME,                                          \
                                                       triton::arch::ID_REG_X86_##X86_PARENT,                \
                                                       X86_UPPER,                                            \
                                                       X86_LOWER,                                            \
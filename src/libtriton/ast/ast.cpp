@@ -3153,7 +3153,75 @@ namespace triton {
     }
 
 
+    /*
+     * Returns an unrolled copy of a node. The unrolled copy of the AST of each
+     * referenced expression is cached in the AST context, so that it is shared
+     * between the calls instead of being copied again. The traversal stops at
+     * the references which are already cached.
+     */
+    static SharedAbstractNode unrolledInstance(AbstractNode* node) {
+      std::unordered_map<AbstractNode*, SharedAbstractNode> exprs;
+      std::stack<std::pair<AbstractNode*, bool>> worklist;
+      SharedAstContext ctxt = node->getContext();
+
+      worklist.push({node, false});
+      while (!worklist.empty()) {
+        AbstractNode* n = worklist.top().first;
+        bool postorder  = worklist.top().second;
+        worklist.pop();
+
+        if (exprs.find(n) != exprs.end())
+          continue;
+
+        if (n->getType() == REFERENCE_NODE) {
+          const auto& expr = reinterpret_cast<ReferenceNode*>(n)->getSymbolicExpression();
+          const auto& ast  = expr->getAst();
+
+          if (postorder) {
+            exprs[n] = exprs.at(ast.get());
+            ctxt->setUnrolledAst(expr->getId(), ast, exprs[n]);
+            continue;
+          }
+
+          auto cached = ctxt->getUnrolledAst(expr->getId(), ast);
+          if (cached != nullptr) {
+            exprs[n] = cached;
+            continue;
+          }
+
+          worklist.push({n, true});
+          worklist.push({ast.get(), false});
+          continue;
+        }
+
+        if (!postorder) {
+          worklist.push({n, true});
+          for (const auto& child : n->getChildren())
+            worklist.push({child.get(), false});
+          continue;
+        }
+
+        /* Do a copy of the node, its children are already copied */
+        const auto& newNode = shallowCopy(n, false);
+        exprs[n] = newNode;
+
+        if (n->getType() != VARIABLE_NODE) {
+          for (auto& child : newNode->getChildren()) {
+            child = exprs.at(child.get());
+            child->setParent(newNode.get());
+          }
+        }
+      }
+
+      /* Return the root node */
+      return exprs.at(node);
+    }
+
+
     SharedAbstractNode newInstance(AbstractNode* node, bool unroll) {
+      if (unroll)
+        return unrolledInstance(node);
+
       std::unordered_map<AbstractNode*, SharedAbstractNode> exprs;
       auto nodes = childrenExtraction(node->shared_from_this(), unroll, true);
 
@@ -3175,6 +3243,28 @@ namespace triton {
     }
 
 
+    SharedAbstractNode newInstance(AbstractNode* node, const std::vector<SharedAbstractNode>& children) {
+      if (node == nullptr)
+        throw triton::exceptions::Ast("triton::ast::newInstance(): node cannot be null.");
+
+      if (node->getChildren().size() != children.size())
+        throw triton::exceptions::Ast("triton::ast::newInstance(): Invalid number of children.");
+
+      if (children.empty())
+        return node->shared_from_this();
+
+      const auto& newNode = shallowCopy(node, false);
+      auto& newChildren = newNode->getChildren();
+      for (triton::usize index = 0; index < children.size(); index++) {
+        newChildren[index] = children[index];
+        newChildren[index]->setParent(newNode.get());
+      }
+      newNode->init();
+
+      return newNode;
+    }
+
+
     SharedAbstractNode unroll(const triton::ast::SharedAbstractNode& node) {
       return triton::ast::newInstance(node.get(), true);
     }
@@ -3259,6 +3349,67 @@ namespace triton {
     }
 
 
+    std::vector<AbstractNode*> dagExtraction(AbstractNode* node, const std::function<std::vector<AbstractNode*>(AbstractNode*)>& operands, triton::usize depth, std::unordered_map<AbstractNode*, triton::usize>& names) {
+      std::unordered_map<AbstractNode*, std::vector<AbstractNode*>> edges;
+      std::unordered_map<AbstractNode*, triton::usize> uses;
+      std::unordered_map<AbstractNode*, triton::usize> depths;
+      std::stack<std::pair<AbstractNode*, bool>> worklist;
+      std::vector<AbstractNode*> result;
+
+      if (node == nullptr)
+        throw triton::exceptions::Ast("triton::ast::dagExtraction(): Node cannot be null.");
+
+      /* Sort nodes topologically and count their uses */
+      worklist.push({node, false});
+      while (!worklist.empty()) {
+        AbstractNode* n = worklist.top().first;
+        bool postOrder = worklist.top().second;
+        worklist.pop();
+
+        if (postOrder) {
+          result.push_back(n);
+          continue;
+        }
+
+        if (edges.find(n) != edges.end())
+          continue;
+
+        worklist.push({n, true});
+
+        auto& ops = edges[n] = operands(n);
+        for (auto* op : ops) {
+          uses[op]++;
+          if (edges.find(op) == edges.end())
+            worklist.push({op, false});
+        }
+      }
+
+      /* Number the shared nodes, children first */
+      for (auto* n : result) {
+        const auto& ops = edges[n];
+
+        if (depth) {
+          triton::usize d = 0;
+          for (auto* op : ops) {
+            if (names.find(op) == names.end())
+              d = std::max(d, depths[op]);
+          }
+          depths[n] = d + 1;
+        }
+
+        if (ops.empty() || n == node || n->getType() == ASSERT_NODE)
+          continue;
+
+        if (uses[n] > 1 || (depth && depths[n] > depth)) {
+          triton::usize id = names.size();
+          names[n] = id;
+        }
+      }
+
+      return result;
+    }
+
+
     std::deque<SharedAbstractNode> search(const SharedAbstractNode& node, triton::ast::ast_e match) {
       std::stack<AbstractNode*>                worklist;
       std::deque<SharedAbstractNode>           result;
@@ -5,8 +5,10 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <algorithm>
 #include <list>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include <triton/ast.hpp>
@@ -22,10 +24,23 @@ namespace triton {
 
     AstContext::AstContext(const triton::modes::SharedModes& modes)
       : modes(modes) {
+      this->unrolledAstsLimit = 1024;
+    }
+
+
+    AstContext::AstContext(const AstContext& other)
+      : std::enable_shared_from_this<AstContext>(other),
+        modes(other.modes),
+        astRepresentation(other.astRepresentation),
+        valueMapping(other.valueMapping),
+        nodes(other.nodes),
+        unrolledAsts(other.unrolledAsts),
+        unrolledAstsLimit(other.unrolledAstsLimit) {
     }
 
 
     AstContext::~AstContext() {
+      this->unrolledAsts.clear();
       this->valueMapping.clear();
       this->nodes.clear();
     }
@@ -38,6 +53,8 @@ namespace triton {
       this->modes             = other.modes;
       this->valueMapping      = other.valueMapping;
       this->nodes             = other.nodes;
+      this->unrolledAsts      = other.unrolledAsts;
+      this->unrolledAstsLimit = other.unrolledAstsLimit;
 
       return *this;
     }
@@ -71,6 +88,39 @@ namespace triton {
     }
 
 
+    SharedAbstractNode AstContext::getUnrolledAst(triton::usize id, const SharedAbstractNode& ast) const {
+      auto it = this->unrolledAsts.find(id);
+
+      /* The AST of the expression may have been replaced since (or the id reused) */
+      if (it == this->unrolledAsts.end() || it->second.first.lock() != ast)
+        return nullptr;
+
+      return it->second.second;
+    }
+
+
+    void AstContext::setUnrolledAst(triton::usize id, const SharedAbstractNode& ast, const SharedAbstractNode& unrolled) {
+      this->unrolledAsts[id] = std::make_pair(WeakAbstractNode(ast), unrolled);
+
+      /* Forget the expressions which do not exist anymore (amortized) */
+      if (this->unrolledAsts.size() > this->unrolledAstsLimit) {
+        for (auto it = this->unrolledAsts.begin(); it != this->unrolledAsts.end();) {
+          if (it->second.first.expired())
+            it = this->unrolledAsts.erase(it);
+          else
+            it++;
+        }
+        this->unrolledAstsLimit = std::max<triton::usize>(1024, this->unrolledAsts.size() * 2);
+      }
+    }
+
+
+    void AstContext::clearUnrolledAsts(void) {
+      this->unrolledAsts.clear();
+      this->unrolledAstsLimit = 1024;
+    }
+
+
     SharedAbstractNode AstContext::assert_(const SharedAbstractNode& expr) {
       SharedAbstractNode node = std::make_shared<AssertNode>(expr);
       if (node == nullptr)
@@ -1026,6 +1076,41 @@ namespace triton {
     }
 
 
+    const std::unordered_map<std::string, std::pair<triton::ast::WeakAbstractNode, triton::uint512>>& AstContext::getVariables(void) const {
+      return this->valueMapping;
+    }
+
+
+    void AstContext::setVariables(const std::unordered_map<std::string, std::pair<triton::ast::WeakAbstractNode, triton::uint512>>& variables) {
+      std::vector<SharedAbstractNode> changed;
+      auto mapping = variables;
+
+      for (auto& kv : mapping) {
+        auto it = this->valueMapping.find(kv.first);
+
+        /* A node created since is still the node of the variable */
+        if (kv.second.first.expired() && it != this->valueMapping.end())
+          kv.second.first = it->second.first;
+
+        if (it == this->valueMapping.end() || it->second.second != kv.second.second) {
+          if (auto node = kv.second.first.lock())
+            changed.push_back(node);
+        }
+      }
+
+      this->valueMapping = std::move(mapping);
+
+      /* The nodes are shared, their evaluation must follow the new values */
+      for (const auto& node : changed)
+        node->initParents();
+    }
+
+
+    void AstContext::removeVariable(const std::string& name) {
+      this->valueMapping.erase(name);
+    }
+
+
     SharedAbstractNode AstContext::getVariableNode(const std::string& name) {
       auto it = this->valueMapping.find(name);
       if (it != this->valueMapping.end()) {
@@ -1067,6 +1152,11 @@ namespace triton {
     }
 
 
+    std::ostream& AstContext::printHoisted(std::ostream& stream, AbstractNode* node, triton::usize limit) {
+      return this->astRepresentation.printHoisted(stream, node, limit);
+    }
+
+
     SharedAbstractNode AstContext::simplify_concat(std::vector<SharedAbstractNode> exprs) {
       /*
        * Optimization: concatenate extractions in one if possible. We are
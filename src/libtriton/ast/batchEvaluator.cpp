@@ -0,0 +1,546 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+
+#include <triton/batchEvaluator.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/symbolicExpression.hpp>
+#include <triton/symbolicVariable.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    /* Returns the mask of a size */
+    template <typename T>
+    static inline T getMask(triton::uint32 size) {
+      if (size >= static_cast<triton::uint32>(std::numeric_limits<T>::digits))
+        return ~static_cast<T>(0);
+      return (static_cast<T>(1) << size) - 1;
+    }
+
+
+    /* Returns the opposite of a value of a size */
+    template <typename T>
+    static inline T negate(const T& value, const T& mask) {
+      return (~value + 1) & mask;
+    }
+
+
+    /* Returns the magnitude of a signed value of a size */
+    template <typename T>
+    static inline T magnitude(const T& value, const T& sign, const T& mask) {
+      return (value & sign) ? negate<T>(value, mask) : value;
+    }
+
+
+    BatchEvaluator::BatchEvaluator(const triton::ast::SharedAbstractNode& node) {
+      if (node == nullptr)
+        throw triton::exceptions::Ast("BatchEvaluator::BatchEvaluator(): The node cannot be null.");
+
+      this->registers    = 0;
+      this->result       = 0;
+      this->size         = node->getBitvectorSize();
+      this->vectorizable = true;
+
+      this->compile(node);
+      this->allocate();
+    }
+
+
+    void BatchEvaluator::compile(const triton::ast::SharedAbstractNode& root) {
+      /* The instruction of each compiled node */
+      std::unordered_map<triton::ast::AbstractNode*, triton::usize> compiled;
+      /* The index of each variable by id, in order of appearance */
+      std::unordered_map<triton::usize, triton::usize> indexes;
+      /* The nodes to compile, with true when their operands are compiled */
+      std::vector<std::pair<triton::ast::AbstractNode*, bool>> worklist;
+
+      worklist.push_back(std::make_pair(root.get(), false));
+      while (!worklist.empty()) {
+        triton::ast::AbstractNode* node = worklist.back().first;
+        bool ready = worklist.back().second;
+        worklist.pop_back();
+
+        if (compiled.find(node) != compiled.end())
+          continue;
+
+        Instruction ins;
+        ins.type        = node->getType();
+        ins.size        = node->getBitvectorSize();
+        ins.operandSize = 0;
+        ins.dst         = this->tape.size();
+        ins.immediate   = 0;
+
+        /* Subexpressions without symbolic variable are folded */
+        if (!node->isSymbolized()) {
+          ins.type      = BV_NODE;
+          ins.immediate = node->evaluate();
+          compiled[node] = ins.dst;
+          this->tape.push_back(ins);
+          continue;
+        }
+
+        /* The operands of the node, integer parameters are not operands */
+        std::vector<triton::ast::AbstractNode*> operands;
+        switch (node->getType()) {
+          case REFERENCE_NODE:
+            operands.push_back(reinterpret_cast<ReferenceNode*>(node)->getSymbolicExpression()->getAst().get());
+            break;
+
+          case BVROL_NODE:
+          case BVROR_NODE:
+            operands.push_back(node->getChildren()[0].get());
+            ins.immediate = reinterpret_cast<IntegerNode*>(node->getChildren()[1].get())->getInteger() % ins.size;
+            break;
+
+          case EXTRACT_NODE:
+            operands.push_back(node->getChildren()[2].get());
+            ins.immediate = reinterpret_cast<IntegerNode*>(node->getChildren()[1].get())->getInteger();
+            break;
+
+          case SX_NODE:
+          case ZX_NODE:
+            operands.push_back(node->getChildren()[1].get());
+            break;
+
+          case VARIABLE_NODE:
+            break;
+
+          case BVADD_NODE:
+          case BVAND_NODE:
+          case BVASHR_NODE:
+          case BVLSHR_NODE:
+          case BVMUL_NODE:
+          case BVNAND_NODE:
+          case BVNEG_NODE:
+          case BVNOR_NODE:
+          case BVNOT_NODE:
+          case BVOR_NODE:
+          case BVSDIV_NODE:
+          case BVSGE_NODE:
+          case BVSGT_NODE:
+          case BVSHL_NODE:
+          case BVSLE_NODE:
+          case BVSLT_NODE:
+          case BVSMOD_NODE:
+          case BVSREM_NODE:
+          case BVSUB_NODE:
+          case BVUDIV_NODE:
+          case BVUGE_NODE:
+          case BVUGT_NODE:
+          case BVULE_NODE:
+          case BVULT_NODE:
+          case BVUREM_NODE:
+          case BVXNOR_NODE:
+          case BVXOR_NODE:
+          case CONCAT_NODE:
+          case DISTINCT_NODE:
+          case EQUAL_NODE:
+          case IFF_NODE:
+          case ITE_NODE:
+          case LAND_NODE:
+          case LNOT_NODE:
+          case LOR_NODE:
+          case LXOR_NODE:
+            for (const auto& child : node->getChildren())
+              operands.push_back(child.get());
+            break;
+
+          default:
+            throw triton::exceptions::Ast("BatchEvaluator::compile(): Unsupported node.");
+        }
+
+        /* Compile the operands first */
+        if (!ready) {
+          worklist.push_back(std::make_pair(node, true));
+          for (auto it = operands.rbegin(); it != operands.rend(); it++) {
+            if (compiled.find(*it) == compiled.end())
+              worklist.push_back(std::make_pair(*it, false));
+          }
+          continue;
+        }
+
+        /* A reference is its expression */
+        if (node->getType() == REFERENCE_NODE) {
+          compiled[node] = compiled[operands[0]];
+          continue;
+        }
+
+        if (node->getType() == VARIABLE_NODE) {
+          const auto& var = reinterpret_cast<VariableNode*>(node)->getSymbolicVariable();
+          auto it = indexes.find(var->getId());
+          if (it == indexes.end()) {
+            it = indexes.insert(std::make_pair(var->getId(), this->variables.size())).first;
+            this->variables.push_back(var);
+          }
+          ins.immediate = it->second;
+        }
+
+        for (auto* operand : operands) {
+          ins.src.push_back(compiled[operand]);
+          ins.sizes.push_back(operand->getBitvectorSize());
+        }
+
+        if (!operands.empty())
+          ins.operandSize = operands[0]->getBitvectorSize();
+
+        if (ins.size > 64 || ins.operandSize > 64)
+          this->vectorizable = false;
+
+        compiled[node] = ins.dst;
+        this->tape.push_back(ins);
+      }
+
+      this->result = compiled[root.get()];
+
+      /* Sort the variables by id */
+      std::vector<triton::usize> order(this->variables.size());
+      for (triton::usize i = 0; i < order.size(); i++)
+        order[i] = i;
+
+      std::sort(order.begin(), order.end(), [this](triton::usize a, triton::usize b) {
+        return this->variables[a]->getId() < this->variables[b]->getId();
+      });
+
+      std::vector<triton::usize> positions(order.size());
+      std::vector<triton::engines::symbolic::SharedSymbolicVariable> sorted;
+      for (triton::usize i = 0; i < order.size(); i++) {
+        positions[order[i]] = i;
+        sorted.push_back(this->variables[order[i]]);
+      }
+      this->variables = sorted;
+
+      for (auto& ins : this->tape) {
+        if (ins.type == VARIABLE_NODE)
+          ins.immediate = positions[ins.immediate.convert_to<triton::usize>()];
+      }
+
+      if (this->tape[this->result].size > 64)
+        this->vectorizable = false;
+    }
+
+
+    void BatchEvaluator::allocate(void) {
+      /* The last instruction reading each value, the result is read at the end */
+      std::vector<triton::usize> lastUse(this->tape.size(), 0);
+      for (triton::usize i = 0; i < this->tape.size(); i++) {
+        for (triton::usize src : this->tape[i].src)
+          lastUse[src] = i;
+      }
+      lastUse[this->result] = this->tape.size();
+
+      std::vector<triton::usize> assigned(this->tape.size(), 0);
+      std::vector<triton::usize> freed;
+
+      for (triton::usize i = 0; i < this->tape.size(); i++) {
+        Instruction& ins = this->tape[i];
+
+        /* The result never overlaps an operand, so that the loops do not alias */
+        if (freed.empty()) {
+          assigned[i] = this->registers++;
+        }
+        else {
+          assigned[i] = freed.back();
+          freed.pop_back();
+        }
+
+        for (triton::usize& src : ins.src) {
+          triton::usize value = src;
+          src = assigned[value];
+          if (lastUse[value] == i) {
+            freed.push_back(src);
+            lastUse[value] = this->tape.size() + 1;
+          }
+        }
+
+        /* A value which is never read is dead at once */
+        if (lastUse[i] == 0 && i != this->result)
+          freed.push_back(assigned[i]);
+
+        ins.dst = assigned[i];
+      }
+
+      this->result = assigned[this->result];
+    }
+
+
+    template <typename T>
+    void BatchEvaluator::run(const std::vector<const T*>& inputs, triton::usize count, T* output) const {
+      std::vector<T> regs(this->registers * BLOCK_SIZE);
+
+      for (triton::usize base = 0; base < count; base += BLOCK_SIZE) {
+        const triton::usize n = (count - base < BLOCK_SIZE) ? count - base : BLOCK_SIZE;
+
+        for (const auto& ins : this->tape) {
+          T* d       = &regs[ins.dst * BLOCK_SIZE];
+          const T* a = ins.src.size() > 0 ? &regs[ins.src[0] * BLOCK_SIZE] : nullptr;
+          const T* b = ins.src.size() > 1 ? &regs[ins.src[1] * BLOCK_SIZE] : nullptr;
+          const T* c = ins.src.size() > 2 ? &regs[ins.src[2] * BLOCK_SIZE] : nullptr;
+          const T m  = getMask<T>(ins.size);
+
+          switch (ins.type) {
+            case BV_NODE: {
+              const T value = static_cast<T>(ins.immediate);
+              for (triton::usize i = 0; i < n; i++) d[i] = value;
+              break;
+            }
+
+            case VARIABLE_NODE: {
+              const T* v = inputs[ins.immediate.convert_to<triton::usize>()] + base;
+              for (triton::usize i = 0; i < n; i++) d[i] = v[i] & m;
+              break;
+            }
+
+            case BVADD_NODE:  for (triton::usize i = 0; i < n; i++) d[i] = (a[i] + b[i]) & m; break;
+            case BVAND_NODE:  for (triton::usize i = 0; i < n; i++) d[i] = a[i] & b[i]; break;
+            case BVMUL_NODE:  for (triton::usize i = 0; i < n; i++) d[i] = (a[i] * b[i]) & m; break;
+            case BVNAND_NODE: for (triton::usize i = 0; i < n; i++) d[i] = ~(a[i] & b[i]) & m; break;
+            case BVNEG_NODE:  for (triton::usize i = 0; i < n; i++) d[i] = (~a[i] + 1) & m; break;
+            case BVNOR_NODE:  for (triton::usize i = 0; i < n; i++) d[i] = ~(a[i] | b[i]) & m; break;
+            case BVNOT_NODE:  for (triton::usize i = 0; i < n; i++) d[i] = ~a[i] & m; break;
+            case BVOR_NODE:   for (triton::usize i = 0; i < n; i++) d[i] = a[i] | b[i]; break;
+            case BVSUB_NODE:  for (triton::usize i = 0; i < n; i++) d[i] = (a[i] - b[i]) & m; break;
+            case BVXNOR_NODE: for (triton::usize i = 0; i < n; i++) d[i] = ~(a[i] ^ b[i]) & m; break;
+            case BVXOR_NODE:  for (triton::usize i = 0; i < n; i++) d[i] = a[i] ^ b[i]; break;
+
+            /* Like AbstractNode::evaluate(), the shift is truncated to 32 bits */
+            case BVSHL_NODE:
+              for (triton::usize i = 0; i < n; i++) {
+                triton::uint32 shift = static_cast<triton::uint32>(b[i]);
+                d[i] = (shift >= ins.size) ? static_cast<T>(0) : static_cast<T>((a[i] << shift) & m);
+              }
+              break;
+
+            case BVLSHR_NODE:
+              for (triton::usize i = 0; i < n; i++) {
+                triton::uint32 shift = static_cast<triton::uint32>(b[i]);
+                d[i] = (shift >= ins.size) ? static_cast<T>(0) : static_cast<T>(a[i] >> shift);
+              }
+              break;
+
+            case BVASHR_NODE: {
+              const T sign = static_cast<T>(1) << (ins.size - 1);
+              for (triton::usize i = 0; i < n; i++) {
+                triton::uint32 shift = static_cast<triton::uint32>(b[i]);
+                T fill = (a[i] & sign) ? m : static_cast<T>(0);
+                d[i] = (shift >= ins.size) ? fill : static_cast<T>((a[i] >> shift) | (fill & ~(m >> shift)));
+              }
+              break;
+            }
+
+            case BVROL_NODE: {
+              const triton::uint32 rot = ins.immediate.convert_to<triton::uint32>();
+              if (rot == 0) { for (triton::usize i = 0; i < n; i++) d[i] = a[i]; break; }
+              for (triton::usize i = 0; i < n; i++) d[i] = ((a[i] << rot) | (a[i] >> (ins.size - rot))) & m;
+              break;
+            }
+
+            case BVROR_NODE: {
+              const triton::uint32 rot = ins.immediate.convert_to<triton::uint32>();
+              if (rot == 0) { for (triton::usize i = 0; i < n; i++) d[i] = a[i]; break; }
+              for (triton::usize i = 0; i < n; i++) d[i] = ((a[i] >> rot) | (a[i] << (ins.size - rot))) & m;
+              break;
+            }
+
+            case BVUDIV_NODE: for (triton::usize i = 0; i < n; i++) d[i] = b[i] ? static_cast<T>(a[i] / b[i]) : m; break;
+            case BVUREM_NODE: for (triton::usize i = 0; i < n; i++) d[i] = b[i] ? static_cast<T>(a[i] % b[i]) : a[i]; break;
+
+            /* Signed divisions work on the magnitudes, which always fit in the size */
+            case BVSDIV_NODE: {
+              const T sign = static_cast<T>(1) << (ins.size - 1);
+              for (triton::usize i = 0; i < n; i++) {
+                if (!b[i]) {
+                  d[i] = (a[i] & sign) ? static_cast<T>(1) : m;
+                  continue;
+                }
+                T q = magnitude<T>(a[i], sign, m) / magnitude<T>(b[i], sign, m);
+                d[i] = (((a[i] ^ b[i]) & sign) ? negate<T>(q, m) : q) & m;
+              }
+              break;
+            }
+
+            case BVSREM_NODE: {
+              const T sign = static_cast<T>(1) << (ins.size - 1);
+              for (triton::usize i = 0; i < n; i++) {
+                if (!b[i]) {
+                  d[i] = a[i];
+                  continue;
+                }
+                T r = magnitude<T>(a[i], sign, m) % magnitude<T>(b[i], sign, m);
+                d[i] = (a[i] & sign) ? negate<T>(r, m) : r;
+              }
+              break;
+            }
+
+            case BVSMOD_NODE: {
+              const T sign = static_cast<T>(1) << (ins.size - 1);
+              for (triton::usize i = 0; i < n; i++) {
+                if (!b[i]) {
+                  d[i] = a[i];
+                  continue;
+                }
+                T r = magnitude<T>(a[i], sign, m) % magnitude<T>(b[i], sign, m);
+                if (a[i] & sign)
+                  r = negate<T>(r, m);
+                d[i] = (r && ((r ^ b[i]) & sign)) ? static_cast<T>((r + b[i]) & m) : r;
+              }
+              break;
+            }
+
+            /* Signed comparisons are unsigned comparisons with the sign bit flipped */
+            case BVSGE_NODE: {
+              const T sign = static_cast<T>(1) << (ins.operandSize - 1);
+              for (triton::usize i = 0; i < n; i++) d[i] = static_cast<T>((a[i] ^ sign) >= (b[i] ^ sign));
+              break;
+            }
+
+            case BVSGT_NODE: {
+              const T sign = static_cast<T>(1) << (ins.operandSize - 1);
+              for (triton::usize i = 0; i < n; i++) d[i] = static_cast<T>((a[i] ^ sign) > (b[i] ^ sign));
+              break;
+            }
+
+            case BVSLE_NODE: {
+              const T sign = static_cast<T>(1) << (ins.operandSize - 1);
+              for (triton::usize i = 0; i < n; i++) d[i] = static_cast<T>((a[i] ^ sign) <= (b[i] ^ sign));
+              break;
+            }
+
+            case BVSLT_NODE: {
+              const T sign = static_cast<T>(1) << (ins.operandSize - 1);
+              for (triton::usize i = 0; i < n; i++) d[i] = static_cast<T>((a[i] ^ sign) < (b[i] ^ sign));
+              break;
+            }
+
+            case BVUGE_NODE:    for (triton::usize i = 0; i < n; i++) d[i] = static_cast<T>(a[i] >= b[i]); break;
+            case BVUGT_NODE:    for (triton::usize i = 0; i < n; i++) d[i] = static_cast<T>(a[i] > b[i]); break;
+            case BVULE_NODE:    for (triton::usize i = 0; i < n; i++) d[i] = static_cast<T>(a[i] <= b[i]); break;
+            case BVULT_NODE:    for (triton::usize i = 0; i < n; i++) d[i] = static_cast<T>(a[i] < b[i]); break;
+            case DISTINCT_NODE: for (triton::usize i = 0; i < n; i++) d[i] = static_cast<T>(a[i] != b[i]); break;
+            case EQUAL_NODE:    for (triton::usize i = 0; i < n; i++) d[i] = static_cast<T>(a[i] == b[i]); break;
+            case IFF_NODE:      for (triton::usize i = 0; i < n; i++) d[i] = static_cast<T>(!a[i] == !b[i]); break;
+            case ITE_NODE:      for (triton::usize i = 0; i < n; i++) d[i] = a[i] ? b[i] : c[i]; break;
+            case LNOT_NODE:     for (triton::usize i = 0; i < n; i++) d[i] = static_cast<T>(!a[i]); break;
+
+            case LAND_NODE:
+            case LOR_NODE:
+            case LXOR_NODE:
+              for (triton::usize i = 0; i < n; i++) d[i] = static_cast<T>(a[i] != 0);
+              for (triton::usize k = 1; k < ins.src.size(); k++) {
+                const T* o = &regs[ins.src[k] * BLOCK_SIZE];
+                if (ins.type == LAND_NODE)     for (triton::usize i = 0; i < n; i++) d[i] = d[i] & static_cast<T>(o[i] != 0);
+                else if (ins.type == LOR_NODE) for (triton::usize i = 0; i < n; i++) d[i] = d[i] | static_cast<T>(o[i] != 0);
+                else                           for (triton::usize i = 0; i < n; i++) d[i] = d[i] ^ static_cast<T>(o[i] != 0);
+              }
+              break;
+
+            case CONCAT_NODE:
+              for (triton::usize i = 0; i < n; i++) d[i] = a[i];
+              for (triton::usize k = 1; k < ins.src.size(); k++) {
+                const T* o = &regs[ins.src[k] * BLOCK_SIZE];
+                const triton::uint32 shift = ins.sizes[k];
+                for (triton::usize i = 0; i < n; i++) d[i] = (d[i] << shift) | o[i];
+              }
+              break;
+
+            case EXTRACT_NODE: {
+              const triton::uint32 low = ins.immediate.convert_to<triton::uint32>();
+              for (triton::usize i = 0; i < n; i++) d[i] = (a[i] >> low) & m;
+              break;
+            }
+
+            case SX_NODE: {
+              const T sign = static_cast<T>(1) << (ins.operandSize - 1);
+              const T ext  = ~getMask<T>(ins.operandSize) & m;
+              for (triton::usize i = 0; i < n; i++) d[i] = (a[i] & sign) ? static_cast<T>(a[i] | ext) : a[i];
+              break;
+            }
+
+            case ZX_NODE: for (triton::usize i = 0; i < n; i++) d[i] = a[i]; break;
+
+            default:
+              throw triton::exceptions::Ast("BatchEvaluator::run(): Unsupported node.");
+          }
+        }
+
+        const T* r = &regs[this->result * BLOCK_SIZE];
+        std::copy(r, r + n, output + base);
+      }
+    }
+
+
+    const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& BatchEvaluator::getVariables(void) const {
+      return this->variables;
+    }
+
+
+    triton::usize BatchEvaluator::getTapeSize(void) const {
+      return this->tape.size();
+    }
+
+
+    triton::usize BatchEvaluator::getNumberOfRegisters(void) const {
+      return this->registers;
+    }
+
+
+    triton::uint32 BatchEvaluator::getBitvectorSize(void) const {
+      return this->size;
+    }
+
+
+    bool BatchEvaluator::isVectorizable(void) const {
+      return this->vectorizable;
+    }
+
+
+    std::vector<triton::uint64> BatchEvaluator::evaluate(const std::vector<std::vector<triton::uint64>>& inputs) const {
+      if (!this->vectorizable)
+        throw triton::exceptions::Ast("BatchEvaluator::evaluate(): The AST has values larger than 64 bits.");
+
+      if (inputs.size() != this->variables.size())
+        throw triton::exceptions::Ast("BatchEvaluator::evaluate(): Wrong number of variables.");
+
+      triton::usize count = inputs.empty() ? 1 : inputs[0].size();
+      std::vector<const triton::uint64*> columns;
+      for (const auto& column : inputs) {
+        if (column.size() != count)
+          throw triton::exceptions::Ast("BatchEvaluator::evaluate(): All variables must have the same number of values.");
+        columns.push_back(column.data());
+      }
+
+      std::vector<triton::uint64> output(count);
+      this->run<triton::uint64>(columns, count, output.data());
+      return output;
+    }
+
+
+    std::vector<triton::uint512> BatchEvaluator::evaluate(const std::vector<std::vector<triton::uint512>>& inputs) const {
+      if (inputs.size() != this->variables.size())
+        throw triton::exceptions::Ast("BatchEvaluator::evaluate(): Wrong number of variables.");
+
+      triton::usize count = inputs.empty() ? 1 : inputs[0].size();
+      std::vector<const triton::uint512*> columns;
+      for (const auto& column : inputs) {
+        if (column.size() != count)
+          throw triton::exceptions::Ast("BatchEvaluator::evaluate(): All variables must have the same number of values.");
+        columns.push_back(column.data());
+      }
+
+      std::vector<triton::uint512> output(count);
+      this->run<triton::uint512>(columns, count, output.data());
+      return output;
+    }
+
+  }; /* ast namespace */
+}; /* triton namespace */
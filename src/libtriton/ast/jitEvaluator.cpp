@@ -0,0 +1,492 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#if defined(__unix__) || defined(__APPLE__)
+  #include <sys/mman.h>
+#elif _WIN32
+  #include <windows.h>
+#endif
+
+#include <cstring>
+
+#include <triton/exceptions.hpp>
+#include <triton/jitEvaluator.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    /* The x86-64 registers */
+    enum jit_reg_e {
+      RAX = 0, RCX = 1, RDX = 2, RBX = 3, RSP = 4, RBP = 5, RSI = 6, RDI = 7,
+      R8  = 8, R9  = 9, R10 = 10, R11 = 11,
+    };
+
+    /* The arguments of a call, the scratch registers (rax, rcx, rdx, r8, r10, r11) are volatile in both ABIs */
+    #if defined(_WIN32)
+    static const triton::uint32 ARG0 = RCX, ARG1 = RDX, ARG2 = R8;
+    #else
+    static const triton::uint32 ARG0 = RDI, ARG1 = RSI, ARG2 = RDX;
+    #endif
+
+    /* Opcodes of the reg/reg instructions */
+    static const triton::uint8 OP_ADD  = 0x01;
+    static const triton::uint8 OP_OR   = 0x09;
+    static const triton::uint8 OP_AND  = 0x21;
+    static const triton::uint8 OP_SUB  = 0x29;
+    static const triton::uint8 OP_XOR  = 0x31;
+    static const triton::uint8 OP_CMP  = 0x39;
+    static const triton::uint8 OP_TEST = 0x85;
+    static const triton::uint8 OP_MOV  = 0x89;
+
+    /* Extensions of the unary and shift instructions */
+    static const triton::uint32 EXT_ROL = 0, EXT_ROR = 1, EXT_NOT = 2, EXT_NEG = 3, EXT_SHL = 4, EXT_SHR = 5, EXT_DIV = 6, EXT_SAR = 7;
+
+    /* Condition codes */
+    static const triton::uint8 CC_B = 0x2, CC_AE = 0x3, CC_E = 0x4, CC_NE = 0x5, CC_BE = 0x6, CC_A = 0x7;
+
+
+    /* Signed divisions, on the magnitudes like BatchEvaluator */
+    static triton::uint64 jitSdiv(triton::uint64 a, triton::uint64 b, triton::uint32 size) {
+      triton::uint64 mask = (size >= 64) ? ~0ULL : ((1ULL << size) - 1);
+      triton::uint64 sign = 1ULL << (size - 1);
+      if (b == 0)
+        return (a & sign) ? 1 : mask;
+      triton::uint64 ma = (a & sign) ? ((~a + 1) & mask) : a;
+      triton::uint64 mb = (b & sign) ? ((~b + 1) & mask) : b;
+      triton::uint64 q  = ma / mb;
+      return (((a ^ b) & sign) ? (~q + 1) : q) & mask;
+    }
+
+
+    static triton::uint64 jitSrem(triton::uint64 a, triton::uint64 b, triton::uint32 size) {
+      triton::uint64 mask = (size >= 64) ? ~0ULL : ((1ULL << size) - 1);
+      triton::uint64 sign = 1ULL << (size - 1);
+      if (b == 0)
+        return a;
+      triton::uint64 ma = (a & sign) ? ((~a + 1) & mask) : a;
+      triton::uint64 mb = (b & sign) ? ((~b + 1) & mask) : b;
+      triton::uint64 r  = ma % mb;
+      return (a & sign) ? ((~r + 1) & mask) : r;
+    }
+
+
+    static triton::uint64 jitSmod(triton::uint64 a, triton::uint64 b, triton::uint32 size) {
+      triton::uint64 mask = (size >= 64) ? ~0ULL : ((1ULL << size) - 1);
+      triton::uint64 sign = 1ULL << (size - 1);
+      if (b == 0)
+        return a;
+      triton::uint64 r = jitSrem(a, b, size);
+      return (r && ((r ^ b) & sign)) ? ((r + b) & mask) : r;
+    }
+
+
+    /* Emits a REX prefix if needed */
+    static void emitRex(std::vector<triton::uint8>& code, bool wide, triton::uint32 reg, triton::uint32 rm) {
+      triton::uint8 rex = 0x40 | (wide ? 0x08 : 0) | (((reg >> 3) & 1) << 2) | ((rm >> 3) & 1);
+      if (rex != 0x40)
+        code.push_back(rex);
+    }
+
+
+    /* Emits an instruction with a reg/reg operand */
+    static void emitRR(std::vector<triton::uint8>& code, std::vector<triton::uint8> opcode, triton::uint32 reg, triton::uint32 rm, bool wide=true) {
+      emitRex(code, wide, reg, rm);
+      code.insert(code.end(), opcode.begin(), opcode.end());
+      code.push_back(0xC0 | ((reg & 7) << 3) | (rm & 7));
+    }
+
+
+    /* Emits a 32-bit value */
+    static void emitImm32(std::vector<triton::uint8>& code, triton::uint32 value) {
+      for (triton::uint32 i = 0; i < 4; i++)
+        code.push_back(static_cast<triton::uint8>(value >> (i * 8)));
+    }
+
+
+    /* Emits an instruction with a [base + disp32] operand, the base cannot be rsp or r12 */
+    static void emitRM(std::vector<triton::uint8>& code, triton::uint8 opcode, triton::uint32 reg, triton::uint32 base, triton::sint32 disp) {
+      emitRex(code, true, reg, base);
+      code.push_back(opcode);
+      code.push_back(0x80 | ((reg & 7) << 3) | (base & 7));
+      emitImm32(code, static_cast<triton::uint32>(disp));
+    }
+
+
+    /* mov reg, imm64 */
+    static void emitMovImm(std::vector<triton::uint8>& code, triton::uint32 reg, triton::uint64 value) {
+      emitRex(code, true, 0, reg);
+      code.push_back(0xB8 + (reg & 7));
+      for (triton::uint32 i = 0; i < 8; i++)
+        code.push_back(static_cast<triton::uint8>(value >> (i * 8)));
+    }
+
+
+    /* op reg, imm8 for the shifts and rotations */
+    static void emitShiftImm(std::vector<triton::uint8>& code, triton::uint32 ext, triton::uint32 reg, triton::uint32 count) {
+      emitRR(code, {0xC1}, ext, reg);
+      code.push_back(static_cast<triton::uint8>(count));
+    }
+
+
+    /* cmp reg, imm32 */
+    static void emitCmpImm(std::vector<triton::uint8>& code, triton::uint32 reg, triton::uint32 value) {
+      emitRR(code, {0x81}, 7, reg);
+      emitImm32(code, value);
+    }
+
+
+    /* Masks a register to a size */
+    static void emitMask(std::vector<triton::uint8>& code, triton::uint32 reg, triton::uint32 size) {
+      if (size >= 64)
+        return;
+
+      triton::uint64 mask = (1ULL << size) - 1;
+      if (mask <= 0x7fffffff) {
+        emitRR(code, {0x81}, 4, reg);
+        emitImm32(code, static_cast<triton::uint32>(mask));
+      }
+      else {
+        emitMovImm(code, R11, mask);
+        emitRR(code, {OP_AND}, R11, reg);
+      }
+    }
+
+
+    /* Sign extends a register from a size to 64 bits */
+    static void emitSignExtend(std::vector<triton::uint8>& code, triton::uint32 reg, triton::uint32 size) {
+      if (size >= 64)
+        return;
+      emitShiftImm(code, EXT_SHL, reg, 64 - size);
+      emitShiftImm(code, EXT_SAR, reg, 64 - size);
+    }
+
+
+    /* setcc al, movzx eax, al */
+    static void emitSetcc(std::vector<triton::uint8>& code, triton::uint8 cc) {
+      code.insert(code.end(), {0x0F, static_cast<triton::uint8>(0x90 | cc), 0xC0});
+      code.insert(code.end(), {0x0F, 0xB6, 0xC0});
+    }
+
+
+    /* cmovcc dst, src */
+    static void emitCmov(std::vector<triton::uint8>& code, triton::uint8 cc, triton::uint32 dst, triton::uint32 src) {
+      emitRR(code, {0x0F, static_cast<triton::uint8>(0x40 | cc)}, dst, src);
+    }
+
+
+    /* The displacement of a register of the tape from rbp, below the saved rbx */
+    static triton::sint32 getSlot(triton::usize reg) {
+      return -16 - static_cast<triton::sint32>(reg * 8);
+    }
+
+
+    JitEvaluator::JitEvaluator(const triton::ast::SharedAbstractNode& node)
+      : tape(node) {
+      this->memory   = nullptr;
+      this->function = nullptr;
+
+      if (!JitEvaluator::isSupported())
+        throw triton::exceptions::Ast("JitEvaluator::JitEvaluator(): Native code generation is not supported on this platform.");
+
+      if (!this->tape.isVectorizable())
+        throw triton::exceptions::Ast("JitEvaluator::JitEvaluator(): The AST has values larger than 64 bits.");
+
+      this->emit();
+      this->load();
+    }
+
+
+    bool JitEvaluator::isSupported(void) {
+      #if (defined(__x86_64__) || defined(_M_X64)) && (defined(__unix__) || defined(__APPLE__) || defined(_WIN32))
+      return true;
+      #else
+      return false;
+      #endif
+    }
+
+
+    void JitEvaluator::emit(void) {
+      std::vector<triton::uint8>& c = this->code;
+
+      /* The frame holds the registers of the tape and the shadow space of the calls, rsp stays aligned on 16 bytes */
+      triton::uint32 frame = static_cast<triton::uint32>(this->tape.registers * 8 + 32);
+      if (frame % 16 == 0)
+        frame += 8;
+
+      /* push rbp; mov rbp, rsp; push rbx; sub rsp, frame; mov rbx, inputs */
+      c.push_back(0x55);
+      emitRR(c, {OP_MOV}, RSP, RBP);
+      c.push_back(0x53);
+      emitRR(c, {0x81}, 5, RSP);
+      emitImm32(c, frame);
+      emitRR(c, {OP_MOV}, ARG0, RBX);
+
+      for (const auto& ins : this->tape.tape) {
+        const triton::uint32 size = ins.size;
+
+        if (ins.src.size() > 0) emitRM(c, 0x8B, RAX, RBP, getSlot(ins.src[0]));
+        if (ins.src.size() > 1) emitRM(c, 0x8B, RCX, RBP, getSlot(ins.src[1]));
+
+        switch (ins.type) {
+          case BV_NODE:
+            emitMovImm(c, RAX, ins.immediate.convert_to<triton::uint64>());
+            break;
+
+          case VARIABLE_NODE:
+            emitRM(c, 0x8B, RAX, RBX, static_cast<triton::sint32>(ins.immediate.convert_to<triton::uint32>() * 8));
+            emitMask(c, RAX, size);
+            break;
+
+          case BVADD_NODE:  emitRR(c, {OP_ADD}, RCX, RAX); emitMask(c, RAX, size); break;
+          case BVAND_NODE:  emitRR(c, {OP_AND}, RCX, RAX); break;
+          case BVMUL_NODE:  emitRR(c, {0x0F, 0xAF}, RAX, RCX); emitMask(c, RAX, size); break;
+          case BVNAND_NODE: emitRR(c, {OP_AND}, RCX, RAX); emitRR(c, {0xF7}, EXT_NOT, RAX); emitMask(c, RAX, size); break;
+          case BVNEG_NODE:  emitRR(c, {0xF7}, EXT_NEG, RAX); emitMask(c, RAX, size); break;
+          case BVNOR_NODE:  emitRR(c, {OP_OR}, RCX, RAX); emitRR(c, {0xF7}, EXT_NOT, RAX); emitMask(c, RAX, size); break;
+          case BVNOT_NODE:  emitRR(c, {0xF7}, EXT_NOT, RAX); emitMask(c, RAX, size); break;
+          case BVOR_NODE:   emitRR(c, {OP_OR}, RCX, RAX); break;
+          case BVSUB_NODE:  emitRR(c, {OP_SUB}, RCX, RAX); emitMask(c, RAX, size); break;
+          case BVXNOR_NODE: emitRR(c, {OP_XOR}, RCX, RAX); emitRR(c, {0xF7}, EXT_NOT, RAX); emitMask(c, RAX, size); break;
+          case BVXOR_NODE:  emitRR(c, {OP_XOR}, RCX, RAX); break;
+
+          /* Like AbstractNode::evaluate(), the shift is truncated to 32 bits, a shift of the size or more gives 0 */
+          case BVSHL_NODE:
+          case BVLSHR_NODE:
+            emitRR(c, {OP_MOV}, RCX, RDX, false);
+            emitRR(c, {0xD3}, (ins.type == BVSHL_NODE) ? EXT_SHL : EXT_SHR, RAX);
+            emitMask(c, RAX, size);
+            emitRR(c, {OP_XOR}, R10, R10, false);
+            emitCmpImm(c, RDX, size);
+            emitCmov(c, CC_AE, RAX, R10);
+            break;
+
+          /* A shift of the size or more gives the sign */
+          case BVASHR_NODE:
+            emitRR(c, {OP_MOV}, RCX, RDX, false);
+            emitSignExtend(c, RAX, size);
+            emitRR(c, {OP_MOV}, RAX, R10);
+            emitShiftImm(c, EXT_SAR, R10, 63);
+            emitMask(c, R10, size);
+            emitRR(c, {0xD3}, EXT_SAR, RAX);
+            emitMask(c, RAX, size);
+            emitCmpImm(c, RDX, size);
+            emitCmov(c, CC_AE, RAX, R10);
+            break;
+
+          case BVROL_NODE:
+          case BVROR_NODE: {
+            const triton::uint32 rot = ins.immediate.convert_to<triton::uint32>();
+            if (rot == 0)
+              break;
+            if (size == 64) {
+              emitShiftImm(c, (ins.type == BVROL_NODE) ? EXT_ROL : EXT_ROR, RAX, rot);
+              break;
+            }
+            emitRR(c, {OP_MOV}, RAX, R10);
+            emitShiftImm(c, (ins.type == BVROL_NODE) ? EXT_SHL : EXT_SHR, RAX, rot);
+            emitShiftImm(c, (ins.type == BVROL_NODE) ? EXT_SHR : EXT_SHL, R10, size - rot);
+            emitRR(c, {OP_OR}, R10, RAX);
+            emitMask(c, RAX, size);
+            break;
+          }
+
+          /* The divisor 0 is replaced by 1 and the result is fixed afterwards */
+          case BVUDIV_NODE:
+          case BVUREM_NODE:
+            emitRR(c, {OP_MOV}, RCX, R8);
+            emitMovImm(c, R10, 1);
+            emitRR(c, {OP_TEST}, RCX, RCX);
+            emitCmov(c, CC_E, RCX, R10);
+            emitRR(c, {OP_XOR}, RDX, RDX, false);
+            emitRR(c, {0xF7}, EXT_DIV, RCX);
+            if (ins.type == BVUDIV_NODE) {
+              emitMovImm(c, R10, (size >= 64) ? ~0ULL : ((1ULL << size) - 1));
+            }
+            else {
+              emitRR(c, {OP_MOV}, RDX, RAX);
+              emitRM(c, 0x8B, R10, RBP, getSlot(ins.src[0]));
+            }
+            emitRR(c, {OP_TEST}, R8, R8);
+            emitCmov(c, CC_E, RAX, R10);
+            break;
+
+          case BVSDIV_NODE:
+          case BVSMOD_NODE:
+          case BVSREM_NODE: {
+            triton::uint64 helper = 0;
+            if (ins.type == BVSDIV_NODE)      helper = reinterpret_cast<triton::uint64>(&jitSdiv);
+            else if (ins.type == BVSMOD_NODE) helper = reinterpret_cast<triton::uint64>(&jitSmod);
+            else                              helper = reinterpret_cast<triton::uint64>(&jitSrem);
+            emitRR(c, {OP_MOV}, RCX, ARG1);
+            emitRR(c, {OP_MOV}, RAX, ARG0);
+            emitMovImm(c, ARG2, size);
+            emitMovImm(c, RAX, helper);
+            emitRR(c, {0xFF}, 2, RAX, false);
+            break;
+          }
+
+          /* Signed comparisons are unsigned comparisons with the sign bit flipped */
+          case BVSGE_NODE:
+          case BVSGT_NODE:
+          case BVSLE_NODE:
+          case BVSLT_NODE:
+            emitMovImm(c, RDX, 1ULL << (ins.operandSize - 1));
+            emitRR(c, {OP_XOR}, RDX, RAX);
+            emitRR(c, {OP_XOR}, RDX, RCX);
+            emitRR(c, {OP_CMP}, RCX, RAX);
+            if (ins.type == BVSGE_NODE)      emitSetcc(c, CC_AE);
+            else if (ins.type == BVSGT_NODE) emitSetcc(c, CC_A);
+            else if (ins.type == BVSLE_NODE) emitSetcc(c, CC_BE);
+            else                             emitSetcc(c, CC_B);
+            break;
+
+          case BVUGE_NODE:    emitRR(c, {OP_CMP}, RCX, RAX); emitSetcc(c, CC_AE); break;
+          case BVUGT_NODE:    emitRR(c, {OP_CMP}, RCX, RAX); emitSetcc(c, CC_A); break;
+          case BVULE_NODE:    emitRR(c, {OP_CMP}, RCX, RAX); emitSetcc(c, CC_BE); break;
+          case BVULT_NODE:    emitRR(c, {OP_CMP}, RCX, RAX); emitSetcc(c, CC_B); break;
+          case DISTINCT_NODE: emitRR(c, {OP_CMP}, RCX, RAX); emitSetcc(c, CC_NE); break;
+          case EQUAL_NODE:    emitRR(c, {OP_CMP}, RCX, RAX); emitSetcc(c, CC_E); break;
+          case IFF_NODE:      emitRR(c, {OP_CMP}, RCX, RAX); emitSetcc(c, CC_E); break;
+          case LNOT_NODE:     emitRR(c, {OP_TEST}, RAX, RAX); emitSetcc(c, CC_E); break;
+
+          case ITE_NODE:
+            emitRR(c, {OP_MOV}, RAX, RDX);
+            emitRM(c, 0x8B, RAX, RBP, getSlot(ins.src[2]));
+            emitRR(c, {OP_TEST}, RDX, RDX);
+            emitCmov(c, CC_NE, RAX, RCX);
+            break;
+
+          /* The operands of the logical operators are 0 or 1 */
+          case LAND_NODE:
+          case LOR_NODE:
+          case LXOR_NODE:
+            for (triton::usize k = 1; k < ins.src.size(); k++) {
+              if (k > 1)
+                emitRM(c, 0x8B, RCX, RBP, getSlot(ins.src[k]));
+              if (ins.type == LAND_NODE)     emitRR(c, {OP_AND}, RCX, RAX);
+              else if (ins.type == LOR_NODE) emitRR(c, {OP_OR}, RCX, RAX);
+              else                           emitRR(c, {OP_XOR}, RCX, RAX);
+            }
+            break;
+
+          case CONCAT_NODE:
+            for (triton::usize k = 1; k < ins.src.size(); k++) {
+              if (k > 1)
+                emitRM(c, 0x8B, RCX, RBP, getSlot(ins.src[k]));
+              emitShiftImm(c, EXT_SHL, RAX, ins.sizes[k]);
+              emitRR(c, {OP_OR}, RCX, RAX);
+            }
+            break;
+
+          case EXTRACT_NODE: {
+            const triton::uint32 low = ins.immediate.convert_to<triton::uint32>();
+            if (low > 0)
+              emitShiftImm(c, EXT_SHR, RAX, low);
+            emitMask(c, RAX, size);
+            break;
+          }
+
+          case SX_NODE:
+            emitSignExtend(c, RAX, ins.operandSize);
+            emitMask(c, RAX, size);
+            break;
+
+          case ZX_NODE:
+            break;
+
+          default:
+            throw triton::exceptions::Ast("JitEvaluator::emit(): Unsupported node.");
+        }
+
+        emitRM(c, OP_MOV, RAX, RBP, getSlot(ins.dst));
+      }
+
+      /* mov rax, result; mov rbx, [rbp - 8]; leave; ret */
+      emitRM(c, 0x8B, RAX, RBP, getSlot(this->tape.result));
+      emitRM(c, 0x8B, RBX, RBP, -8);
+      c.push_back(0xC9);
+      c.push_back(0xC3);
+    }
+
+
+    #if defined(__unix__) || defined(__APPLE__)
+
+    void JitEvaluator::load(void) {
+      void* memory = mmap(nullptr, this->code.size(), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (memory == MAP_FAILED)
+        throw triton::exceptions::Ast("JitEvaluator::load(): Cannot allocate memory.");
+
+      std::memcpy(memory, this->code.data(), this->code.size());
+      if (mprotect(memory, this->code.size(), PROT_READ | PROT_EXEC) != 0) {
+        munmap(memory, this->code.size());
+        throw triton::exceptions::Ast("JitEvaluator::load(): Cannot make the memory executable.");
+      }
+
+      this->memory   = memory;
+      this->function = reinterpret_cast<function_t>(memory);
+    }
+
+
+    JitEvaluator::~JitEvaluator() {
+      if (this->memory)
+        munmap(this->memory, this->code.size());
+    }
+
+    #elif _WIN32
+
+    void JitEvaluator::load(void) {
+      DWORD old = 0;
+
+      void* memory = VirtualAlloc(nullptr, this->code.size(), MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+      if (memory == nullptr)
+        throw triton::exceptions::Ast("JitEvaluator::load(): Cannot allocate memory.");
+
+      std::memcpy(memory, this->code.data(), this->code.size());
+      if (!VirtualProtect(memory, this->code.size(), PAGE_EXECUTE_READ, &old)) {
+        VirtualFree(memory, 0, MEM_RELEASE);
+        throw triton::exceptions::Ast("JitEvaluator::load(): Cannot make the memory executable.");
+      }
+
+      FlushInstructionCache(GetCurrentProcess(), memory, this->code.size());
+      this->memory   = memory;
+      this->function = reinterpret_cast<function_t>(memory);
+    }
+
+
+    JitEvaluator::~JitEvaluator() {
+      if (this->memory)
+        VirtualFree(this->memory, 0, MEM_RELEASE);
+    }
+
+    #endif
+
+
+    const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& JitEvaluator::getVariables(void) const {
+      return this->tape.getVariables();
+    }
+
+
+    triton::usize JitEvaluator::getCodeSize(void) const {
+      return this->code.size();
+    }
+
+
+    JitEvaluator::function_t JitEvaluator::getFunction(void) const {
+      return this->function;
+    }
+
+
+    triton::uint64 JitEvaluator::evaluate(const std::vector<triton::uint64>& inputs) const {
+      if (inputs.size() != this->tape.getVariables().size())
+        throw triton::exceptions::Ast("JitEvaluator::evaluate(): Wrong number of variables.");
+      return this->function(inputs.data());
+    }
+
+  }; /* ast namespace */
+}; /* triton namespace */
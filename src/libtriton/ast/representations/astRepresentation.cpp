@@ -7,6 +7,9 @@
 
 #include <new>
 #include <memory>
+#include <streambuf>
+#include <unordered_map>
+#include <vector>
 
 #include <triton/astRepresentation.hpp>
 #include <triton/exceptions.hpp>
@@ -61,6 +64,156 @@ namespace triton {
         return this->representations[this->mode]->print(stream, node);
       }
 
+
+      /* A stream buffer which forwards at most `limit` characters */
+      class LimitedStreambuf : public std::streambuf {
+        private:
+          std::streambuf* output;
+          triton::usize remaining;
+          bool truncated;
+
+        protected:
+          int_type overflow(int_type c) override {
+            if (traits_type::eq_int_type(c, traits_type::eof()))
+              return traits_type::not_eof(c);
+            if (this->remaining == 0) {
+              this->truncated = true;
+              return traits_type::eof();
+            }
+            this->remaining--;
+            return this->output->sputc(traits_type::to_char_type(c));
+          }
+
+          std::streamsize xsputn(const char* s, std::streamsize n) override {
+            std::streamsize count = (static_cast<triton::usize>(n) > this->remaining) ? static_cast<std::streamsize>(this->remaining) : n;
+            if (count < n)
+              this->truncated = true;
+            this->remaining -= static_cast<triton::usize>(count);
+            return this->output->sputn(s, count);
+          }
+
+        public:
+          LimitedStreambuf(std::streambuf* output, triton::usize limit)
+            : output(output), remaining(limit), truncated(false) {
+          }
+
+          bool isTruncated(void) const {
+            return this->truncated;
+          }
+      };
+
+
+      /* Prints hoisted nodes by their temporary name and forwards the others to a representation */
+      class HoistedRepresentation : public AstRepresentationInterface {
+        private:
+          AstRepresentationInterface* base;
+          const std::unordered_map<AbstractNode*, triton::usize>& names;
+
+        public:
+          /* The hoisted node currently defined (printed in full instead of its temporary name) */
+          AbstractNode* defining;
+
+          HoistedRepresentation(AstRepresentationInterface* base, const std::unordered_map<AbstractNode*, triton::usize>& names)
+            : base(base), names(names), defining(nullptr) {
+          }
+
+          std::ostream& print(std::ostream& stream, AbstractNode* node) override {
+            if (node != this->defining) {
+              auto it = this->names.find(node);
+              if (it != this->names.end())
+                return stream << "t" << std::dec << it->second;
+            }
+            return this->base->print(stream, node);
+          }
+      };
+
+
+      /* Returns the operands of a node which may be hoisted into temporaries */
+      static std::vector<AbstractNode*> getHoistableOperands(AbstractNode* node) {
+        std::vector<AbstractNode*> operands;
+
+        switch (node->getType()) {
+          case BV_NODE:
+          case COMPOUND_NODE:
+          case DECLARE_NODE:
+          case FORALL_NODE:
+          case INTEGER_NODE:
+          case LET_NODE:
+          case REFERENCE_NODE:
+          case STRING_NODE:
+          case VARIABLE_NODE:
+            break;
+          default:
+            operands.reserve(node->getChildren().size());
+            for (const auto& child : node->getChildren())
+              operands.push_back(child.get());
+            break;
+        }
+
+        return operands;
+      }
+
+
+      std::ostream& AstRepresentation::printHoisted(std::ostream& stream, AbstractNode* node, triton::usize limit) {
+        std::unordered_map<AbstractNode*, triton::usize> names;
+
+        if (node == nullptr)
+          throw triton::exceptions::AstRepresentation("AstRepresentation::printHoisted(): node cannot be null.");
+
+        /* Binders are not traversed, the nodes under them refer to their names and stay in place */
+        std::vector<AbstractNode*> nodes = triton::ast::dagExtraction(node, getHoistableOperands, HOIST_DEPTH, names);
+
+        std::vector<AbstractNode*> order;
+        for (auto* n : nodes) {
+          if (names.find(n) != names.end())
+            order.push_back(n);
+        }
+
+        /* The representation is only wrapped while printing, whatever happens */
+        struct Restore {
+          std::unique_ptr<AstRepresentationInterface>& slot;
+          std::unique_ptr<AstRepresentationInterface> original;
+          ~Restore() {
+            slot = std::move(original);
+          }
+        } restore = {this->representations[this->mode], std::move(this->representations[this->mode])};
+
+        HoistedRepresentation* hoisted = new HoistedRepresentation(restore.original.get(), names);
+        this->representations[this->mode].reset(hoisted);
+
+        LimitedStreambuf buffer(stream.rdbuf(), limit ? limit : static_cast<triton::usize>(-1));
+        std::ostream output(&buffer);
+
+        for (triton::usize index = 0; index < order.size() && output.good(); index++) {
+          AbstractNode* tmp = order[index];
+          hoisted->defining = tmp;
+          if (this->mode == triton::ast::representations::SMT_REPRESENTATION) {
+            output << "(define-fun t" << index << " () ";
+            if (tmp->isLogical())
+              output << "Bool ";
+            else
+              output << "(_ BitVec " << std::dec << tmp->getBitvectorSize() << ") ";
+            this->print(output, tmp);
+            output << ")\n";
+          }
+          else {
+            output << "t" << index << " = ";
+            this->print(output, tmp);
+            output << "\n";
+          }
+        }
+
+        if (output.good()) {
+          hoisted->defining = node;
+          this->print(output, node);
+        }
+
+        if (buffer.isTruncated())
+          stream << "...";
+
+        return stream;
+      }
+
     };
   };
 };
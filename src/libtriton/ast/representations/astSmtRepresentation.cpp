@@ -5,6 +5,8 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <map>
+
 #include <triton/astSmtRepresentation.hpp>
 #include <triton/exceptions.hpp>
 #include <triton/symbolicExpression.hpp>
@@ -488,6 +490,238 @@ namespace triton {
         return stream;
       }
 
+
+      /* Returns the SMT operator of nodes printed as (<operator> <operands>) */
+      static const char* getOperator(triton::ast::ast_e kind) {
+        switch (kind) {
+          case ASSERT_NODE:               return "assert";
+          case BVADD_NODE:                return "bvadd";
+          case BVAND_NODE:                return "bvand";
+          case BVASHR_NODE:               return "bvashr";
+          case BVLSHR_NODE:               return "bvlshr";
+          case BVMUL_NODE:                return "bvmul";
+          case BVNAND_NODE:               return "bvnand";
+          case BVNEG_NODE:                return "bvneg";
+          case BVNOR_NODE:                return "bvnor";
+          case BVNOT_NODE:                return "bvnot";
+          case BVOR_NODE:                 return "bvor";
+          case BVSDIV_NODE:               return "bvsdiv";
+          case BVSGE_NODE:                return "bvsge";
+          case BVSGT_NODE:                return "bvsgt";
+          case BVSHL_NODE:                return "bvshl";
+          case BVSLE_NODE:                return "bvsle";
+          case BVSLT_NODE:                return "bvslt";
+          case BVSMOD_NODE:               return "bvsmod";
+          case BVSREM_NODE:               return "bvsrem";
+          case BVSUB_NODE:                return "bvsub";
+          case BVUDIV_NODE:               return "bvudiv";
+          case BVUGE_NODE:                return "bvuge";
+          case BVUGT_NODE:                return "bvugt";
+          case BVULE_NODE:                return "bvule";
+          case BVULT_NODE:                return "bvult";
+          case BVUREM_NODE:               return "bvurem";
+          case BVXNOR_NODE:               return "bvxnor";
+          case BVXOR_NODE:                return "bvxor";
+          case CONCAT_NODE:               return "concat";
+          case DISTINCT_NODE:             return "distinct";
+          case EQUAL_NODE:                return "=";
+          case IFF_NODE:                  return "iff";
+          case ITE_NODE:                  return "ite";
+          case LAND_NODE:                 return "and";
+          case LNOT_NODE:                 return "not";
+          case LOR_NODE:                  return "or";
+          case LXOR_NODE:                 return "xor";
+          default:
+            return nullptr;
+        }
+      }
+
+
+      /* Returns true if the node is printed as a whole by printDag (leaves and binders) */
+      static bool isAtomic(triton::ast::ast_e kind) {
+        switch (kind) {
+          case BV_NODE:
+          case COMPOUND_NODE:
+          case DECLARE_NODE:
+          case FORALL_NODE:
+          case INTEGER_NODE:
+          case LET_NODE:
+          case STRING_NODE:
+          case VARIABLE_NODE:
+            return true;
+          default:
+            return false;
+        }
+      }
+
+
+      triton::ast::AbstractNode* AstSmtRepresentation::resolve(triton::ast::AbstractNode* node) const {
+        while (node->getType() == REFERENCE_NODE)
+          node = reinterpret_cast<triton::ast::ReferenceNode*>(node)->getSymbolicExpression()->getAst().get();
+        return node;
+      }
+
+
+      std::vector<triton::ast::AbstractNode*> AstSmtRepresentation::getOperands(triton::ast::AbstractNode* node) const {
+        std::vector<triton::ast::AbstractNode*> operands;
+        const auto& children = node->getChildren();
+
+        switch (node->getType()) {
+          /* Integer parameters are printed in the operator */
+          case BVROL_NODE:
+          case BVROR_NODE:
+            operands.push_back(this->resolve(children[0].get()));
+            break;
+
+          case EXTRACT_NODE:
+            operands.push_back(this->resolve(children[2].get()));
+            break;
+
+          case SX_NODE:
+          case ZX_NODE:
+            operands.push_back(this->resolve(children[1].get()));
+            break;
+
+          default:
+            if (isAtomic(node->getType()))
+              break;
+            operands.reserve(children.size());
+            for (const auto& child : children)
+              operands.push_back(this->resolve(child.get()));
+            break;
+        }
+
+        return operands;
+      }
+
+
+      void AstSmtRepresentation::printBody(std::ostream& stream, triton::ast::AbstractNode* node, const std::unordered_map<triton::ast::AbstractNode*, triton::usize>& names) {
+        struct Frame {
+          std::vector<triton::ast::AbstractNode*> operands;
+          triton::usize index;
+        };
+
+        /*
+         *  We use a worklist strategy to avoid recursive calls
+         *  and so stack overflow when printing a deep AST.
+         */
+        std::vector<Frame> worklist;
+        bool top = true;
+
+        while (true) {
+          if (!top) {
+            if (worklist.empty())
+              break;
+
+            Frame& frame = worklist.back();
+            if (frame.index == frame.operands.size()) {
+              stream << ")";
+              worklist.pop_back();
+              continue;
+            }
+
+            if (frame.index)
+              stream << " ";
+            node = frame.operands[frame.index++];
+
+            /* Shared operands are printed by their name */
+            auto it = names.find(node);
+            if (it != names.end()) {
+              stream << "node!" << std::dec << it->second;
+              continue;
+            }
+          }
+          top = false;
+
+          switch (node->getType()) {
+            case BV_NODE:
+              stream << "(_ bv" << reinterpret_cast<triton::ast::IntegerNode*>(node->getChildren()[0].get())->getInteger() << " " << std::dec << node->getBitvectorSize() << ")";
+              continue;
+
+            case BVROL_NODE:
+              stream << "((_ rotate_left " << reinterpret_cast<triton::ast::IntegerNode*>(node->getChildren()[1].get())->getInteger() << ") ";
+              break;
+
+            case BVROR_NODE:
+              stream << "((_ rotate_right " << reinterpret_cast<triton::ast::IntegerNode*>(node->getChildren()[1].get())->getInteger() << ") ";
+              break;
+
+            case EXTRACT_NODE:
+              stream << "((_ extract " << reinterpret_cast<triton::ast::IntegerNode*>(node->getChildren()[0].get())->getInteger() << " " << reinterpret_cast<triton::ast::IntegerNode*>(node->getChildren()[1].get())->getInteger() << ") ";
+              break;
+
+            case SX_NODE:
+              stream << "((_ sign_extend " << reinterpret_cast<triton::ast::IntegerNode*>(node->getChildren()[0].get())->getInteger() << ") ";
+              break;
+
+            case ZX_NODE:
+              stream << "((_ zero_extend " << reinterpret_cast<triton::ast::IntegerNode*>(node->getChildren()[0].get())->getInteger() << ") ";
+              break;
+
+            default:
+              if (isAtomic(node->getType())) {
+                this->print(stream, node);
+                continue;
+              }
+              if (getOperator(node->getType()) == nullptr)
+                throw triton::exceptions::AstRepresentation("AstSmtRepresentation::printDag(): Invalid kind node.");
+              stream << "(" << getOperator(node->getType()) << " ";
+              break;
+          }
+
+          worklist.push_back({this->getOperands(node), 0});
+        }
+      }
+
+
+      std::ostream& AstSmtRepresentation::printDag(std::ostream& stream, const triton::ast::SharedAbstractNode& node, bool assert_) {
+        std::unordered_map<triton::ast::AbstractNode*, triton::usize> names;
+        std::map<triton::usize, triton::engines::symbolic::SharedSymbolicVariable> vars;
+
+        if (node == nullptr)
+          throw triton::exceptions::AstRepresentation("AstSmtRepresentation::printDag(): Node cannot be null.");
+
+        triton::ast::AbstractNode* root = this->resolve(node.get());
+        auto operands = [this](triton::ast::AbstractNode* n) { return this->getOperands(n); };
+        std::vector<triton::ast::AbstractNode*> nodes = triton::ast::dagExtraction(root, operands, 0, names);
+
+        /* Declare symbolic variables */
+        for (auto* n : nodes) {
+          if (n->getType() == VARIABLE_NODE) {
+            const auto& var = reinterpret_cast<triton::ast::VariableNode*>(n)->getSymbolicVariable();
+            vars[var->getId()] = var;
+          }
+        }
+
+        for (const auto& var : vars) {
+          stream << "(declare-fun " << (var.second->getAlias().empty() ? var.second->getName() : var.second->getAlias());
+          stream << " () (_ BitVec " << std::dec << var.second->getSize() << "))" << std::endl;
+        }
+
+        /* Define shared sub-expressions, children first */
+        for (auto* n : nodes) {
+          auto it = names.find(n);
+          if (it == names.end())
+            continue;
+
+          stream << "(define-fun node!" << std::dec << it->second << " () ";
+          if (n->isLogical())
+            stream << "Bool ";
+          else
+            stream << "(_ BitVec " << std::dec << n->getBitvectorSize() << ") ";
+          this->printBody(stream, n, names);
+          stream << ")" << std::endl;
+        }
+
+        if (assert_)
+          stream << "(assert ";
+        this->printBody(stream, root, names);
+        if (assert_)
+          stream << ")";
+
+        return stream;
+      }
+
     };
   };
 };
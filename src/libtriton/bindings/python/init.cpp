@@ -47,6 +47,11 @@ namespace triton {
         /* Init python */
         Py_Initialize();
 
+        /* Bindings release the GIL around long-running calls */
+        #if PY_VERSION_HEX < 0x03070000
+        PyEval_InitThreads();
+        #endif
+
         /* Create the triton module ================================================================== */
 
         triton::bindings::python::tritonModule = PyModule_Create(&tritonModuleDef);
@@ -35,6 +35,7 @@ to wrap more generic concepts.
 - \ref py_BitsVector_page
 - \ref py_Immediate_page
 - \ref py_Instruction_page
+- \ref py_JitFunction_page
 - \ref py_MemoryAccess_page
 - \ref py_PathConstraint_page
 - \ref py_Register_page
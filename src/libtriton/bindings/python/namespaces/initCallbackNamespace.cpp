@@ -26,11 +26,19 @@ The CALLBACK namespace contains all kinds of callbacks.
 
 ~~~~~~~~~~~~~{.py}
 >>> addCallback(CALLBACK.GET_CONCRETE_MEMORY_VALUE, your_function)
+
+# Only called for loads of [0x400000, 0x401000)
+>>> addCallback(CALLBACK.GET_CONCRETE_MEMORY_AREA_VALUE, your_function, 0x400000, 0x1000)
 ~~~~~~~~~~~~~
 
 \section CALLBACK_py_api Python API - Items of the CALLBACK namespace
 <hr>
 
+- **CALLBACK.GET_CONCRETE_MEMORY_AREA_VALUE**<br>
+The callback takes as arguments a \ref py_TritonContext_page, a base address and a size. Callbacks will be called once each time that
+the Triton library will need to LOAD a concrete memory area (a memory access, a byte or a whole area read by getConcreteMemoryAreaValue()).
+The callback must return nothing.
+
 - **CALLBACK.GET_CONCRETE_MEMORY_VALUE**<br>
 The callback takes as arguments a \ref py_TritonContext_page and a \ref py_MemoryAccess_page. Callbacks will be called each time that the
 Triton library will need to LOAD a concrete memory value. The callback must return nothing.
@@ -39,6 +47,10 @@ Triton library will need to LOAD a concrete memory value. The callback must retu
 The callback takes as arguments a \ref py_TritonContext_page and a \ref py_Register_page. Callbacks will be called each time that the
 Triton library will need to GET a concrete register value. The callback must return nothing.
 
+- **CALLBACK.SET_CONCRETE_MEMORY_AREA_VALUE**<br>
+The callback takes as arguments a \ref py_TritonContext_page, a base address and the new values as bytes. Callbacks will be called once
+each time that the Triton library will need to STORE a concrete memory area. The callback must return nothing.
+
 - **CALLBACK.SET_CONCRETE_MEMORY_VALUE**<br>
 The callback takes as arguments a \ref py_TritonContext_page, a \ref py_MemoryAccess_page and an integer. Callbacks will be called
 each time that the Triton library will need to STORE a concrete memory value. The callback must return nothing.
@@ -61,11 +73,13 @@ namespace triton {
     namespace python {
 
       void initCallbackNamespace(PyObject* callbackDict) {
-        xPyDict_SetItemString(callbackDict, "GET_CONCRETE_MEMORY_VALUE",   PyLong_FromUint32(triton::callbacks::GET_CONCRETE_MEMORY_VALUE));
-        xPyDict_SetItemString(callbackDict, "GET_CONCRETE_REGISTER_VALUE", PyLong_FromUint32(triton::callbacks::GET_CONCRETE_REGISTER_VALUE));
-        xPyDict_SetItemString(callbackDict, "SET_CONCRETE_MEMORY_VALUE",   PyLong_FromUint32(triton::callbacks::SET_CONCRETE_MEMORY_VALUE));
-        xPyDict_SetItemString(callbackDict, "SET_CONCRETE_REGISTER_VALUE", PyLong_FromUint32(triton::callbacks::SET_CONCRETE_REGISTER_VALUE));
-        xPyDict_SetItemString(callbackDict, "SYMBOLIC_SIMPLIFICATION",     PyLong_FromUint32(triton::callbacks::SYMBOLIC_SIMPLIFICATION));
+        xPyDict_SetItemString(callbackDict, "GET_CONCRETE_MEMORY_AREA_VALUE", PyLong_FromUint32(triton::callbacks::GET_CONCRETE_MEMORY_AREA_VALUE));
+        xPyDict_SetItemString(callbackDict, "GET_CONCRETE_MEMORY_VALUE",      PyLong_FromUint32(triton::callbacks::GET_CONCRETE_MEMORY_VALUE));
+        xPyDict_SetItemString(callbackDict, "GET_CONCRETE_REGISTER_VALUE",    PyLong_FromUint32(triton::callbacks::GET_CONCRETE_REGISTER_VALUE));
+        xPyDict_SetItemString(callbackDict, "SET_CONCRETE_MEMORY_AREA_VALUE", PyLong_FromUint32(triton::callbacks::SET_CONCRETE_MEMORY_AREA_VALUE));
+        xPyDict_SetItemString(callbackDict, "SET_CONCRETE_MEMORY_VALUE",      PyLong_FromUint32(triton::callbacks::SET_CONCRETE_MEMORY_VALUE));
+        xPyDict_SetItemString(callbackDict, "SET_CONCRETE_REGISTER_VALUE",    PyLong_FromUint32(triton::callbacks::SET_CONCRETE_REGISTER_VALUE));
+        xPyDict_SetItemString(callbackDict, "SYMBOLIC_SIMPLIFICATION",        PyLong_FromUint32(triton::callbacks::SYMBOLIC_SIMPLIFICATION));
       }
 
     }; /* python namespace */
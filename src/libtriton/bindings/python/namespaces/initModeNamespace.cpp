@@ -57,6 +57,11 @@ Enabled, Triton will symbolize the index of rotation for `bvror` and `bvrol` nod
 
 - **MODE.TAINT_THROUGH_POINTERS**<br>
 Enabled, the taint is spread if an index pointer is already tainted (see #725).
+
+- **MODE.TRIM_SYMBOLIC_EXPRESSIONS**<br>
+Enabled, Triton regularly forgets the ids of the symbolic expressions which are not reachable from the symbolic registers, memory
+and path constraints (see `TritonContext.trimSymbolicExpressions()`). These expressions are still valid but `getSymbolicExpression()`
+cannot find them anymore. This bounds the memory of the map of ids on long traces.
 */
 
 
@@ -75,6 +80,7 @@ namespace triton {
         xPyDict_SetItemString(modeDict, "PC_TRACKING_SYMBOLIC",           PyLong_FromUint32(triton::modes::PC_TRACKING_SYMBOLIC));
         xPyDict_SetItemString(modeDict, "SYMBOLIZE_INDEX_ROTATION",       PyLong_FromUint32(triton::modes::SYMBOLIZE_INDEX_ROTATION));
         xPyDict_SetItemString(modeDict, "TAINT_THROUGH_POINTERS",         PyLong_FromUint32(triton::modes::TAINT_THROUGH_POINTERS));
+        xPyDict_SetItemString(modeDict, "TRIM_SYMBOLIC_EXPRESSIONS",      PyLong_FromUint32(triton::modes::TRIM_SYMBOLIC_EXPRESSIONS));
       }
 
     }; /* python namespace */
@@ -20,7 +20,8 @@
 \section SYMBOLIC_py_description Description
 <hr>
 
-The SYMBOLIC namespace contains all types of symbolic expressions and variables.
+The SYMBOLIC namespace contains all types of symbolic expressions and variables, and the cost functions of the
+equality saturation (see saturate() in \ref py_TritonContext_page).
 
 \section SYMBOLIC_py_api Python API - Items of the SYMBOLIC namespace
 <hr>
@@ -29,6 +30,8 @@ The SYMBOLIC namespace contains all types of symbolic expressions and variables.
 - **SYMBOLIC.MEMORY_VARIABLE**
 - **SYMBOLIC.REGISTER_EXPRESSION**
 - **SYMBOLIC.REGISTER_VARIABLE**
+- **SYMBOLIC.SIZE_COST**
+- **SYMBOLIC.SOLVER_COST**
 - **SYMBOLIC.UNDEFINED_VARIABLE**
 - **SYMBOLIC.VOLATILE_EXPRESSION**
 
@@ -45,6 +48,8 @@ namespace triton {
         xPyDict_SetItemString(symbolicDict, "MEMORY_VARIABLE",       PyLong_FromUint32(triton::engines::symbolic::MEMORY_VARIABLE));
         xPyDict_SetItemString(symbolicDict, "REGISTER_EXPRESSION",   PyLong_FromUint32(triton::engines::symbolic::REGISTER_EXPRESSION));
         xPyDict_SetItemString(symbolicDict, "REGISTER_VARIABLE",     PyLong_FromUint32(triton::engines::symbolic::REGISTER_VARIABLE));
+        xPyDict_SetItemString(symbolicDict, "SIZE_COST",             PyLong_FromUint32(triton::engines::symbolic::SIZE_COST));
+        xPyDict_SetItemString(symbolicDict, "SOLVER_COST",           PyLong_FromUint32(triton::engines::symbolic::SOLVER_COST));
         xPyDict_SetItemString(symbolicDict, "UNDEFINED_VARIABLE",    PyLong_FromUint32(triton::engines::symbolic::UNDEFINED_VARIABLE));
         xPyDict_SetItemString(symbolicDict, "VOLATILE_EXPRESSION",   PyLong_FromUint32(triton::engines::symbolic::VOLATILE_EXPRESSION));
       }
@@ -18,6 +18,7 @@
 #endif
 
 #include <cstring>
+#include <sstream>
 
 
 
@@ -256,6 +257,12 @@ e.g: `((_ zero_extend sizeExt) node1)`.
 - <b>\ref py_AstNode_page duplicate(\ref py_AstNode_page node)</b><br>
 Duplicates the node and returns a new instance as \ref py_AstNode_page.
 
+- <b>string printHoisted(\ref py_AstNode_page node, integer limit=0)</b><br>
+Returns the representation of `node` where each sub-expression used several times (or nested too deeply) is hoisted
+into a temporary (`t0 = ...`, `(define-fun t0 () ...)` in SMT mode) printed once before the node. Unlike `str(node)`, the
+size of the output is linear in the size of the DAG. If `limit` is not zero, the output is truncated after `limit` characters
+and ends with `...`.
+
 - <b>[\ref py_AstNode_page, ...] search(\ref py_AstNode_page node, \ref py_AST_NODE_page match)</b><br>
 Returns a list of collected matched nodes via a depth-first pre order traversal.
 
@@ -263,7 +270,8 @@ Returns a list of collected matched nodes via a depth-first pre order traversal.
 Convert a Triton AST to a Z3 AST.
 
 - <b>\ref py_AstNode_page unroll(\ref py_AstNode_page node)</b><br>
-Unrolls the SSA form of a given AST.
+Unrolls the SSA form of a given AST. The unrolled ASTs of the referenced symbolic expressions are cached, so unrolling
+overlapping expressions again reuses them instead of copying them (they are shared between the returned ASTs).
 
 - <b>\ref py_AstNode_page z3ToTriton(z3::expr expr)</b><br>
 Convert a Z3 AST to a Triton AST.
@@ -1461,6 +1469,33 @@ namespace triton {
       }
 
 
+      static PyObject* AstContext_printHoisted(PyObject* self, PyObject* args) {
+        PyObject* node  = nullptr;
+        PyObject* limit = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &node, &limit) == false) {
+          return PyErr_Format(PyExc_TypeError, "printHoisted(): Invalid number of arguments");
+        }
+
+        if (node == nullptr || !PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "printHoisted(): expected a AstNode object as first argument");
+
+        if (limit != nullptr && (!PyLong_Check(limit) && !PyInt_Check(limit)))
+          return PyErr_Format(PyExc_TypeError, "printHoisted(): expected an integer as second argument");
+
+        try {
+          std::ostringstream stream;
+          triton::usize size = (limit != nullptr) ? PyLong_AsUsize(limit) : 0;
+          PyAstContext_AsAstContext(self)->printHoisted(stream, PyAstNode_AsAstNode(node).get(), size);
+          return xPyString_FromString(stream.str().c_str());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* AstContext_reference(PyObject* self, PyObject* symExpr) {
         if (!PySymbolicExpression_Check(symExpr))
           return PyErr_Format(PyExc_TypeError, "reference(): expected a symbolic expression as argument");
@@ -1702,6 +1737,7 @@ namespace triton {
         {"lnot",            AstContext_lnot,            METH_O,           ""},
         {"lor",             AstContext_lor,             METH_O,           ""},
         {"lxor",            AstContext_lxor,            METH_O,           ""},
+        {"printHoisted",    AstContext_printHoisted,    METH_VARARGS,     ""},
         {"reference",       AstContext_reference,       METH_O,           ""},
         {"search",          AstContext_search,          METH_VARARGS,     ""},
         {"string",          AstContext_string,          METH_O,           ""},
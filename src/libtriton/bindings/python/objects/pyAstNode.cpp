@@ -5,12 +5,16 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <unordered_map>
+
 #include <triton/pythonObjects.hpp>
 #include <triton/pythonUtils.hpp>
 #include <triton/pythonXFunctions.hpp>
 #include <triton/ast.hpp>
 #include <triton/astContext.hpp>
+#include <triton/batchEvaluator.hpp>
 #include <triton/exceptions.hpp>
+#include <triton/symbolicVariable.hpp>
 
 
 
@@ -51,12 +55,23 @@ This object is used to represent each AST node of an expression.
 \section AstNode_py_api Python API - Methods of the AstNode class
 <hr>
 
+- <b>\ref py_JitFunction_page compile(void)</b><br>
+Compiles the tree to native x86-64 code and returns a function which takes the values of the variables of the tree,
+sorted by id, and returns the value of the tree. Raises an exception if the platform is not x86-64 or if the tree
+has values larger than 64 bits.
+
 - <b>bool equalTo(\ref py_AstNode_page)</b><br>
 Compares the current tree to another one.
 
 - <b>integer evaluate(void)</b><br>
 Evaluates the tree and returns its value.
 
+- <b>[integer, ...] evaluateBatch(dict inputs)</b><br>
+Evaluates the tree on many assignments of its variables at once and returns the list of its values. `inputs` is a dictionary
+of {\ref py_SymbolicVariable_page or variable id : [integer, ...]}, all the lists have the same length. The variables which are
+not in `inputs` keep their current value. The tree is compiled once into a linear tape of instructions which is executed on
+blocks of assignments, the loops are vectorized when all the values fit in 64 bits.
+
 - <b>integer getBitvectorMask(void)</b><br>
 Returns the mask of the node vector according to its size.<br>
 e.g: `0xffffffff`
@@ -147,6 +162,16 @@ namespace triton {
       }
 
 
+      static PyObject* AstNode_compile(PyObject* self, PyObject* noarg) {
+        try {
+          return PyJitFunction(PyAstNode_AsAstNode(self));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* AstNode_equalTo(PyObject* self, PyObject* other) {
         try {
           if (other == nullptr || !PyAstNode_Check(other))
@@ -173,6 +198,105 @@ namespace triton {
       }
 
 
+      static PyObject* AstNode_evaluateBatch(PyObject* self, PyObject* inputs) {
+        if (inputs == nullptr || !PyDict_Check(inputs))
+          return PyErr_Format(PyExc_TypeError, "AstNode::evaluateBatch(): Expects a dictionary as argument.");
+
+        try {
+          triton::ast::SharedAbstractNode node = PyAstNode_AsAstNode(self);
+          triton::ast::BatchEvaluator evaluator(node);
+          std::unordered_map<triton::usize, PyObject*> columns;
+          Py_ssize_t count = -1;
+
+          PyObject* key   = nullptr;
+          PyObject* value = nullptr;
+          Py_ssize_t pos  = 0;
+
+          while (PyDict_Next(inputs, &pos, &key, &value)) {
+            triton::usize id = 0;
+
+            if (PySymbolicVariable_Check(key))
+              id = PySymbolicVariable_AsSymbolicVariable(key)->getId();
+            else if (PyLong_Check(key) || PyInt_Check(key))
+              id = PyLong_AsUsize(key);
+            else
+              return PyErr_Format(PyExc_TypeError, "AstNode::evaluateBatch(): Expects a dictionary of {SymbolicVariable or integer : [integer, ...]} as argument.");
+
+            if (!PyList_Check(value))
+              return PyErr_Format(PyExc_TypeError, "AstNode::evaluateBatch(): Expects a dictionary of {SymbolicVariable or integer : [integer, ...]} as argument.");
+
+            if (count >= 0 && PyList_Size(value) != count)
+              return PyErr_Format(PyExc_TypeError, "AstNode::evaluateBatch(): All lists must have the same length.");
+
+            for (Py_ssize_t i = 0; i < PyList_Size(value); i++) {
+              PyObject* item = PyList_GetItem(value, i);
+              if (!PyLong_Check(item) && !PyInt_Check(item))
+                return PyErr_Format(PyExc_TypeError, "AstNode::evaluateBatch(): Each item of the lists must be an integer.");
+            }
+
+            count = PyList_Size(value);
+            columns[id] = value;
+          }
+
+          /* Without any list, the tree is evaluated once */
+          if (count < 0)
+            count = 1;
+
+          const auto& variables = evaluator.getVariables();
+          PyObject* ret = xPyList_New(count);
+
+          if (evaluator.isVectorizable()) {
+            std::vector<std::vector<triton::uint64>> values(variables.size());
+            for (triton::usize v = 0; v < variables.size(); v++) {
+              auto it = columns.find(variables[v]->getId());
+              if (it == columns.end()) {
+                values[v].assign(count, node->getContext()->getVariableValue(variables[v]->getName()).convert_to<triton::uint64>());
+                continue;
+              }
+              for (Py_ssize_t i = 0; i < count; i++)
+                values[v].push_back(static_cast<triton::uint64>(PyLong_AsUint512(PyList_GetItem(it->second, i))));
+            }
+
+            std::vector<triton::uint64> results;
+            {
+              PyAllowThreads nogil;
+              results = evaluator.evaluate(values);
+            }
+
+            for (Py_ssize_t i = 0; i < count; i++)
+              PyList_SetItem(ret, i, PyLong_FromUint64(results[variables.empty() ? 0 : i]));
+          }
+
+          else {
+            std::vector<std::vector<triton::uint512>> values(variables.size());
+            for (triton::usize v = 0; v < variables.size(); v++) {
+              auto it = columns.find(variables[v]->getId());
+              if (it == columns.end()) {
+                values[v].assign(count, node->getContext()->getVariableValue(variables[v]->getName()));
+                continue;
+              }
+              for (Py_ssize_t i = 0; i < count; i++)
+                values[v].push_back(PyLong_AsUint512(PyList_GetItem(it->second, i)));
+            }
+
+            std::vector<triton::uint512> results;
+            {
+              PyAllowThreads nogil;
+              results = evaluator.evaluate(values);
+            }
+
+            for (Py_ssize_t i = 0; i < count; i++)
+              PyList_SetItem(ret, i, PyLong_FromUint512(results[variables.empty() ? 0 : i]));
+          }
+
+          return ret;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* AstNode_getBitvectorMask(PyObject* self, PyObject* noarg) {
         try {
           return PyLong_FromUint512(PyAstNode_AsAstNode(self)->getBitvectorMask());
@@ -812,8 +936,10 @@ namespace triton {
 
       //! AstNode methods.
       PyMethodDef AstNode_callbacks[] = {
+        {"compile",                 AstNode_compile,                METH_NOARGS,     ""},
         {"equalTo",                 AstNode_equalTo,                METH_O,          ""},
         {"evaluate",                AstNode_evaluate,               METH_NOARGS,     ""},
+        {"evaluateBatch",           AstNode_evaluateBatch,          METH_O,          ""},
         {"getBitvectorMask",        AstNode_getBitvectorMask,       METH_NOARGS,     ""},
         {"getBitvectorSize",        AstNode_getBitvectorSize,       METH_NOARGS,     ""},
         {"getChildren",             AstNode_getChildren,            METH_NOARGS,     ""},
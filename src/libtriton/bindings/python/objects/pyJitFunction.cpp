@@ -0,0 +1,211 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <triton/pythonObjects.hpp>
+#include <triton/pythonUtils.hpp>
+#include <triton/pythonXFunctions.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/jitEvaluator.hpp>
+
+
+
+/*! \page py_JitFunction_page JitFunction
+    \brief [**python api**] All information about the JitFunction Python object.
+
+\tableofcontents
+
+\section py_JitFunction_description Description
+<hr>
+
+This object is an AST compiled to native x86-64 code, see \ref py_AstNode_page `compile()`. It is called with the
+values of the variables of the AST, sorted by id, and returns the value of the AST. Only available on x86-64 and for
+ASTs whose values fit in 64 bits.
+
+~~~~~~~~~~~~~{.py}
+>>> from triton import TritonContext, ARCH
+
+>>> ctxt = TritonContext(ARCH.X86_64)
+>>> astCtxt = ctxt.getAstContext()
+>>> x = ctxt.newSymbolicVariable(32)
+>>> y = ctxt.newSymbolicVariable(32)
+>>> node = astCtxt.bvadd(astCtxt.bvxor(astCtxt.variable(x), astCtxt.variable(y)), astCtxt.bv(1, 32))
+
+>>> f = node.compile()
+>>> hex(f(0x1234, 0xff00))
+'0xed35'
+>>> [str(v) for v in f.getVariables()]
+['SymVar_0:32', 'SymVar_1:32']
+
+~~~~~~~~~~~~~
+
+\section JitFunction_py_api Python API - Methods of the JitFunction class
+<hr>
+
+- <b>integer getCodeSize(void)</b><br>
+Returns the size of the machine code.
+
+- <b>[\ref py_SymbolicVariable_page, ...] getVariables(void)</b><br>
+Returns the variables of the AST, sorted by id. They are the arguments of the function.
+
+*/
+
+
+
+namespace triton {
+  namespace bindings {
+    namespace python {
+
+      //! JitFunction destructor.
+      void JitFunction_dealloc(PyObject* self) {
+        std::cout << std::flush;
+        delete PyJitFunction_AsJitEvaluator(self);
+        Py_TYPE(self)->tp_free((PyObject*)self);
+      }
+
+
+      static PyObject* JitFunction_call(PyObject* self, PyObject* args, PyObject* kwargs) {
+        triton::ast::JitEvaluator* jit = PyJitFunction_AsJitEvaluator(self);
+        std::vector<triton::uint64> inputs;
+
+        if (kwargs != nullptr && PyDict_Size(kwargs) != 0)
+          return PyErr_Format(PyExc_TypeError, "JitFunction::__call__(): Does not take keyword arguments.");
+
+        if (static_cast<triton::usize>(PyTuple_Size(args)) != jit->getVariables().size())
+          return PyErr_Format(PyExc_TypeError, "JitFunction::__call__(): Expects %d arguments.", static_cast<int>(jit->getVariables().size()));
+
+        try {
+          for (Py_ssize_t i = 0; i < PyTuple_Size(args); i++) {
+            PyObject* value = PyTuple_GetItem(args, i);
+            if (!PyLong_Check(value) && !PyInt_Check(value))
+              return PyErr_Format(PyExc_TypeError, "JitFunction::__call__(): Expects integers as arguments.");
+            inputs.push_back(static_cast<triton::uint64>(PyLong_AsUint512(value)));
+          }
+
+          return PyLong_FromUint64(jit->getFunction()(inputs.data()));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* JitFunction_getCodeSize(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyJitFunction_AsJitEvaluator(self)->getCodeSize());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* JitFunction_getVariables(PyObject* self, PyObject* noarg) {
+        try {
+          const auto& variables = PyJitFunction_AsJitEvaluator(self)->getVariables();
+          PyObject* ret = xPyList_New(variables.size());
+
+          for (triton::usize index = 0; index < variables.size(); index++)
+            PyList_SetItem(ret, index, PySymbolicVariable(variables[index]));
+
+          return ret;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      //! JitFunction methods.
+      PyMethodDef JitFunction_callbacks[] = {
+        {"getCodeSize",   JitFunction_getCodeSize,   METH_NOARGS,    ""},
+        {"getVariables",  JitFunction_getVariables,  METH_NOARGS,    ""},
+        {nullptr,         nullptr,                   0,              nullptr}
+      };
+
+
+      PyTypeObject JitFunction_Type = {
+        PyVarObject_HEAD_INIT(&PyType_Type, 0)
+        "JitFunction",                              /* tp_name */
+        sizeof(JitFunction_Object),                 /* tp_basicsize */
+        0,                                          /* tp_itemsize */
+        (destructor)JitFunction_dealloc,            /* tp_dealloc */
+        #if IS_PY3_8
+        0,                                          /* tp_vectorcall_offset */
+        #else
+        0,                                          /* tp_print */
+        #endif
+        0,                                          /* tp_getattr */
+        0,                                          /* tp_setattr */
+        0,                                          /* tp_compare */
+        0,                                          /* tp_repr */
+        0,                                          /* tp_as_number */
+        0,                                          /* tp_as_sequence */
+        0,                                          /* tp_as_mapping */
+        0,                                          /* tp_hash */
+        (ternaryfunc)JitFunction_call,              /* tp_call */
+        0,                                          /* tp_str */
+        0,                                          /* tp_getattro */
+        0,                                          /* tp_setattro */
+        0,                                          /* tp_as_buffer */
+        Py_TPFLAGS_DEFAULT,                         /* tp_flags */
+        "JitFunction objects",                      /* tp_doc */
+        0,                                          /* tp_traverse */
+        0,                                          /* tp_clear */
+        0,                                          /* tp_richcompare */
+        0,                                          /* tp_weaklistoffset */
+        0,                                          /* tp_iter */
+        0,                                          /* tp_iternext */
+        JitFunction_callbacks,                      /* tp_methods */
+        0,                                          /* tp_members */
+        0,                                          /* tp_getset */
+        0,                                          /* tp_base */
+        0,                                          /* tp_dict */
+        0,                                          /* tp_descr_get */
+        0,                                          /* tp_descr_set */
+        0,                                          /* tp_dictoffset */
+        0,                                          /* tp_init */
+        0,                                          /* tp_alloc */
+        0,                                          /* tp_new */
+        0,                                          /* tp_free */
+        0,                                          /* tp_is_gc */
+        0,                                          /* tp_bases */
+        0,                                          /* tp_mro */
+        0,                                          /* tp_cache */
+        0,                                          /* tp_subclasses */
+        0,                                          /* tp_weaklist */
+        0,                                          /* tp_del */
+        #if IS_PY3
+        0,                                          /* tp_version_tag */
+        0,                                          /* tp_finalize */
+        #if IS_PY3_8
+        0,                                          /* tp_vectorcall */
+        0,                                          /* bpo-37250: kept for backwards compatibility in CPython 3.8 only */
+        #endif
+        #else
+        0                                           /* tp_version_tag */
+        #endif
+      };
+
+
+      PyObject* PyJitFunction(const triton::ast::SharedAbstractNode& node) {
+        JitFunction_Object* object;
+        triton::ast::JitEvaluator* jit = new triton::ast::JitEvaluator(node);
+
+        PyType_Ready(&JitFunction_Type);
+        object = PyObject_NEW(JitFunction_Object, &JitFunction_Type);
+        if (object == NULL) {
+          delete jit;
+          return nullptr;
+        }
+
+        object->jit = jit;
+        return (PyObject*)object;
+      }
+
+    }; /* python namespace */
+  }; /* bindings namespace */
+}; /* triton namespace */
@@ -86,6 +86,9 @@ Returns the AST root node of the symbolic expression.
 - <b>string getComment(void)</b><br>
 Returns the comment (if exists) of the symbolic expression.
 
+- <b>[\ref py_SymbolicExpression_page, ...] getDependencies(void)</b><br>
+Returns the symbolic expressions directly referenced by the AST, sorted by id. They are computed once, until the AST is changed.
+
 - <b>integer getId(void)</b><br>
 Returns the id of the symbolic expression. This id is always unique.<br>
 e.g: `2387`
@@ -156,6 +159,22 @@ namespace triton {
       }
 
 
+      static PyObject* SymbolicExpression_getDependencies(PyObject* self, PyObject* noarg) {
+        try {
+          const auto& dependencies = PySymbolicExpression_AsSymbolicExpression(self)->getDependencies();
+          PyObject* ret = xPyList_New(dependencies.size());
+
+          for (triton::usize index = 0; index < dependencies.size(); index++)
+            PyList_SetItem(ret, index, PySymbolicExpression(dependencies[index]));
+
+          return ret;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* SymbolicExpression_getId(PyObject* self, PyObject* noarg) {
         try {
           return PyLong_FromUsize(PySymbolicExpression_AsSymbolicExpression(self)->getId());
@@ -313,6 +332,7 @@ namespace triton {
       PyMethodDef SymbolicExpression_callbacks[] = {
         {"getAst",            SymbolicExpression_getAst,            METH_NOARGS,    ""},
         {"getComment",        SymbolicExpression_getComment,        METH_NOARGS,    ""},
+        {"getDependencies",   SymbolicExpression_getDependencies,   METH_NOARGS,    ""},
         {"getId",             SymbolicExpression_getId,             METH_NOARGS,    ""},
         {"getNewAst",         SymbolicExpression_getNewAst,         METH_NOARGS,    ""},
         {"getOrigin",         SymbolicExpression_getOrigin,         METH_NOARGS,    ""},
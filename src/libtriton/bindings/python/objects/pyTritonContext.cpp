@@ -11,8 +11,11 @@
 #include <triton/api.hpp>
 #include <triton/arm32Cpu.hpp>
 #include <triton/exceptions.hpp>
+#include <triton/executionTrace.hpp>
 #include <triton/register.hpp>
 
+#include <fstream>
+
 
 
 /*! \page py_TritonContext_page TritonContext
@@ -34,13 +37,27 @@ libTriton offers Python bindings on top of its C++ API which allow you to build
 
 ~~~~~~~~~~~~~
 
+Long-running methods (`buildSemantics()`, `evaluateAstViaZ3()`, `getModel()`, `getModels()`, `isSat()`, `processing()`,
+`run()`, `simplify()` and `sliceExpressions()`) release the GIL, so several contexts can be used from several Python threads.
+Callbacks and hooks re-acquire the GIL when they are fired. A same context must not be used from several threads at the same time.
+
 \section tritonContext_py_api Python API - Methods of the TritonContext class
 <hr>
 
 \subsection TritonContext_py_api_methods Methods
 
-- <b>void addCallback(\ref py_CALLBACK_page kind, function cb)</b><br>
-Adds a callback at specific internal points. Your callback will be called each time the point is reached.
+- <b>void addCallback(\ref py_CALLBACK_page kind, function cb, integer baseAddr=0, integer size=0)</b><br>
+Adds a callback at specific internal points. Your callback will be called each time the point is reached. Memory callbacks
+may watch a range of addresses: they are only called for accesses to [`baseAddr`, `baseAddr+size`). A size of 0 watches the
+whole memory.
+
+- <b>void addSaturationRule(string rules)</b><br>
+Adds rules to the equality saturation (see saturate()). The rules are written like the ones of addSimplificationRule().
+A default set of rules is recorded.
+
+- <b>void addSimplificationRule(string rules)</b><br>
+Adds simplification rules such as `(bvxor x x) -> 0`. Rules are applied by a native rewrite engine before the simplification
+callbacks, see \ref SMT_simplification_page.
 
 - <b>void assignSymbolicExpressionToMemory(\ref py_SymbolicExpression_page symExpr, \ref py_MemoryAccess_page mem)</b><br>
 Assigns a \ref py_SymbolicExpression_page to a \ref py_MemoryAccess_page area. **Be careful**, use this function only if you know what you are doing.
@@ -53,9 +70,16 @@ The symbolic expression (`symExpr`) must be aligned to the targeted size registe
 - <b>bool buildSemantics(\ref py_Instruction_page inst)</b><br>
 Builds the instruction semantics. Returns true if the instruction is supported. You must define an architecture before.
 
+- <b>integer checkpoint(void)</b><br>
+Starts recording the changes of the concrete, symbolic and taint states into an undo journal (if not already) and returns a checkpoint id.
+See also rollback().
+
 - <b>void clearCallbacks(void)</b><br>
 Clears recorded callbacks.
 
+- <b>void clearCheckpoints(void)</b><br>
+Discards all checkpoints and stops recording changes.
+
 - <b>void clearModes(void)</b><br>
 Clears recorded modes.
 
@@ -68,6 +92,16 @@ Clears concrete values assigned to the memory cells from `addr` to `addr + size`
 - <b>void clearPathConstraints(void)</b><br>
 Clears the current path predicate.
 
+- <b>void clearSaturationRules(void)</b><br>
+Removes all rules of the equality saturation, including the default ones.
+
+- <b>void clearSimplificationRules(void)</b><br>
+Removes all simplification rules.
+
+- <b>integer compactSymbolicExpressions(void)</b><br>
+Removes the symbolic expressions which do not exist anymore from the map of ids and returns their number. This is also done
+automatically when the map has doubled since the last compaction.
+
 - <b>void concretizeAllMemory(void)</b><br>
 Concretizes all symbolic memory references.
 
@@ -92,6 +126,12 @@ Returns the new symbolic register expression and links this expression to the in
 - <b>\ref py_SymbolicExpression_page createSymbolicVolatileExpression (\ref py_Instruction_page inst, \ref py_AstNode_page node, string comment)</b><br>
 Returns the new symbolic volatile expression and links this expression to the instruction.
 
+- <b>tuple deserializeSymbolic(bytes data, bool reuseVariables=False)</b><br>
+Loads a buffer written by serializeSymbolic() and returns a tuple of its lists of \ref py_AstNode_page, \ref py_SymbolicExpression_page
+and \ref py_PathConstraint_page. Symbolic expressions are added to the symbolic engine and symbolic variables are created with their
+saved values. If `reuseVariables` is true, a symbolic variable which already exists with the same name (or alias if any) and size is
+reused instead, and keeps its current value.
+
 - <b>void disassembly(\ref py_Instruction_page inst)</b><br>
 Disassembles the instruction and sets up operands. You must define an architecture before.
 
@@ -119,6 +159,10 @@ Returns the current AST representation mode.
 - <b>bytes getConcreteMemoryAreaValue(integer baseAddr, integer size)</b><br>
 Returns the concrete value of a memory area.
 
+- <b>void getConcreteMemoryAreaValue(integer baseAddr, buffer out)</b><br>
+Copies the concrete value of a memory area into a writable buffer (e.g. `bytearray`, `memoryview`, `mmap`, numpy array). The size of the area
+is the size of the buffer.
+
 - <b>integer getConcreteMemoryValue(integer addr)</b><br>
 Returns the concrete value of a memory cell.
 
@@ -140,6 +184,9 @@ Returns the size in bytes of the General Purpose Registers.
 - <b>\ref py_AstNode_page getImmediateAst(\ref py_Immediate_page imm)</b><br>
 Returns the AST corresponding to the \ref py_Immediate_page.
 
+- <b>dict getMappedConcreteMemoryAreas(void)</b><br>
+Returns the areas mapped with mapConcreteMemoryArea() as a dictionary of {integer baseAddr : integer size}.
+
 - <b>\ref py_AstNode_page getMemoryAst(\ref py_MemoryAccess_page mem)</b><br>
 Returns the AST corresponding to the \ref py_MemoryAccess_page with the SSA form.
 
@@ -154,6 +201,12 @@ If status is True, returns a tuple of ([dict, ...], \ref py_SOLVER_page status).
 - <b>\ref py_Register_page getParentRegister(\ref py_Register_page reg)</b><br>
 Returns the parent \ref py_Register_page from a \ref py_Register_page.
 
+- <b>integer getNumberOfCheckpoints(void)</b><br>
+Returns the number of checkpoints.
+
+- <b>integer getNumberOfSnapshots(void)</b><br>
+Returns the number of snapshots.
+
 - <b>[\ref py_Register_page, ...] getParentRegisters(void)</b><br>
 Returns the list of parent registers. Each item of this list is a \ref py_Register_page.
 
@@ -178,6 +231,12 @@ Returns the \ref py_Register_page class corresponding to a string.
 - <b>\ref py_AstNode_page getRegisterAst(\ref py_Register_page reg)</b><br>
 Returns the AST corresponding to the \ref py_Register_page with the SSA form.
 
+- <b>[string, ...] getSaturationRules(void)</b><br>
+Returns the rules of the equality saturation in the order they were added.
+
+- <b>[string, ...] getSimplificationRules(void)</b><br>
+Returns the simplification rules in the order they were added.
+
 - <b>\ref py_SymbolicExpression_page getSymbolicExpression(integer symExprId)</b><br>
 Returns the symbolic expression corresponding to an id.
 
@@ -223,6 +282,10 @@ Returns the list of all tainted registers.
 - <b>[\ref py_SymbolicExpression_page, ...] getTaintedSymbolicExpressions(void)</b><br>
 Returns the list of all tainted symbolic expressions.
 
+- <b>[integer, ...] getTraceSyncPoints(string path)</b><br>
+Returns the offsets of the sync records (register snapshots) of an execution trace. Each chunk of the trace between
+two sync points may be replayed independently with replayTrace().
+
 - <b>bool isArchitectureValid(void)</b><br>
 Returns true if the architecture is valid.
 
@@ -265,6 +328,9 @@ Returns true if the register is valid.
 - <b>bool isSat(\ref py_AstNode_page node)</b><br>
 Returns true if an expression is satisfiable.
 
+- <b>bool isSnapshot(integer id)</b><br>
+Returns true if the snapshot id exists.
+
 - <b>bool isSymbolicEngineEnabled(void)</b><br>
 Returns true if the symbolic execution engine is enabled.
 
@@ -277,6 +343,20 @@ Returns true if the taint engine is enabled.
 - <b>bool isThumb(void)</b><br>
 Returns true if execution mode is Thumb (only valid for ARM32).
 
+- <b>void loadSynthesisOracles(string path)</b><br>
+Loads the oracle table of synthesize() from a file written by saveSynthesisOracles(), which avoids its enumeration.
+
+- <b>void mapConcreteMemoryArea(integer baseAddr, buffer area)</b><br>
+Maps an object supporting the buffer protocol (e.g. `bytes`, `memoryview`, `mmap`, numpy array) as concrete memory at `baseAddr`
+without copying it. The buffer is requested read-only, so immutable objects are accepted, and is read in place. It is never modified,
+even if it is writable: writes to the area go to a copy-on-write overlay (journaled as whole ranges by checkpoints). A reference
+to the buffer is kept while it is mapped (snapshots included). The area must not overlap another mapped area.
+
+- <b>void mapConcreteMemoryFile(integer baseAddr, string path, integer offset=0, integer size=0)</b><br>
+Maps `size` bytes of the file `path` from `offset` as concrete memory at `baseAddr`. The file is mapped read-only (`mmap`) and is
+never modified: writes to the area go to a copy-on-write overlay. If `size` is 0, the file is mapped up to its end. The area is
+unmapped with unmapConcreteMemoryArea().
+
 - <b>\ref py_SymbolicExpression_page newSymbolicExpression(\ref py_AstNode_page node, string comment)</b><br>
 Returns a new symbolic expression. Note that if there are simplification passes recorded, simplifications will be applied.
 
@@ -289,6 +369,11 @@ Pops the last constraints added to the path predicate.
 - <b>void printSlicedExpressions(\ref py_SymbolicExpression_page expr, bool assert_=False)</b><br>
 Prints symbolic expression with used references and symbolic variables in AST representation mode. If `assert_` is true, then (assert <expr>).
 
+- <b>string printSmtDag(\ref py_AstNode_page node, bool assert_=False, string path="")</b><br>
+Returns a SMT2 script of `node` where symbolic variables are declared and each shared sub-expression is defined once
+as `(define-fun node!N ...)`. References are unrolled. If `assert_` is true, then (assert <node>). If `path` is given,
+the script is written into this file instead and None is returned.
+
 - <b>bool processing(\ref py_Instruction_page inst)</b><br>
 Processes an instruction and updates engines according to the instruction semantics. Returns true if the instruction is supported. You must define an architecture before.
 
@@ -296,11 +381,51 @@ Processes an instruction and updates engines according to the instruction semant
 Pushs constraints to the current path predicate.
 
 - <b>void removeCallback(\ref py_CALLBACK_page kind, function cb)</b><br>
-Removes a recorded callback.
+Removes a recorded callback (all its watched ranges).
+
+- <b>void removeSnapshot(integer id)</b><br>
+Removes a snapshot.
+
+- <b>integer replayTrace(string path, integer begin=0, integer end=0)</b><br>
+Replays an execution trace recorded by the pintool (`-trace` option) and returns the number of processed instructions.
+Registers are set from the sync records and the bytes read by each instruction are set in the concrete memory before
+the instruction is processed. Only the concrete state is updated: symbolic expressions are kept, and a register is
+concretized at a sync record only if its symbolic value differs from the recorded one. Only the records between the offsets `begin` and `end` are replayed (0 means the first
+record and the end of the trace). `begin` should be a sync point (see getTraceSyncPoints()).
 
 - <b>void reset(void)</b><br>
 Resets everything.
 
+- <b>void restoreSnapshot(integer id)</b><br>
+Restores the concrete, symbolic and taint states of a snapshot. The snapshot remains valid and can be restored again.
+
+- <b>void rollback(integer checkpoint)</b><br>
+Reverts all changes made since the checkpoint. The cost is proportional to the number of changes. The checkpoint remains
+valid and the next ones are discarded. Reverted changes include the concrete values, the mapped and unmapped areas, the symbolic
+references and variable values, and the taint. In-place changes of a symbolic expression (e.g. `setAst()`) are not reverted.
+
+- <b>integer run(integer pc, integer maxInsts=0, list stopAddrs=[], dict hooks={})</b><br>
+Runs the program from `pc` and returns the address where the execution stopped. Opcodes are fetched from the concrete memory and
+the next address is read from the program counter after each instruction, without going back to Python. The execution stops before
+an address of `stopAddrs`, after `maxInsts` instructions (0 means no limit) or on an unsupported instruction (its address is returned).
+`hooks` is a dictionary of {integer address : callable}: before the instruction at `address` is processed, the callable is called
+as `hook(ctx, address)`. It may change the program counter to redirect the execution and returns True to stop it. A redirection
+counts as one instruction against `maxInsts`: without a limit, hooks which keep redirecting the execution to each other never return.
+Opcodes are fetched without calling the memory callbacks.
+
+- <b>\ref py_AstNode_page saturate(\ref py_AstNode_page node, integer nodeLimit=10000, integer timeLimit=1000, \ref py_SYMBOLIC_page cost=SYMBOLIC.SIZE_COST)</b><br>
+Simplifies a node by equality saturation and returns the cheapest equivalent node. The saturation rules are applied in an e-graph
+until nothing changes, until the e-graph has `nodeLimit` nodes or after `timeLimit` milliseconds (0 means unlimited, but not for both). The cost
+is either SYMBOLIC.SIZE_COST (number of nodes) or SYMBOLIC.SOLVER_COST (favors linear operators). References are not unrolled.
+
+- <b>void saveSynthesisOracles(string path)</b><br>
+Saves the oracle table of synthesize() to a file. The table is enumerated first if needed.
+
+- <b>bytes serializeSymbolic(list nodes=[], list exprs=[], list pcs=[])</b><br>
+Returns a compact binary representation of a list of \ref py_AstNode_page, a list of \ref py_SymbolicExpression_page and a list of
+\ref py_PathConstraint_page with all the symbolic expressions and variables they depend on. Shared nodes are written once. The buffer
+can be loaded back by deserializeSymbolic() in a context with the same architecture.
+
 - <b>void setArchitecture(\ref py_ARCH_page arch)</b><br>
 Initializes an architecture. This function must be called before any call to the rest of the API.
 
@@ -311,8 +436,9 @@ Sets the AST representation mode.
 Sets the concrete value of a memory area. Note that setting a concrete value will probably imply a desynchronization with
 the symbolic state (if it exists). You should probably use the concretize functions after this.
 
-- <b>void setConcreteMemoryAreaValue(integer baseAddr, bytes opcodes)</b><br>
-Sets the concrete value of a memory area. Note that setting a concrete value will probably imply a desynchronization with
+- <b>void setConcreteMemoryAreaValue(integer baseAddr, buffer values)</b><br>
+Sets the concrete value of a memory area from an object supporting the buffer protocol (e.g. `bytes`, `bytearray`, `memoryview`, `mmap`,
+numpy array). Note that setting a concrete value will probably imply a desynchronization with
 the symbolic state (if it exists). You should probably use the concretize functions after this.
 
 - <b>void setConcreteMemoryValue(integer addr, integer value)</b><br>
@@ -352,8 +478,18 @@ Sets CPU state to Thumb mode (only valid for ARM32).
 Calls all simplification callbacks recorded and returns a new simplified node. If the `z3` flag is
 set to True, Triton will use z3 to simplify the given `node` before calling its recorded callbacks.
 
+- <b>\ref py_AstNode_page simplifyMba(\ref py_AstNode_page node)</b><br>
+Simplifies the linear mixed boolean-arithmetic subexpressions of `node` (sums of bitwise expressions multiplied by constants)
+over at most 4 atoms and returns a new node. References are not unrolled.
+
 - <b>dict sliceExpressions(\ref py_SymbolicExpression_page expr)</b><br>
 Slices expressions from a given one (backward slicing) and returns all symbolic expressions as a dictionary of {integer SymExprId : \ref py_SymbolicExpression_page expr}.
+The slice is a walk over the dependencies of the expressions (see \ref py_SymbolicExpression_page `getDependencies()`), which are
+computed once per expression.
+
+- <b>dict sliceExpressions([\ref py_SymbolicExpression_page, ...] exprs)</b><br>
+Returns the union of the slices of several expressions. Each expression is visited once, which is cheaper than slicing the
+targets one by one.
 
 - <b>\ref py_SymbolicVariable_page symbolizeExpression(integer symExprId, integer symVarSize, string symVarAlias)</b><br>
 Converts a symbolic expression to a symbolic variable. `symVarSize` must be in bits. This function returns the new symbolic variable created.
@@ -364,6 +500,17 @@ Converts a symbolic memory expression to a symbolic variable. This function retu
 - <b>\ref py_SymbolicVariable_page symbolizeRegister(\ref py_Register_page reg, string symVarAlias)</b><br>
 Converts a symbolic register expression to a symbolic variable. This function returns the new symbolic variable created.
 
+- <b>\ref py_AstNode_page synthesize(\ref py_AstNode_page node, bool constant=True)</b><br>
+Replaces the subexpressions of at most three variables by smaller equivalent ones. Each subexpression, from the root, is evaluated
+on sample points and the smaller expressions of the same outputs in an oracle table (enumerated on first use, up to 3 operations
+over `+ - * & | ^ ~` and negation) are proven equivalent by the solver. If `constant` is True, `x op c` is also tried for the
+subexpressions of one variable. References are not unrolled.
+
+- <b>integer takeSnapshot(void)</b><br>
+Takes a snapshot of the concrete, symbolic and taint states and returns its id. Memories and expressions are copy-on-write,
+thus taking and restoring snapshots is cheap. The symbolic expressions themselves are shared: changing an existing expression in
+place (e.g. with SymbolicExpression.setAst() or setComment()) is not reverted by restoreSnapshot().
+
 - <b>bool taintAssignment(\ref py_MemoryAccess_page memDst, \ref py_Immediate_page immSrc)</b><br>
 Taints `memDst` from `immSrc` with an assignment - `memDst` is untained. Returns true if the `memDst` is still tainted.
 
@@ -417,6 +564,14 @@ tainted. Returns true if `regDst` is tainted.
 Taints `regDst` from `regSrc` with an union - `regDst` is tainted if `regDst` or `regSrc` are
 tainted. Returns true if `regDst` is tainted.
 
+- <b>integer trimSymbolicExpressions(void)</b><br>
+Removes the symbolic expressions which are not reachable from the symbolic registers, the symbolic memory and the path constraints
+from the map of ids and returns their number. The removed expressions remain valid while they are referenced. With
+`MODE.TRIM_SYMBOLIC_EXPRESSIONS`, this is done between the instructions when the map has doubled since the last trim.
+
+- <b>void unmapConcreteMemoryArea(integer baseAddr)</b><br>
+Unmaps the area mapped at `baseAddr`. Its concrete values become undefined.
+
 - <b>bool untaintMemory(integer addr)</b><br>
 Untaints an address. Returns true if the address is still tainted.
 
@@ -460,9 +615,13 @@ namespace triton {
         PyObject* mode     = nullptr;
         PyObject* cb       = nullptr;
         PyObject* cb_self  = nullptr;
+        PyObject* baseAddr = nullptr;
+        PyObject* size     = nullptr;
+        triton::uint64 cbaseAddr = 0;
+        triton::usize csize      = 0;
 
         /* Extract arguments */
-        if (PyArg_ParseTuple(args, "|OO", &mode, &function) == false) {
+        if (PyArg_ParseTuple(args, "|OOOO", &mode, &function, &baseAddr, &size) == false) {
           return PyErr_Format(PyExc_TypeError, "TritonContext::addCallback(): Invalid number of arguments");
         }
 
@@ -472,6 +631,29 @@ namespace triton {
         if (function == nullptr || !PyCallable_Check(function))
           return PyErr_Format(PyExc_TypeError, "TritonContext::addCallback(): Expects a function as second argument.");
 
+        if (baseAddr != nullptr && !PyLong_Check(baseAddr) && !PyInt_Check(baseAddr))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::addCallback(): Expects an integer as third argument.");
+
+        if (size != nullptr && !PyLong_Check(size) && !PyInt_Check(size))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::addCallback(): Expects an integer as fourth argument.");
+
+        if (baseAddr != nullptr)
+          cbaseAddr = PyLong_AsUint64(baseAddr);
+
+        if (size != nullptr)
+          csize = PyLong_AsUsize(size);
+
+        switch (static_cast<triton::callbacks::callback_e>(PyLong_AsUint32(mode))) {
+          case callbacks::GET_CONCRETE_REGISTER_VALUE:
+          case callbacks::SET_CONCRETE_REGISTER_VALUE:
+          case callbacks::SYMBOLIC_SIMPLIFICATION:
+            if (baseAddr != nullptr || size != nullptr)
+              return PyErr_Format(PyExc_TypeError, "TritonContext::addCallback(): Only memory callbacks may watch a range of addresses.");
+            break;
+          default:
+            break;
+        }
+
         if (PyMethod_Check(function)) {
           cb_self = PyMethod_GET_SELF(function);
           cb = PyMethod_GET_FUNCTION(function);
@@ -486,6 +668,7 @@ namespace triton {
             case callbacks::GET_CONCRETE_MEMORY_VALUE:
               PyTritonContext_AsTritonContext(self)->addCallback(callbacks::GET_CONCRETE_MEMORY_VALUE, callbacks::getConcreteMemoryValueCallback([cb_self, cb](triton::API& api, const triton::arch::MemoryAccess& mem) {
                 /********* Lambda *********/
+                triton::bindings::python::PyGilEnsure gil;
                 PyObject* args = nullptr;
 
                 /* Create function args */
@@ -513,12 +696,49 @@ namespace triton {
 
                 Py_DECREF(args);
                 /********* End of lambda *********/
-              }, cb));
+              }, cb), cbaseAddr, csize);
+              break;
+
+            case callbacks::GET_CONCRETE_MEMORY_AREA_VALUE:
+              PyTritonContext_AsTritonContext(self)->addCallback(callbacks::GET_CONCRETE_MEMORY_AREA_VALUE, callbacks::getConcreteMemoryAreaValueCallback([cb_self, cb](triton::API& api, triton::uint64 baseAddr, triton::usize size) {
+                /********* Lambda *********/
+                triton::bindings::python::PyGilEnsure gil;
+                PyObject* args = nullptr;
+
+                /* Create function args */
+                if (cb_self) {
+                  args = triton::bindings::python::xPyTuple_New(4);
+                  PyTuple_SetItem(args, 0, cb_self);
+                  PyTuple_SetItem(args, 1, triton::bindings::python::PyTritonContextRef(api));
+                  PyTuple_SetItem(args, 2, triton::bindings::python::PyLong_FromUint64(baseAddr));
+                  PyTuple_SetItem(args, 3, triton::bindings::python::PyLong_FromUsize(size));
+                  Py_INCREF(cb_self);
+                }
+                else {
+                  args = triton::bindings::python::xPyTuple_New(3);
+                  PyTuple_SetItem(args, 0, triton::bindings::python::PyTritonContextRef(api));
+                  PyTuple_SetItem(args, 1, triton::bindings::python::PyLong_FromUint64(baseAddr));
+                  PyTuple_SetItem(args, 2, triton::bindings::python::PyLong_FromUsize(size));
+                }
+
+                /* Call the callback */
+                Py_INCREF(cb);
+                PyObject* ret = PyObject_CallObject(cb, args);
+
+                /* Check the call */
+                if (ret == nullptr) {
+                  throw triton::exceptions::PyCallbacks();
+                }
+
+                Py_DECREF(args);
+                /********* End of lambda *********/
+              }, cb), cbaseAddr, csize);
               break;
 
             case callbacks::GET_CONCRETE_REGISTER_VALUE:
               PyTritonContext_AsTritonContext(self)->addCallback(callbacks::GET_CONCRETE_REGISTER_VALUE, callbacks::getConcreteRegisterValueCallback([cb_self, cb](triton::API& api, const triton::arch::Register& reg){
                 /********* Lambda *********/
+                triton::bindings::python::PyGilEnsure gil;
                 PyObject* args = nullptr;
 
                 /* Create function args */
@@ -552,6 +772,7 @@ namespace triton {
             case callbacks::SET_CONCRETE_MEMORY_VALUE:
               PyTritonContext_AsTritonContext(self)->addCallback(callbacks::SET_CONCRETE_MEMORY_VALUE, callbacks::setConcreteMemoryValueCallback([cb_self, cb](triton::API& api, const triton::arch::MemoryAccess& mem, const triton::uint512& value) {
                 /********* Lambda *********/
+                triton::bindings::python::PyGilEnsure gil;
                 PyObject* args = nullptr;
 
                 /* Create function args */
@@ -581,12 +802,49 @@ namespace triton {
 
                 Py_DECREF(args);
                 /********* End of lambda *********/
-              }, cb));
+              }, cb), cbaseAddr, csize);
+              break;
+
+            case callbacks::SET_CONCRETE_MEMORY_AREA_VALUE:
+              PyTritonContext_AsTritonContext(self)->addCallback(callbacks::SET_CONCRETE_MEMORY_AREA_VALUE, callbacks::setConcreteMemoryAreaValueCallback([cb_self, cb](triton::API& api, triton::uint64 baseAddr, const triton::uint8* area, triton::usize size) {
+                /********* Lambda *********/
+                triton::bindings::python::PyGilEnsure gil;
+                PyObject* args = nullptr;
+
+                /* Create function args */
+                if (cb_self) {
+                  args = triton::bindings::python::xPyTuple_New(4);
+                  PyTuple_SetItem(args, 0, cb_self);
+                  PyTuple_SetItem(args, 1, triton::bindings::python::PyTritonContextRef(api));
+                  PyTuple_SetItem(args, 2, triton::bindings::python::PyLong_FromUint64(baseAddr));
+                  PyTuple_SetItem(args, 3, PyBytes_FromStringAndSize(reinterpret_cast<const char*>(area), size));
+                  Py_INCREF(cb_self);
+                }
+                else {
+                  args = triton::bindings::python::xPyTuple_New(3);
+                  PyTuple_SetItem(args, 0, triton::bindings::python::PyTritonContextRef(api));
+                  PyTuple_SetItem(args, 1, triton::bindings::python::PyLong_FromUint64(baseAddr));
+                  PyTuple_SetItem(args, 2, PyBytes_FromStringAndSize(reinterpret_cast<const char*>(area), size));
+                }
+
+                /* Call the callback */
+                Py_INCREF(cb);
+                PyObject* ret = PyObject_CallObject(cb, args);
+
+                /* Check the call */
+                if (ret == nullptr) {
+                  throw triton::exceptions::PyCallbacks();
+                }
+
+                Py_DECREF(args);
+                /********* End of lambda *********/
+              }, cb), cbaseAddr, csize);
               break;
 
             case callbacks::SET_CONCRETE_REGISTER_VALUE:
               PyTritonContext_AsTritonContext(self)->addCallback(callbacks::SET_CONCRETE_REGISTER_VALUE, callbacks::setConcreteRegisterValueCallback([cb_self, cb](triton::API& api, const triton::arch::Register& reg, const triton::uint512& value){
                 /********* Lambda *********/
+                triton::bindings::python::PyGilEnsure gil;
                 PyObject* args = nullptr;
 
                 /* Create function args */
@@ -622,6 +880,7 @@ namespace triton {
             case callbacks::SYMBOLIC_SIMPLIFICATION:
               PyTritonContext_AsTritonContext(self)->addCallback(callbacks::SYMBOLIC_SIMPLIFICATION, callbacks::symbolicSimplificationCallback([cb_self, cb](triton::API& api, triton::ast::SharedAbstractNode node) {
                 /********* Lambda *********/
+                triton::bindings::python::PyGilEnsure gil;
                 PyObject* args = nullptr;
 
                 /* Create function args */
@@ -675,6 +934,44 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_addSaturationRule(PyObject* self, PyObject* rule) {
+        if (rule == nullptr || !PyStr_Check(rule))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::addSaturationRule(): Expects a string as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->addSaturationRule(PyStr_AsString(rule));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_addSimplificationRule(PyObject* self, PyObject* rule) {
+        if (rule == nullptr || !PyStr_Check(rule))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::addSimplificationRule(): Expects a string as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->addSimplificationRule(PyStr_AsString(rule));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_assignSymbolicExpressionToMemory(PyObject* self, PyObject* args) {
         PyObject* se  = nullptr;
         PyObject* mem = nullptr;
@@ -746,7 +1043,12 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "TritonContext::buildSemantics(): Expects an Instruction as argument.");
 
         try {
-          if (PyTritonContext_AsTritonContext(self)->buildSemantics(*PyInstruction_AsInstruction(inst)))
+          bool ret = false;
+          {
+            PyAllowThreads nogil;
+            ret = PyTritonContext_AsTritonContext(self)->buildSemantics(*PyInstruction_AsInstruction(inst));
+          }
+          if (ret)
             Py_RETURN_TRUE;
           Py_RETURN_FALSE;
         }
@@ -759,6 +1061,19 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_checkpoint(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->checkpoint());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* TritonContext_clearCallbacks(PyObject* self, PyObject* noarg) {
         try {
           PyTritonContext_AsTritonContext(self)->clearCallbacks();
@@ -775,6 +1090,22 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_clearCheckpoints(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->clearCheckpoints();
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_clearModes(PyObject* self, PyObject* noarg) {
         try {
           PyTritonContext_AsTritonContext(self)->clearModes();
@@ -841,6 +1172,51 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_clearSaturationRules(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->clearSaturationRules();
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_clearSimplificationRules(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->clearSimplificationRules();
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_compactSymbolicExpressions(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->compactSymbolicExpressions());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* TritonContext_concretizeAllMemory(PyObject* self, PyObject* noarg) {
         try {
           PyTritonContext_AsTritonContext(self)->concretizeAllMemory();
@@ -1052,6 +1428,62 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_deserializeSymbolic(PyObject* self, PyObject* args) {
+        std::vector<triton::ast::SharedAbstractNode> nodes;
+        std::vector<triton::engines::symbolic::SharedSymbolicExpression> exprs;
+        std::vector<triton::engines::symbolic::PathConstraint> pcs;
+        PyObject* data  = nullptr;
+        PyObject* reuse = nullptr;
+        Py_buffer view;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &data, &reuse) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::deserializeSymbolic(): Invalid number of arguments");
+        }
+
+        if (data == nullptr || !PyObject_CheckBuffer(data))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::deserializeSymbolic(): Expects a buffer (bytes, bytearray, ...) as first argument.");
+
+        if (reuse != nullptr && !PyBool_Check(reuse))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::deserializeSymbolic(): Expects a boolean as second argument.");
+
+        if (PyObject_GetBuffer(data, &view, PyBUF_SIMPLE) != 0)
+          return nullptr;
+
+        std::istringstream stream(std::string(reinterpret_cast<const char*>(view.buf), static_cast<size_t>(view.len)));
+        PyBuffer_Release(&view);
+
+        try {
+          PyTritonContext_AsTritonContext(self)->deserializeSymbolic(stream, nodes, exprs, pcs, reuse != nullptr && PyLong_AsBool(reuse));
+
+          PyObject* ret = xPyTuple_New(3);
+          PyObject* pyNodes = xPyList_New(nodes.size());
+          PyObject* pyExprs = xPyList_New(exprs.size());
+          PyObject* pyPcs = xPyList_New(pcs.size());
+
+          for (triton::usize i = 0; i < nodes.size(); i++)
+            PyList_SetItem(pyNodes, i, PyAstNode(nodes[i]));
+
+          for (triton::usize i = 0; i < exprs.size(); i++)
+            PyList_SetItem(pyExprs, i, PySymbolicExpression(exprs[i]));
+
+          for (triton::usize i = 0; i < pcs.size(); i++)
+            PyList_SetItem(pyPcs, i, PyPathConstraint(pcs[i]));
+
+          PyTuple_SetItem(ret, 0, pyNodes);
+          PyTuple_SetItem(ret, 1, pyExprs);
+          PyTuple_SetItem(ret, 2, pyPcs);
+          return ret;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* TritonContext_disassembly(PyObject* self, PyObject* inst) {
         if (!PyInstruction_Check(inst))
           return PyErr_Format(PyExc_TypeError, "TritonContext::disassembly(): Expects an Instruction as argument.");
@@ -1114,7 +1546,13 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "TritonContext::evaluateAstViaZ3(): Expects a AstNode as argument.");
 
         try {
-          return PyLong_FromUint512(PyTritonContext_AsTritonContext(self)->evaluateAstViaZ3(PyAstNode_AsAstNode(node)));
+          triton::uint512 value = 0;
+          triton::ast::SharedAbstractNode snode = PyAstNode_AsAstNode(node);
+          {
+            PyAllowThreads nogil;
+            value = PyTritonContext_AsTritonContext(self)->evaluateAstViaZ3(snode);
+          }
+          return PyLong_FromUint512(value);
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1190,7 +1628,6 @@ namespace triton {
 
 
       static PyObject* TritonContext_getConcreteMemoryAreaValue(PyObject* self, PyObject* args) {
-        triton::uint8*  area = nullptr;
         PyObject*       ret  = nullptr;
         PyObject*       addr = nullptr;
         PyObject*       size = nullptr;
@@ -1200,22 +1637,51 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "TritonContext::getConcreteMemoryAreaValue(): Invalid number of arguments");
         }
 
-        try {
-          std::vector<triton::uint8> vv = PyTritonContext_AsTritonContext(self)->getConcreteMemoryAreaValue(PyLong_AsUint64(addr), PyLong_AsUsize(size));
-          area = new triton::uint8[vv.size()];
+        if (addr == nullptr || (!PyLong_Check(addr) && !PyInt_Check(addr)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getConcreteMemoryAreaValue(): Expects an integer as first argument.");
 
-          for (triton::usize index = 0; index < vv.size(); index++)
-            area[index] = vv[index];
+        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size) && !PyObject_CheckBuffer(size)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getConcreteMemoryAreaValue(): Expects an integer or a writable buffer as second argument.");
 
-          ret = PyBytes_FromStringAndSize(reinterpret_cast<const char*>(area), vv.size());
-          delete[] area;
-          return ret;
+        // Python object: writable buffer (bytearray, memoryview, numpy array, mmap, ...)
+        if (PyObject_CheckBuffer(size)) {
+          Py_buffer view;
+
+          if (PyObject_GetBuffer(size, &view, PyBUF_WRITABLE) != 0)
+            return nullptr;
+
+          try {
+            PyTritonContext_AsTritonContext(self)->getConcreteMemoryAreaValue(PyLong_AsUint64(addr), reinterpret_cast<triton::uint8*>(view.buf), static_cast<triton::usize>(view.len));
+          }
+          catch (const triton::exceptions::PyCallbacks&) {
+            PyBuffer_Release(&view);
+            return nullptr;
+          }
+          catch (const triton::exceptions::Exception& e) {
+            PyBuffer_Release(&view);
+            return PyErr_Format(PyExc_TypeError, "%s", e.what());
+          }
+
+          PyBuffer_Release(&view);
+          Py_INCREF(Py_None);
+          return Py_None;
+        }
 
+        // Python object: Bytes of the given size
+        triton::usize length = PyLong_AsUsize(size);
+        ret = PyBytes_FromStringAndSize(nullptr, length);
+        if (ret == nullptr)
+          return nullptr;
+
+        try {
+          PyTritonContext_AsTritonContext(self)->getConcreteMemoryAreaValue(PyLong_AsUint64(addr), reinterpret_cast<triton::uint8*>(PyBytes_AS_STRING(ret)), length);
         }
         catch (const triton::exceptions::PyCallbacks&) {
+          Py_DECREF(ret);
           return nullptr;
         }
         catch (const triton::exceptions::Exception& e) {
+          Py_DECREF(ret);
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
@@ -1331,19 +1797,38 @@ namespace triton {
       }
 
 
-      static PyObject* TritonContext_getModel(PyObject* self, PyObject* args, PyObject* kwargs) {
-        triton::engines::solver::status_e status;
-        PyObject* dict = nullptr;
-        PyObject* node = nullptr;
-        PyObject* wb   = nullptr;
-
-        static char* keywords[] = {
-          (char*)"node",
-          (char*)"status",
-          nullptr
-        };
+      static PyObject* TritonContext_getMappedConcreteMemoryAreas(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
 
-        /* Extract Keywords */
+        try {
+          ret = xPyDict_New();
+          for (const auto& area : PyTritonContext_AsTritonContext(self)->getMappedConcreteMemoryAreas())
+            xPyDict_SetItem(ret, PyLong_FromUint64(area.first), PyLong_FromUsize(area.second));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getModel(PyObject* self, PyObject* args, PyObject* kwargs) {
+        triton::engines::solver::status_e status;
+        PyObject* dict = nullptr;
+        PyObject* node = nullptr;
+        PyObject* wb   = nullptr;
+
+        static char* keywords[] = {
+          (char*)"node",
+          (char*)"status",
+          nullptr
+        };
+
+        /* Extract Keywords */
         if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OO", keywords, &node, &wb) == false) {
           return PyErr_Format(PyExc_TypeError, "TritonContext::getModel(): Invalid keyword argument.");
         }
@@ -1357,8 +1842,13 @@ namespace triton {
         }
 
         try {
+          std::unordered_map<triton::usize, triton::engines::solver::SolverModel> model;
+          triton::ast::SharedAbstractNode snode = PyAstNode_AsAstNode(node);
+          {
+            PyAllowThreads nogil;
+            model = PyTritonContext_AsTritonContext(self)->getModel(snode, &status);
+          }
           dict = triton::bindings::python::xPyDict_New();
-          auto model = PyTritonContext_AsTritonContext(self)->getModel(PyAstNode_AsAstNode(node), &status);
           for (auto it = model.begin(); it != model.end(); it++) {
             xPyDict_SetItem(dict, PyLong_FromUsize(it->first), PySolverModel(it->second));
           }
@@ -1413,7 +1903,13 @@ namespace triton {
         }
 
         try {
-          auto models = PyTritonContext_AsTritonContext(self)->getModels(PyAstNode_AsAstNode(node), PyLong_AsUint32(limit), &status);
+          triton::uint32 limitValue = PyLong_AsUint32(limit);
+          std::vector<std::unordered_map<triton::usize, triton::engines::solver::SolverModel>> models;
+          triton::ast::SharedAbstractNode snode = PyAstNode_AsAstNode(node);
+          {
+            PyAllowThreads nogil;
+            models = PyTritonContext_AsTritonContext(self)->getModels(snode, limitValue, &status);
+          }
           triton::uint32 index = 0;
 
           ret = xPyList_New(models.size());
@@ -1446,6 +1942,32 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_getNumberOfCheckpoints(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getNumberOfCheckpoints());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getNumberOfSnapshots(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getNumberOfSnapshots());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* TritonContext_getParentRegisters(PyObject* self, PyObject* noarg) {
         PyObject* ret = nullptr;
 
@@ -1588,6 +2110,48 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_getSaturationRules(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          auto rules = PyTritonContext_AsTritonContext(self)->getSaturationRules();
+
+          ret = xPyList_New(rules.size());
+          for (triton::usize index = 0; index < rules.size(); index++)
+            PyList_SetItem(ret, index, xPyString_FromString(rules[index].c_str()));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getSimplificationRules(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          auto rules = PyTritonContext_AsTritonContext(self)->getSimplificationRules();
+
+          ret = xPyList_New(rules.size());
+          for (triton::usize index = 0; index < rules.size(); index++)
+            PyList_SetItem(ret, index, xPyString_FromString(rules[index].c_str()));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* TritonContext_getSymbolicExpression(PyObject* self, PyObject* symExprId) {
         if (!PyLong_Check(symExprId) && !PyInt_Check(symExprId))
           return PyErr_Format(PyExc_TypeError, "TritonContext::getSymbolicExpression(): Expects an integer as argument.");
@@ -1636,12 +2200,10 @@ namespace triton {
 
         try {
           if (addr == nullptr) {
-            auto regs = PyTritonContext_AsTritonContext(self)->getSymbolicMemory();
-
             ret = xPyDict_New();
-            for (auto it = regs.begin(); it != regs.end(); it++) {
-              xPyDict_SetItem(ret, PyLong_FromUint64(it->first), PySymbolicExpression(it->second));
-            }
+            PyTritonContext_AsTritonContext(self)->forEachSymbolicMemory([&] (triton::uint64 addr, const triton::engines::symbolic::SharedSymbolicExpression& expr) {
+              xPyDict_SetItem(ret, PyLong_FromUint64(addr), PySymbolicExpression(expr));
+            });
           }
           else if (addr != nullptr && (PyLong_Check(addr) || PyInt_Check(addr))) {
             ret = PySymbolicExpression(PyTritonContext_AsTritonContext(self)->getSymbolicMemory(PyLong_AsUint64(addr)));
@@ -1775,17 +2337,14 @@ namespace triton {
 
       static PyObject* TritonContext_getTaintedMemory(PyObject* self, PyObject* noarg) {
         PyObject* ret = nullptr;
-        triton::usize size = 0, index = 0;
 
         try {
-          std::unordered_set<triton::uint64> addresses = PyTritonContext_AsTritonContext(self)->getTaintedMemory();
-
-          size = addresses.size();
-          ret = xPyList_New(size);
-          for (auto it = addresses.begin(); it != addresses.end(); it++) {
-            PyList_SetItem(ret, index, PyLong_FromUint64(*it));
-            index++;
-          }
+          ret = xPyList_New(0);
+          PyTritonContext_AsTritonContext(self)->forEachTaintedMemory([&] (triton::uint64 addr) {
+            PyObject* item = PyLong_FromUint64(addr);
+            PyList_Append(ret, item);
+            Py_DECREF(item);
+          });
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -1848,6 +2407,32 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_getTraceSyncPoints(PyObject* self, PyObject* path) {
+        PyObject* ret = nullptr;
+
+        if (!PyStr_Check(path))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getTraceSyncPoints(): Expects a string as argument.");
+
+        try {
+          std::ifstream stream(PyStr_AsString(path), std::ios::binary);
+          if (!stream.is_open())
+            throw triton::exceptions::Exception("TritonContext::getTraceSyncPoints(): Cannot open the file.");
+
+          triton::utils::TraceReader reader(stream);
+          auto offsets = reader.getSyncPoints();
+
+          ret = xPyList_New(offsets.size());
+          for (triton::usize index = 0; index < offsets.size(); index++)
+            PyList_SetItem(ret, index, PyLong_FromUint64(offsets[index]));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* TritonContext_isArchitectureValid(PyObject* self, PyObject* noarg) {
         try {
           if (PyTritonContext_AsTritonContext(self)->isArchitectureValid() == true)
@@ -2048,7 +2633,31 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "TritonContext::isSat(): Expects a AstNode as argument.");
 
         try {
-          if (PyTritonContext_AsTritonContext(self)->isSat(PyAstNode_AsAstNode(node)) == true)
+          bool ret = false;
+          triton::ast::SharedAbstractNode snode = PyAstNode_AsAstNode(node);
+          {
+            PyAllowThreads nogil;
+            ret = PyTritonContext_AsTritonContext(self)->isSat(snode);
+          }
+          if (ret == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_isSnapshot(PyObject* self, PyObject* id) {
+        if (!PyInt_Check(id) && !PyLong_Check(id))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::isSnapshot(): Expects an integer as argument.");
+
+        try {
+          if (PyTritonContext_AsTritonContext(self)->isSnapshot(PyLong_AsUsize(id)) == true)
             Py_RETURN_TRUE;
           Py_RETURN_FALSE;
         }
@@ -2140,6 +2749,114 @@ namespace triton {
         }
       }
 
+      static PyObject* TritonContext_loadSynthesisOracles(PyObject* self, PyObject* path) {
+        if (path == nullptr || !PyStr_Check(path))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::loadSynthesisOracles(): Expects a string as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->loadSynthesisOracles(PyStr_AsString(path));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+      static PyObject* TritonContext_mapConcreteMemoryArea(PyObject* self, PyObject* args) {
+        PyObject* baseAddr = nullptr;
+        PyObject* area     = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &baseAddr, &area) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::mapConcreteMemoryArea(): Invalid number of arguments");
+        }
+
+        if (baseAddr == nullptr || (!PyLong_Check(baseAddr) && !PyInt_Check(baseAddr)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::mapConcreteMemoryArea(): Expects an integer as first argument.");
+
+        if (area == nullptr || !PyObject_CheckBuffer(area))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::mapConcreteMemoryArea(): Expects a buffer as second argument.");
+
+        Py_buffer* view = new(std::nothrow) Py_buffer;
+        if (view == nullptr)
+          return PyErr_NoMemory();
+
+        /* A read-only request (no PyBUF_WRITABLE): the area is never written through the buffer, thus immutable objects are accepted */
+        if (PyObject_GetBuffer(area, view, PyBUF_SIMPLE) != 0) {
+          delete view;
+          return nullptr;
+        }
+
+        /* The buffer is exported as long as the area is mapped, in this context or in one of its snapshots */
+        std::shared_ptr<const void> owner(view, [](Py_buffer* view) {
+          PyGilEnsure gil;
+          PyBuffer_Release(view);
+          delete view;
+        });
+
+        try {
+          PyTritonContext_AsTritonContext(self)->mapConcreteMemoryArea(PyLong_AsUint64(baseAddr), reinterpret_cast<const triton::uint8*>(view->buf), static_cast<triton::usize>(view->len), owner);
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_mapConcreteMemoryFile(PyObject* self, PyObject* args) {
+        PyObject* baseAddr = nullptr;
+        PyObject* path     = nullptr;
+        PyObject* offset   = nullptr;
+        PyObject* size     = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OOOO", &baseAddr, &path, &offset, &size) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::mapConcreteMemoryFile(): Invalid number of arguments");
+        }
+
+        if (baseAddr == nullptr || (!PyLong_Check(baseAddr) && !PyInt_Check(baseAddr)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::mapConcreteMemoryFile(): Expects an integer as first argument.");
+
+        if (path == nullptr || !PyStr_Check(path))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::mapConcreteMemoryFile(): Expects a string as second argument.");
+
+        if (offset != nullptr && !PyLong_Check(offset) && !PyInt_Check(offset))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::mapConcreteMemoryFile(): Expects an integer as third argument.");
+
+        if (size != nullptr && !PyLong_Check(size) && !PyInt_Check(size))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::mapConcreteMemoryFile(): Expects an integer as fourth argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->mapConcreteMemoryFile(
+            PyLong_AsUint64(baseAddr),
+            PyStr_AsString(path),
+            (offset != nullptr) ? PyLong_AsUint64(offset) : 0,
+            (size != nullptr) ? PyLong_AsUsize(size) : 0
+          );
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_newSymbolicExpression(PyObject* self, PyObject* args) {
         PyObject* node          = nullptr;
         PyObject* comment       = nullptr;
@@ -2252,12 +2969,64 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_printSmtDag(PyObject* self, PyObject* args) {
+        PyObject* node        = nullptr;
+        PyObject* assertFlag  = nullptr;
+        PyObject* path        = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OOO", &node, &assertFlag, &path) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::printSmtDag(): Invalid number of arguments");
+        }
+
+        if (node == nullptr || !PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::printSmtDag(): Expects a AstNode as first argument.");
+
+        if (assertFlag != nullptr && !PyBool_Check(assertFlag))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::printSmtDag(): Expects a boolean as second argument.");
+
+        if (path != nullptr && !PyStr_Check(path))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::printSmtDag(): Expects a string as third argument.");
+
+        try {
+          bool assert_ = (assertFlag != nullptr && PyLong_AsBool(assertFlag));
+
+          if (path != nullptr) {
+            std::ofstream stream(PyStr_AsString(path));
+            if (!stream.is_open())
+              throw triton::exceptions::Exception("TritonContext::printSmtDag(): Cannot open the file.");
+            {
+              PyAllowThreads nogil;
+              PyTritonContext_AsTritonContext(self)->printSmtDag(stream, PyAstNode_AsAstNode(node), assert_) << std::endl;
+            }
+            Py_INCREF(Py_None);
+            return Py_None;
+          }
+
+          std::ostringstream stream;
+          PyTritonContext_AsTritonContext(self)->printSmtDag(stream, PyAstNode_AsAstNode(node), assert_);
+          return xPyString_FromString(stream.str().c_str());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* TritonContext_processing(PyObject* self, PyObject* inst) {
         if (!PyInstruction_Check(inst))
           return PyErr_Format(PyExc_TypeError, "TritonContext::processing(): Expects an Instruction as argument.");
 
         try {
-          if (PyTritonContext_AsTritonContext(self)->processing(*PyInstruction_AsInstruction(inst)))
+          bool ret = false;
+          {
+            PyAllowThreads nogil;
+            ret = PyTritonContext_AsTritonContext(self)->processing(*PyInstruction_AsInstruction(inst));
+          }
+          if (ret)
             Py_RETURN_TRUE;
           Py_RETURN_FALSE;
         }
@@ -2313,12 +3082,18 @@ namespace triton {
             case callbacks::GET_CONCRETE_MEMORY_VALUE:
               PyTritonContext_AsTritonContext(self)->removeCallback(callbacks::GET_CONCRETE_MEMORY_VALUE, callbacks::getConcreteMemoryValueCallback(nullptr, cb));
               break;
+            case callbacks::GET_CONCRETE_MEMORY_AREA_VALUE:
+              PyTritonContext_AsTritonContext(self)->removeCallback(callbacks::GET_CONCRETE_MEMORY_AREA_VALUE, callbacks::getConcreteMemoryAreaValueCallback(nullptr, cb));
+              break;
             case callbacks::GET_CONCRETE_REGISTER_VALUE:
               PyTritonContext_AsTritonContext(self)->removeCallback(callbacks::GET_CONCRETE_REGISTER_VALUE, callbacks::getConcreteRegisterValueCallback(nullptr, cb));
               break;
             case callbacks::SET_CONCRETE_MEMORY_VALUE:
               PyTritonContext_AsTritonContext(self)->removeCallback(callbacks::SET_CONCRETE_MEMORY_VALUE, callbacks::setConcreteMemoryValueCallback(nullptr, cb));
               break;
+            case callbacks::SET_CONCRETE_MEMORY_AREA_VALUE:
+              PyTritonContext_AsTritonContext(self)->removeCallback(callbacks::SET_CONCRETE_MEMORY_AREA_VALUE, callbacks::setConcreteMemoryAreaValueCallback(nullptr, cb));
+              break;
             case callbacks::SET_CONCRETE_REGISTER_VALUE:
               PyTritonContext_AsTritonContext(self)->removeCallback(callbacks::SET_CONCRETE_REGISTER_VALUE, callbacks::setConcreteRegisterValueCallback(nullptr, cb));
               break;
@@ -2341,6 +3116,68 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_removeSnapshot(PyObject* self, PyObject* id) {
+        if (!PyInt_Check(id) && !PyLong_Check(id))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::removeSnapshot(): Expects an integer as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->removeSnapshot(PyLong_AsUsize(id));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_replayTrace(PyObject* self, PyObject* args) {
+        PyObject* path  = nullptr;
+        PyObject* begin = nullptr;
+        PyObject* end   = nullptr;
+        triton::usize count = 0;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OOO", &path, &begin, &end) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::replayTrace(): Invalid number of arguments");
+        }
+
+        if (path == nullptr || !PyStr_Check(path))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::replayTrace(): Expects a string as first argument.");
+
+        if (begin != nullptr && !PyLong_Check(begin) && !PyInt_Check(begin))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::replayTrace(): Expects an integer as second argument.");
+
+        if (end != nullptr && !PyLong_Check(end) && !PyInt_Check(end))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::replayTrace(): Expects an integer as third argument.");
+
+        try {
+          std::ifstream stream(PyStr_AsString(path), std::ios::binary);
+          if (!stream.is_open())
+            throw triton::exceptions::Exception("TritonContext::replayTrace(): Cannot open the file.");
+
+          triton::uint64 cbegin = (begin != nullptr) ? PyLong_AsUint64(begin) : 0;
+          triton::uint64 cend   = (end != nullptr) ? PyLong_AsUint64(end) : 0;
+          {
+            PyAllowThreads nogil;
+            count = PyTritonContext_AsTritonContext(self)->replayTrace(stream, cbegin, cend);
+          }
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return PyLong_FromUsize(count);
+      }
+
+
       static PyObject* TritonContext_reset(PyObject* self, PyObject* noarg) {
         try {
           PyTritonContext_AsTritonContext(self)->reset();
@@ -2357,6 +3194,285 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_restoreSnapshot(PyObject* self, PyObject* id) {
+        if (!PyInt_Check(id) && !PyLong_Check(id))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::restoreSnapshot(): Expects an integer as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->restoreSnapshot(PyLong_AsUsize(id));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_rollback(PyObject* self, PyObject* checkpoint) {
+        if (!PyInt_Check(checkpoint) && !PyLong_Check(checkpoint))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::rollback(): Expects an integer as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->rollback(PyLong_AsUsize(checkpoint));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_run(PyObject* self, PyObject* args) {
+        std::map<triton::uint64, std::function<bool(triton::uint64)>> chooks;
+        std::set<triton::uint64> cstopAddrs;
+        PyObject* pc        = nullptr;
+        PyObject* maxInsts  = nullptr;
+        PyObject* stopAddrs = nullptr;
+        PyObject* hooks     = nullptr;
+        PyObject* ret       = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OOOO", &pc, &maxInsts, &stopAddrs, &hooks) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::run(): Invalid number of arguments");
+        }
+
+        if (pc == nullptr || (!PyLong_Check(pc) && !PyInt_Check(pc)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::run(): Expects an integer as first argument.");
+
+        if (maxInsts != nullptr && !PyLong_Check(maxInsts) && !PyInt_Check(maxInsts))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::run(): Expects an integer as second argument.");
+
+        if (stopAddrs != nullptr && stopAddrs != Py_None) {
+          PyObject* iterator = PyObject_GetIter(stopAddrs);
+          if (iterator == nullptr)
+            return PyErr_Format(PyExc_TypeError, "TritonContext::run(): Expects a list of integers as third argument.");
+
+          while (PyObject* item = PyIter_Next(iterator)) {
+            bool isInt = PyLong_Check(item) || PyInt_Check(item);
+            if (isInt)
+              cstopAddrs.insert(PyLong_AsUint64(item));
+            Py_DECREF(item);
+            if (!isInt) {
+              Py_DECREF(iterator);
+              return PyErr_Format(PyExc_TypeError, "TritonContext::run(): Expects a list of integers as third argument.");
+            }
+          }
+          Py_DECREF(iterator);
+        }
+
+        if (hooks != nullptr && hooks != Py_None && !PyDict_Check(hooks))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::run(): Expects a dictionary as fourth argument.");
+
+        /* Hooks are taken from a copy, the dictionary may be modified by a hook */
+        hooks = (hooks != nullptr && hooks != Py_None) ? PyDict_Copy(hooks) : PyDict_New();
+        if (hooks == nullptr)
+          return nullptr;
+
+        PyObject* key   = nullptr;
+        PyObject* value = nullptr;
+        Py_ssize_t pos  = 0;
+
+        while (PyDict_Next(hooks, &pos, &key, &value)) {
+          if ((!PyLong_Check(key) && !PyInt_Check(key)) || !PyCallable_Check(value)) {
+            Py_DECREF(hooks);
+            return PyErr_Format(PyExc_TypeError, "TritonContext::run(): Expects a dictionary of {integer : callable} as fourth argument.");
+          }
+
+          chooks[PyLong_AsUint64(key)] = [self, value](triton::uint64 addr) -> bool {
+            triton::bindings::python::PyGilEnsure gil;
+
+            PyObject* pyaddr = PyLong_FromUint64(addr);
+            PyObject* result = PyObject_CallFunctionObjArgs(value, self, pyaddr, nullptr);
+            Py_DECREF(pyaddr);
+
+            if (result == nullptr)
+              throw triton::exceptions::PyCallbacks();
+
+            int stop = PyObject_IsTrue(result);
+            Py_DECREF(result);
+
+            if (stop < 0)
+              throw triton::exceptions::PyCallbacks();
+
+            return stop == 1;
+          };
+        }
+
+        try {
+          triton::uint64 cpc    = PyLong_AsUint64(pc);
+          triton::usize  climit = (maxInsts != nullptr) ? PyLong_AsUsize(maxInsts) : 0;
+          {
+            PyAllowThreads nogil;
+            cpc = PyTritonContext_AsTritonContext(self)->run(cpc, climit, cstopAddrs, chooks);
+          }
+          ret = PyLong_FromUint64(cpc);
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          ret = nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          ret = PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_DECREF(hooks);
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_saturate(PyObject* self, PyObject* args, PyObject* kwargs) {
+        PyObject* node      = nullptr;
+        PyObject* nodeLimit = nullptr;
+        PyObject* timeLimit = nullptr;
+        PyObject* cost      = nullptr;
+
+        static char* keywords[] = {
+          (char*)"node",
+          (char*)"nodeLimit",
+          (char*)"timeLimit",
+          (char*)"cost",
+          nullptr
+        };
+
+        /* Extract Keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OOOO", keywords, &node, &nodeLimit, &timeLimit, &cost) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::saturate(): Invalid keyword argument.");
+        }
+
+        if (node == nullptr || !PyAstNode_Check(node)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::saturate(): Expects a AstNode as first argument.");
+        }
+
+        if (nodeLimit != nullptr && !PyLong_Check(nodeLimit) && !PyInt_Check(nodeLimit)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::saturate(): Expects an integer as nodeLimit.");
+        }
+
+        if (timeLimit != nullptr && !PyLong_Check(timeLimit) && !PyInt_Check(timeLimit)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::saturate(): Expects an integer as timeLimit.");
+        }
+
+        if (cost != nullptr && !PyLong_Check(cost) && !PyInt_Check(cost)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::saturate(): Expects a SYMBOLIC cost as cost.");
+        }
+
+        try {
+          triton::usize nlimit = triton::engines::symbolic::EGraph::DEFAULT_NODE_LIMIT;
+          triton::usize tlimit = triton::engines::symbolic::EGraph::DEFAULT_TIME_LIMIT;
+          triton::engines::symbolic::cost_e ecost = triton::engines::symbolic::SIZE_COST;
+          triton::ast::SharedAbstractNode snode = PyAstNode_AsAstNode(node);
+
+          if (nodeLimit != nullptr)
+            nlimit = PyLong_AsUsize(nodeLimit);
+
+          if (timeLimit != nullptr)
+            tlimit = PyLong_AsUsize(timeLimit);
+
+          if (cost != nullptr)
+            ecost = static_cast<triton::engines::symbolic::cost_e>(PyLong_AsUint32(cost));
+
+          {
+            PyAllowThreads nogil;
+            snode = PyTritonContext_AsTritonContext(self)->processEqualitySaturation(snode, nlimit, tlimit, ecost);
+          }
+
+          return PyAstNode(snode);
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_saveSynthesisOracles(PyObject* self, PyObject* path) {
+        if (path == nullptr || !PyStr_Check(path))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::saveSynthesisOracles(): Expects a string as argument.");
+
+        try {
+          PyAllowThreads nogil;
+          PyTritonContext_AsTritonContext(self)->saveSynthesisOracles(PyStr_AsString(path));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_serializeSymbolic(PyObject* self, PyObject* args) {
+        std::vector<triton::ast::SharedAbstractNode> nodes;
+        std::vector<triton::engines::symbolic::SharedSymbolicExpression> exprs;
+        std::vector<triton::engines::symbolic::PathConstraint> pcs;
+        PyObject* pyNodes = nullptr;
+        PyObject* pyExprs = nullptr;
+        PyObject* pyPcs   = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OOO", &pyNodes, &pyExprs, &pyPcs) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::serializeSymbolic(): Invalid number of arguments");
+        }
+
+        if (pyNodes != nullptr && !PyList_Check(pyNodes))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::serializeSymbolic(): Expects a list of AstNode as first argument.");
+
+        if (pyExprs != nullptr && !PyList_Check(pyExprs))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::serializeSymbolic(): Expects a list of SymbolicExpression as second argument.");
+
+        if (pyPcs != nullptr && !PyList_Check(pyPcs))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::serializeSymbolic(): Expects a list of PathConstraint as third argument.");
+
+        for (Py_ssize_t i = 0; pyNodes != nullptr && i < PyList_Size(pyNodes); i++) {
+          PyObject* item = PyList_GetItem(pyNodes, i);
+          if (!PyAstNode_Check(item))
+            return PyErr_Format(PyExc_TypeError, "TritonContext::serializeSymbolic(): Each item of nodes must be an AstNode.");
+          nodes.push_back(PyAstNode_AsAstNode(item));
+        }
+
+        for (Py_ssize_t i = 0; pyExprs != nullptr && i < PyList_Size(pyExprs); i++) {
+          PyObject* item = PyList_GetItem(pyExprs, i);
+          if (!PySymbolicExpression_Check(item))
+            return PyErr_Format(PyExc_TypeError, "TritonContext::serializeSymbolic(): Each item of exprs must be a SymbolicExpression.");
+          exprs.push_back(PySymbolicExpression_AsSymbolicExpression(item));
+        }
+
+        for (Py_ssize_t i = 0; pyPcs != nullptr && i < PyList_Size(pyPcs); i++) {
+          PyObject* item = PyList_GetItem(pyPcs, i);
+          if (!PyPathConstraint_Check(item))
+            return PyErr_Format(PyExc_TypeError, "TritonContext::serializeSymbolic(): Each item of pcs must be a PathConstraint.");
+          pcs.push_back(*PyPathConstraint_AsPathConstraint(item));
+        }
+
+        try {
+          std::ostringstream stream;
+          PyTritonContext_AsTritonContext(self)->serializeSymbolic(stream, nodes, exprs, pcs);
+          std::string data = stream.str();
+          return PyBytes_FromStringAndSize(data.data(), data.size());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* TritonContext_setArchitecture(PyObject* self, PyObject* arg) {
         if (!PyLong_Check(arg) && !PyInt_Check(arg))
           return PyErr_Format(PyExc_TypeError, "TritonContext::setArchitecture(): Expects an ARCH as argument.");
@@ -2411,7 +3527,7 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteMemoryAreaValue(): Expects an integer as first argument.");
 
         if (values == nullptr)
-          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteMemoryAreaValue(): Expects a list or bytes as second argument.");
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteMemoryAreaValue(): Expects a list or a buffer as second argument.");
 
         // Python object: List
         if (PyList_Check(values)) {
@@ -2435,41 +3551,31 @@ namespace triton {
           }
         }
 
-        // Python object: Bytes
-        else if (PyBytes_Check(values)) {
-          triton::uint8* area = reinterpret_cast<triton::uint8*>(PyBytes_AsString(values));
-          triton::usize  size = static_cast<triton::usize>(PyBytes_Size(values));
+        // Python object: buffer (bytes, bytearray, memoryview, numpy array, mmap, ...)
+        else if (PyObject_CheckBuffer(values)) {
+          Py_buffer view;
 
-          try {
-            PyTritonContext_AsTritonContext(self)->setConcreteMemoryAreaValue(PyLong_AsUint64(baseAddr), area, size);
-          }
-          catch (const triton::exceptions::PyCallbacks&) {
+          if (PyObject_GetBuffer(values, &view, PyBUF_SIMPLE) != 0)
             return nullptr;
-          }
-          catch (const triton::exceptions::Exception& e) {
-            return PyErr_Format(PyExc_TypeError, "%s", e.what());
-          }
-        }
-
-        // Python object: ByteArray
-        else if (PyByteArray_Check(values)) {
-          triton::uint8* area = reinterpret_cast<triton::uint8*>(PyByteArray_AsString(values));
-          triton::usize  size = static_cast<triton::usize>(PyByteArray_Size(values));
 
           try {
-            PyTritonContext_AsTritonContext(self)->setConcreteMemoryAreaValue(PyLong_AsUint64(baseAddr), area, size);
+            PyTritonContext_AsTritonContext(self)->setConcreteMemoryAreaValue(PyLong_AsUint64(baseAddr), reinterpret_cast<const triton::uint8*>(view.buf), static_cast<triton::usize>(view.len));
           }
           catch (const triton::exceptions::PyCallbacks&) {
+            PyBuffer_Release(&view);
             return nullptr;
           }
           catch (const triton::exceptions::Exception& e) {
+            PyBuffer_Release(&view);
             return PyErr_Format(PyExc_TypeError, "%s", e.what());
           }
+
+          PyBuffer_Release(&view);
         }
 
         // Invalid Python object
         else
-          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteMemoryAreaValue(): Expects a list or bytes as second argument.");
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcreteMemoryAreaValue(): Expects a list or a buffer as second argument.");
 
         Py_INCREF(Py_None);
         return Py_None;
@@ -2749,7 +3855,34 @@ namespace triton {
           z3Flag = PyLong_FromUint32(false);
 
         try {
-          return PyAstNode(PyTritonContext_AsTritonContext(self)->processSimplification(PyAstNode_AsAstNode(node), PyLong_AsBool(z3Flag)));
+          bool z3 = PyLong_AsBool(z3Flag);
+          triton::ast::SharedAbstractNode snode = PyAstNode_AsAstNode(node);
+          {
+            PyAllowThreads nogil;
+            snode = PyTritonContext_AsTritonContext(self)->processSimplification(snode, z3);
+          }
+          return PyAstNode(snode);
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_simplifyMba(PyObject* self, PyObject* node) {
+        if (!PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::simplifyMba(): Expects a AstNode as argument.");
+
+        try {
+          triton::ast::SharedAbstractNode snode = PyAstNode_AsAstNode(node);
+          {
+            PyAllowThreads nogil;
+            snode = PyTritonContext_AsTritonContext(self)->processMbaSimplification(snode);
+          }
+          return PyAstNode(snode);
         }
         catch (const triton::exceptions::PyCallbacks&) {
           return nullptr;
@@ -2763,11 +3896,29 @@ namespace triton {
       static PyObject* TritonContext_sliceExpressions(PyObject* self, PyObject* expr) {
         PyObject* ret = nullptr;
 
-        if (!PySymbolicExpression_Check(expr))
-          return PyErr_Format(PyExc_TypeError, "TritonContext::sliceExpressions(): Expects a SymbolicExpression as argument.");
+        std::vector<triton::engines::symbolic::SharedSymbolicExpression> targets;
+
+        if (PySymbolicExpression_Check(expr)) {
+          targets.push_back(PySymbolicExpression_AsSymbolicExpression(expr));
+        }
+        else if (PyList_Check(expr)) {
+          for (Py_ssize_t i = 0; i < PyList_Size(expr); i++) {
+            PyObject* item = PyList_GetItem(expr, i);
+            if (!PySymbolicExpression_Check(item))
+              return PyErr_Format(PyExc_TypeError, "TritonContext::sliceExpressions(): Expects a list of SymbolicExpression as argument.");
+            targets.push_back(PySymbolicExpression_AsSymbolicExpression(item));
+          }
+        }
+        else {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::sliceExpressions(): Expects a SymbolicExpression or a list of SymbolicExpression as argument.");
+        }
 
         try {
-          auto exprs = PyTritonContext_AsTritonContext(self)->sliceExpressions(PySymbolicExpression_AsSymbolicExpression(expr));
+          std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicExpression> exprs;
+          {
+            PyAllowThreads nogil;
+            exprs = PyTritonContext_AsTritonContext(self)->sliceExpressions(targets);
+          }
 
           ret = xPyDict_New();
           for (auto it = exprs.begin(); it != exprs.end(); it++)
@@ -2881,6 +4032,60 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_synthesize(PyObject* self, PyObject* args, PyObject* kwargs) {
+        PyObject* node     = nullptr;
+        PyObject* constant = nullptr;
+
+        static char* keywords[] = {
+          (char*)"node",
+          (char*)"constant",
+          nullptr
+        };
+
+        /* Extract Keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OO", keywords, &node, &constant) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::synthesize(): Invalid keyword argument.");
+        }
+
+        if (node == nullptr || !PyAstNode_Check(node)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::synthesize(): Expects a AstNode as first argument.");
+        }
+
+        if (constant != nullptr && !PyBool_Check(constant)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::synthesize(): Expects a boolean as constant.");
+        }
+
+        try {
+          triton::ast::SharedAbstractNode snode = PyAstNode_AsAstNode(node);
+          bool cconstant = (constant == nullptr) || PyLong_AsBool(constant);
+          {
+            PyAllowThreads nogil;
+            snode = PyTritonContext_AsTritonContext(self)->synthesize(snode, cconstant);
+          }
+          return PyAstNode(snode);
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_takeSnapshot(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->takeSnapshot());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* TritonContext_taintAssignment(PyObject* self, PyObject* args) {
         PyObject* op1 = nullptr;
         PyObject* op2 = nullptr;
@@ -3016,6 +4221,38 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_trimSymbolicExpressions(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->trimSymbolicExpressions());
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_unmapConcreteMemoryArea(PyObject* self, PyObject* baseAddr) {
+        if (!PyLong_Check(baseAddr) && !PyInt_Check(baseAddr))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::unmapConcreteMemoryArea(): Expects an integer as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->unmapConcreteMemoryArea(PyLong_AsUint64(baseAddr));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_untaintMemory(PyObject* self, PyObject* mem) {
         try {
           if (PyMemoryAccess_Check(mem)) {
@@ -3106,13 +4343,20 @@ namespace triton {
       //! TritonContext methods.
       PyMethodDef TritonContext_callbacks[] = {
         {"addCallback",                         (PyCFunction)TritonContext_addCallback,                               METH_VARARGS,                  ""},
+        {"addSaturationRule",                   (PyCFunction)TritonContext_addSaturationRule,                         METH_O,                        ""},
+        {"addSimplificationRule",               (PyCFunction)TritonContext_addSimplificationRule,                     METH_O,                        ""},
         {"assignSymbolicExpressionToMemory",    (PyCFunction)TritonContext_assignSymbolicExpressionToMemory,          METH_VARARGS,                  ""},
         {"assignSymbolicExpressionToRegister",  (PyCFunction)TritonContext_assignSymbolicExpressionToRegister,        METH_VARARGS,                  ""},
         {"buildSemantics",                      (PyCFunction)TritonContext_buildSemantics,                            METH_O,                        ""},
+        {"checkpoint",                          (PyCFunction)TritonContext_checkpoint,                                METH_NOARGS,                   ""},
         {"clearCallbacks",                      (PyCFunction)TritonContext_clearCallbacks,                            METH_NOARGS,                   ""},
+        {"clearCheckpoints",                    (PyCFunction)TritonContext_clearCheckpoints,                          METH_NOARGS,                   ""},
         {"clearModes",                          (PyCFunction)TritonContext_clearModes,                                METH_NOARGS,                   ""},
         {"clearConcreteMemoryValue",            (PyCFunction)TritonContext_clearConcreteMemoryValue,                  METH_VARARGS,                  ""},
         {"clearPathConstraints",                (PyCFunction)TritonContext_clearPathConstraints,                      METH_NOARGS,                   ""},
+        {"clearSaturationRules",                (PyCFunction)TritonContext_clearSaturationRules,                      METH_NOARGS,                   ""},
+        {"clearSimplificationRules",            (PyCFunction)TritonContext_clearSimplificationRules,                  METH_NOARGS,                   ""},
+        {"compactSymbolicExpressions",          (PyCFunction)TritonContext_compactSymbolicExpressions,                METH_NOARGS,                   ""},
         {"concretizeAllMemory",                 (PyCFunction)TritonContext_concretizeAllMemory,                       METH_NOARGS,                   ""},
         {"concretizeAllRegister",               (PyCFunction)TritonContext_concretizeAllRegister,                     METH_NOARGS,                   ""},
         {"concretizeMemory",                    (PyCFunction)TritonContext_concretizeMemory,                          METH_O,                        ""},
@@ -3120,6 +4364,7 @@ namespace triton {
         {"createSymbolicMemoryExpression",      (PyCFunction)TritonContext_createSymbolicMemoryExpression,            METH_VARARGS,                  ""},
         {"createSymbolicRegisterExpression",    (PyCFunction)TritonContext_createSymbolicRegisterExpression,          METH_VARARGS,                  ""},
         {"createSymbolicVolatileExpression",    (PyCFunction)TritonContext_createSymbolicVolatileExpression,          METH_VARARGS,                  ""},
+        {"deserializeSymbolic",                 (PyCFunction)TritonContext_deserializeSymbolic,                       METH_VARARGS,                  ""},
         {"disassembly",                         (PyCFunction)TritonContext_disassembly,                               METH_O,                        ""},
         {"enableSymbolicEngine",                (PyCFunction)TritonContext_enableSymbolicEngine,                      METH_O,                        ""},
         {"enableTaintEngine",                   (PyCFunction)TritonContext_enableTaintEngine,                         METH_O,                        ""},
@@ -3136,9 +4381,12 @@ namespace triton {
         {"getGprSize",                          (PyCFunction)TritonContext_getGprSize,                                METH_NOARGS,                   ""},
         {"getImmediateAst",                     (PyCFunction)TritonContext_getImmediateAst,                           METH_O,                        ""},
         {"getMemoryAst",                        (PyCFunction)TritonContext_getMemoryAst,                              METH_O,                        ""},
+        {"getMappedConcreteMemoryAreas",        (PyCFunction)TritonContext_getMappedConcreteMemoryAreas,              METH_NOARGS,                   ""},
         {"getModel",                            (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_getModel,  METH_VARARGS | METH_KEYWORDS,  ""},
         {"getModels",                           (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_getModels, METH_VARARGS | METH_KEYWORDS,  ""},
         {"getParentRegister",                   (PyCFunction)TritonContext_getParentRegister,                         METH_O,                        ""},
+        {"getNumberOfCheckpoints",              (PyCFunction)TritonContext_getNumberOfCheckpoints,                    METH_NOARGS,                   ""},
+        {"getNumberOfSnapshots",                (PyCFunction)TritonContext_getNumberOfSnapshots,                      METH_NOARGS,                   ""},
         {"getParentRegisters",                  (PyCFunction)TritonContext_getParentRegisters,                        METH_NOARGS,                   ""},
         {"getPathConstraints",                  (PyCFunction)TritonContext_getPathConstraints,                        METH_NOARGS,                   ""},
         {"getPathPredicate",                    (PyCFunction)TritonContext_getPathPredicate,                          METH_NOARGS,                   ""},
@@ -3146,6 +4394,8 @@ namespace triton {
         {"getPredicatesToReachAddress",         (PyCFunction)TritonContext_getPredicatesToReachAddress,               METH_O,                        ""},
         {"getRegister",                         (PyCFunction)TritonContext_getRegister,                               METH_O,                        ""},
         {"getRegisterAst",                      (PyCFunction)TritonContext_getRegisterAst,                            METH_O,                        ""},
+        {"getSaturationRules",                  (PyCFunction)TritonContext_getSaturationRules,                        METH_NOARGS,                   ""},
+        {"getSimplificationRules",              (PyCFunction)TritonContext_getSimplificationRules,                    METH_NOARGS,                   ""},
         {"getSymbolicExpression",               (PyCFunction)TritonContext_getSymbolicExpression,                     METH_O,                        ""},
         {"getSymbolicExpressions",              (PyCFunction)TritonContext_getSymbolicExpressions,                    METH_NOARGS,                   ""},
         {"getSymbolicMemory",                   (PyCFunction)TritonContext_getSymbolicMemory,                         METH_VARARGS,                  ""},
@@ -3158,6 +4408,7 @@ namespace triton {
         {"getTaintedMemory",                    (PyCFunction)TritonContext_getTaintedMemory,                          METH_NOARGS,                   ""},
         {"getTaintedRegisters",                 (PyCFunction)TritonContext_getTaintedRegisters,                       METH_NOARGS,                   ""},
         {"getTaintedSymbolicExpressions",       (PyCFunction)TritonContext_getTaintedSymbolicExpressions,             METH_NOARGS,                   ""},
+        {"getTraceSyncPoints",                  (PyCFunction)TritonContext_getTraceSyncPoints,                        METH_O,                        ""},
         {"isArchitectureValid",                 (PyCFunction)TritonContext_isArchitectureValid,                       METH_NOARGS,                   ""},
         {"isConcreteMemoryValueDefined",        (PyCFunction)TritonContext_isConcreteMemoryValueDefined,              METH_VARARGS,                  ""},
         {"isFlag",                              (PyCFunction)TritonContext_isFlag,                                    METH_O,                        ""},
@@ -3169,18 +4420,31 @@ namespace triton {
         {"isRegisterTainted",                   (PyCFunction)TritonContext_isRegisterTainted,                         METH_O,                        ""},
         {"isRegisterValid",                     (PyCFunction)TritonContext_isRegisterValid,                           METH_O,                        ""},
         {"isSat",                               (PyCFunction)TritonContext_isSat,                                     METH_O,                        ""},
+        {"isSnapshot",                          (PyCFunction)TritonContext_isSnapshot,                                METH_O,                        ""},
         {"isSymbolicEngineEnabled",             (PyCFunction)TritonContext_isSymbolicEngineEnabled,                   METH_NOARGS,                   ""},
         {"isSymbolicExpressionExists",          (PyCFunction)TritonContext_isSymbolicExpressionExists,                METH_O,                        ""},
         {"isTaintEngineEnabled",                (PyCFunction)TritonContext_isTaintEngineEnabled,                      METH_NOARGS,                   ""},
         {"isThumb",                             (PyCFunction)TritonContext_isThumb,                                   METH_NOARGS,                   ""},
+        {"loadSynthesisOracles",                (PyCFunction)TritonContext_loadSynthesisOracles,                      METH_O,                        ""},
+        {"mapConcreteMemoryArea",               (PyCFunction)TritonContext_mapConcreteMemoryArea,                     METH_VARARGS,                  ""},
+        {"mapConcreteMemoryFile",               (PyCFunction)TritonContext_mapConcreteMemoryFile,                     METH_VARARGS,                  ""},
         {"newSymbolicExpression",               (PyCFunction)TritonContext_newSymbolicExpression,                     METH_VARARGS,                  ""},
         {"newSymbolicVariable",                 (PyCFunction)TritonContext_newSymbolicVariable,                       METH_VARARGS,                  ""},
         {"popPathConstraint",                   (PyCFunction)TritonContext_popPathConstraint,                         METH_NOARGS,                   ""},
         {"printSlicedExpressions",              (PyCFunction)TritonContext_printSlicedExpressions,                    METH_VARARGS,                  ""},
+        {"printSmtDag",                         (PyCFunction)TritonContext_printSmtDag,                               METH_VARARGS,                  ""},
         {"processing",                          (PyCFunction)TritonContext_processing,                                METH_O,                        ""},
         {"pushPathConstraint",                  (PyCFunction)TritonContext_pushPathConstraint,                        METH_O,                        ""},
         {"removeCallback",                      (PyCFunction)TritonContext_removeCallback,                            METH_VARARGS,                  ""},
+        {"removeSnapshot",                      (PyCFunction)TritonContext_removeSnapshot,                            METH_O,                        ""},
+        {"replayTrace",                         (PyCFunction)TritonContext_replayTrace,                               METH_VARARGS,                  ""},
         {"reset",                               (PyCFunction)TritonContext_reset,                                     METH_NOARGS,                   ""},
+        {"restoreSnapshot",                     (PyCFunction)TritonContext_restoreSnapshot,                           METH_O,                        ""},
+        {"rollback",                            (PyCFunction)TritonContext_rollback,                                  METH_O,                        ""},
+        {"run",                                 (PyCFunction)TritonContext_run,                                       METH_VARARGS,                  ""},
+        {"saturate",                            (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_saturate,  METH_VARARGS | METH_KEYWORDS,  ""},
+        {"saveSynthesisOracles",                (PyCFunction)TritonContext_saveSynthesisOracles,                      METH_O,                        ""},
+        {"serializeSymbolic",                   (PyCFunction)TritonContext_serializeSymbolic,                         METH_VARARGS,                  ""},
         {"setArchitecture",                     (PyCFunction)TritonContext_setArchitecture,                           METH_O,                        ""},
         {"setAstRepresentationMode",            (PyCFunction)TritonContext_setAstRepresentationMode,                  METH_O,                        ""},
         {"setConcreteMemoryAreaValue",          (PyCFunction)TritonContext_setConcreteMemoryAreaValue,                METH_VARARGS,                  ""},
@@ -3194,14 +4458,19 @@ namespace triton {
         {"setTaintRegister",                    (PyCFunction)TritonContext_setTaintRegister,                          METH_VARARGS,                  ""},
         {"setThumb",                            (PyCFunction)TritonContext_setThumb,                                  METH_O,                        ""},
         {"simplify",                            (PyCFunction)TritonContext_simplify,                                  METH_VARARGS,                  ""},
+        {"simplifyMba",                         (PyCFunction)TritonContext_simplifyMba,                               METH_O,                        ""},
         {"sliceExpressions",                    (PyCFunction)TritonContext_sliceExpressions,                          METH_O,                        ""},
         {"symbolizeExpression",                 (PyCFunction)TritonContext_symbolizeExpression,                       METH_VARARGS,                  ""},
         {"symbolizeMemory",                     (PyCFunction)TritonContext_symbolizeMemory,                           METH_VARARGS,                  ""},
         {"symbolizeRegister",                   (PyCFunction)TritonContext_symbolizeRegister,                         METH_VARARGS,                  ""},
+        {"synthesize",                          (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_synthesize, METH_VARARGS | METH_KEYWORDS,  ""},
+        {"takeSnapshot",                        (PyCFunction)TritonContext_takeSnapshot,                              METH_NOARGS,                   ""},
         {"taintAssignment",                     (PyCFunction)TritonContext_taintAssignment,                           METH_VARARGS,                  ""},
         {"taintMemory",                         (PyCFunction)TritonContext_taintMemory,                               METH_O,                        ""},
         {"taintRegister",                       (PyCFunction)TritonContext_taintRegister,                             METH_O,                        ""},
         {"taintUnion",                          (PyCFunction)TritonContext_taintUnion,                                METH_VARARGS,                  ""},
+        {"trimSymbolicExpressions",             (PyCFunction)TritonContext_trimSymbolicExpressions,                   METH_NOARGS,                   ""},
+        {"unmapConcreteMemoryArea",             (PyCFunction)TritonContext_unmapConcreteMemoryArea,                   METH_O,                        ""},
         {"untaintMemory",                       (PyCFunction)TritonContext_untaintMemory,                             METH_O,                        ""},
         {"untaintRegister",                     (PyCFunction)TritonContext_untaintRegister,                           METH_O,                        ""},
         {nullptr,                               nullptr,                                                              0,                             nullptr}
@@ -15,18 +15,48 @@ namespace triton {
   namespace callbacks {
 
     Callbacks::Callbacks(triton::API& api) : api(api) {
-      this->defined   = false;
-      this->mget      = false;
-      this->mload     = false;
-      this->mput      = false;
-      this->mstore    = false;
+      this->defined    = false;
+      this->mget       = false;
+      this->mload      = false;
+      this->mput       = false;
+      this->mstore     = false;
+      this->mloadArea  = false;
+      this->mstoreArea = false;
     }
 
 
-    void Callbacks::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&)> cb) {
+    std::pair<triton::uint64, triton::uint64> Callbacks::getWatchedRange(triton::uint64 baseAddr, triton::usize size) {
+      if (size == 0)
+        return std::make_pair(static_cast<triton::uint64>(0), static_cast<triton::uint64>(-1));
+
+      if (baseAddr + size - 1 < baseAddr)
+        throw triton::exceptions::Callbacks("Callbacks::addCallback(): The watched range wraps around the address space.");
+
+      return std::make_pair(baseAddr, baseAddr + size - 1);
+    }
+
+
+    void Callbacks::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&)> cb, triton::uint64 baseAddr, triton::usize size) {
+      auto range = Callbacks::getWatchedRange(baseAddr, size);
+
       switch (kind) {
         case triton::callbacks::GET_CONCRETE_MEMORY_VALUE:
-          this->getConcreteMemoryValueCallbacks.push_back(cb);
+          this->getConcreteMemoryValueCallbacks.push_back({cb, range.first, range.second});
+          break;
+
+        default:
+          return;
+      }
+      this->defined = true;
+    }
+
+
+    void Callbacks::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, triton::uint64, triton::usize)> cb, triton::uint64 baseAddr, triton::usize size) {
+      auto range = Callbacks::getWatchedRange(baseAddr, size);
+
+      switch (kind) {
+        case triton::callbacks::GET_CONCRETE_MEMORY_AREA_VALUE:
+          this->getConcreteMemoryAreaValueCallbacks.push_back({cb, range.first, range.second});
           break;
 
         default:
@@ -49,10 +79,27 @@ namespace triton {
     }
 
 
-    void Callbacks::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&, const triton::uint512& value)> cb) {
+    void Callbacks::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&, const triton::uint512& value)> cb, triton::uint64 baseAddr, triton::usize size) {
+      auto range = Callbacks::getWatchedRange(baseAddr, size);
+
       switch (kind) {
         case triton::callbacks::SET_CONCRETE_MEMORY_VALUE:
-          this->setConcreteMemoryValueCallbacks.push_back(cb);
+          this->setConcreteMemoryValueCallbacks.push_back({cb, range.first, range.second});
+          break;
+
+        default:
+          return;
+      }
+      this->defined = true;
+    }
+
+
+    void Callbacks::addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, triton::uint64, const triton::uint8*, triton::usize)> cb, triton::uint64 baseAddr, triton::usize size) {
+      auto range = Callbacks::getWatchedRange(baseAddr, size);
+
+      switch (kind) {
+        case triton::callbacks::SET_CONCRETE_MEMORY_AREA_VALUE:
+          this->setConcreteMemoryAreaValueCallbacks.push_back({cb, range.first, range.second});
           break;
 
         default:
@@ -89,8 +136,10 @@ namespace triton {
 
 
     void Callbacks::clearCallbacks(void) {
+      this->getConcreteMemoryAreaValueCallbacks.clear();
       this->getConcreteMemoryValueCallbacks.clear();
       this->getConcreteRegisterValueCallbacks.clear();
+      this->setConcreteMemoryAreaValueCallbacks.clear();
       this->setConcreteMemoryValueCallbacks.clear();
       this->setConcreteRegisterValueCallbacks.clear();
       this->symbolicSimplificationCallbacks.clear();
@@ -101,7 +150,23 @@ namespace triton {
     void Callbacks::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&)> cb) {
       switch (kind) {
         case triton::callbacks::GET_CONCRETE_MEMORY_VALUE:
-          this->getConcreteMemoryValueCallbacks.remove(cb);
+          this->getConcreteMemoryValueCallbacks.remove_if([&cb](const WatchedCallback<getConcreteMemoryValueCallback>& watched) { return watched.function == cb; });
+          break;
+
+        default:
+          break;
+      }
+
+      if (this->countCallbacks() == 0) {
+        this->defined = false;
+      }
+    }
+
+
+    void Callbacks::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, triton::uint64, triton::usize)> cb) {
+      switch (kind) {
+        case triton::callbacks::GET_CONCRETE_MEMORY_AREA_VALUE:
+          this->getConcreteMemoryAreaValueCallbacks.remove_if([&cb](const WatchedCallback<getConcreteMemoryAreaValueCallback>& watched) { return watched.function == cb; });
           break;
 
         default:
@@ -133,7 +198,23 @@ namespace triton {
     void Callbacks::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&, const triton::uint512& value)> cb) {
       switch (kind) {
         case triton::callbacks::SET_CONCRETE_MEMORY_VALUE:
-          this->setConcreteMemoryValueCallbacks.remove(cb);
+          this->setConcreteMemoryValueCallbacks.remove_if([&cb](const WatchedCallback<setConcreteMemoryValueCallback>& watched) { return watched.function == cb; });
+          break;
+
+        default:
+          break;
+      }
+
+      if (this->countCallbacks() == 0) {
+        this->defined = false;
+      }
+    }
+
+
+    void Callbacks::removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, triton::uint64, const triton::uint8*, triton::usize)> cb) {
+      switch (kind) {
+        case triton::callbacks::SET_CONCRETE_MEMORY_AREA_VALUE:
+          this->setConcreteMemoryAreaValueCallbacks.remove_if([&cb](const WatchedCallback<setConcreteMemoryAreaValueCallback>& watched) { return watched.function == cb; });
           break;
 
         default:
@@ -204,9 +285,11 @@ namespace triton {
             break;
           }
 
-          for (auto& function: this->getConcreteMemoryValueCallbacks) {
+          for (auto& watched: this->getConcreteMemoryValueCallbacks) {
+            if (!watched.watches(mem.getAddress(), mem.getSize()))
+              continue;
             this->mload = true;
-            function(this->api, mem);
+            watched.function(this->api, mem);
             if (mem.getLeaAst() != nullptr) {
               this->api.getSymbolicEngine()->initLeaAst(const_cast<triton::arch::MemoryAccess&>(mem));
             }
@@ -253,9 +336,11 @@ namespace triton {
             break;
           }
 
-          for (auto& function: this->setConcreteMemoryValueCallbacks) {
+          for (auto& watched: this->setConcreteMemoryValueCallbacks) {
+            if (!watched.watches(mem.getAddress(), mem.getSize()))
+              continue;
             this->mstore = true;
-            function(this->api, mem, value);
+            watched.function(this->api, mem, value);
             this->mstore = false;
           }
 
@@ -291,11 +376,63 @@ namespace triton {
     }
 
 
+    void Callbacks::processCallbacks(triton::callbacks::callback_e kind, triton::uint64 baseAddr, triton::usize size) {
+      switch (kind) {
+        case triton::callbacks::GET_CONCRETE_MEMORY_AREA_VALUE: {
+          /* Check if we are already in the callback to avoid infinite recursion */
+          if (this->mloadArea) {
+            break;
+          }
+
+          for (auto& watched: this->getConcreteMemoryAreaValueCallbacks) {
+            if (!watched.watches(baseAddr, size))
+              continue;
+            this->mloadArea = true;
+            watched.function(this->api, baseAddr, size);
+            this->mloadArea = false;
+          }
+
+          break;
+        }
+
+        default:
+          throw triton::exceptions::Callbacks("Callbacks::processCallbacks(): Invalid kind of callback for this C++ polymorphism.");
+      };
+    }
+
+
+    void Callbacks::processCallbacks(triton::callbacks::callback_e kind, triton::uint64 baseAddr, const triton::uint8* area, triton::usize size) {
+      switch (kind) {
+        case triton::callbacks::SET_CONCRETE_MEMORY_AREA_VALUE: {
+          /* Check if we are already in the callback to avoid infinite recursion */
+          if (this->mstoreArea) {
+            break;
+          }
+
+          for (auto& watched: this->setConcreteMemoryAreaValueCallbacks) {
+            if (!watched.watches(baseAddr, size))
+              continue;
+            this->mstoreArea = true;
+            watched.function(this->api, baseAddr, area, size);
+            this->mstoreArea = false;
+          }
+
+          break;
+        }
+
+        default:
+          throw triton::exceptions::Callbacks("Callbacks::processCallbacks(): Invalid kind of callback for this C++ polymorphism.");
+      };
+    }
+
+
     triton::usize Callbacks::countCallbacks(void) const {
       triton::usize count = 0;
 
+      count += this->getConcreteMemoryAreaValueCallbacks.size();
       count += this->getConcreteMemoryValueCallbacks.size();
       count += this->getConcreteRegisterValueCallbacks.size();
+      count += this->setConcreteMemoryAreaValueCallbacks.size();
       count += this->setConcreteMemoryValueCallbacks.size();
       count += this->setConcreteRegisterValueCallbacks.size();
       count += this->symbolicSimplificationCallbacks.size();
@@ -306,11 +443,13 @@ namespace triton {
 
     bool Callbacks::isDefined(triton::callbacks::callback_e kind) const {
       switch (kind) {
-        case GET_CONCRETE_MEMORY_VALUE:   return !this->getConcreteMemoryValueCallbacks.empty();
-        case GET_CONCRETE_REGISTER_VALUE: return !this->getConcreteRegisterValueCallbacks.empty();
-        case SET_CONCRETE_MEMORY_VALUE:   return !this->setConcreteMemoryValueCallbacks.empty();
-        case SET_CONCRETE_REGISTER_VALUE: return !this->setConcreteRegisterValueCallbacks.empty();
-        case SYMBOLIC_SIMPLIFICATION:     return !this->symbolicSimplificationCallbacks.empty();
+        case GET_CONCRETE_MEMORY_AREA_VALUE: return !this->getConcreteMemoryAreaValueCallbacks.empty();
+        case GET_CONCRETE_MEMORY_VALUE:      return !this->getConcreteMemoryValueCallbacks.empty();
+        case GET_CONCRETE_REGISTER_VALUE:    return !this->getConcreteRegisterValueCallbacks.empty();
+        case SET_CONCRETE_MEMORY_AREA_VALUE: return !this->setConcreteMemoryAreaValueCallbacks.empty();
+        case SET_CONCRETE_MEMORY_VALUE:      return !this->setConcreteMemoryValueCallbacks.empty();
+        case SET_CONCRETE_REGISTER_VALUE:    return !this->setConcreteRegisterValueCallbacks.empty();
+        case SYMBOLIC_SIMPLIFICATION:        return !this->symbolicSimplificationCallbacks.empty();
         default: {
           return false;
         }
@@ -318,6 +457,42 @@ namespace triton {
     }
 
 
+    bool Callbacks::isDefined(triton::callbacks::callback_e kind, triton::uint64 baseAddr, triton::usize size) const {
+      switch (kind) {
+        case GET_CONCRETE_MEMORY_VALUE:
+          for (const auto& watched : this->getConcreteMemoryValueCallbacks) {
+            if (watched.watches(baseAddr, size))
+              return true;
+          }
+          return false;
+
+        case GET_CONCRETE_MEMORY_AREA_VALUE:
+          for (const auto& watched : this->getConcreteMemoryAreaValueCallbacks) {
+            if (watched.watches(baseAddr, size))
+              return true;
+          }
+          return false;
+
+        case SET_CONCRETE_MEMORY_VALUE:
+          for (const auto& watched : this->setConcreteMemoryValueCallbacks) {
+            if (watched.watches(baseAddr, size))
+              return true;
+          }
+          return false;
+
+        case SET_CONCRETE_MEMORY_AREA_VALUE:
+          for (const auto& watched : this->setConcreteMemoryAreaValueCallbacks) {
+            if (watched.watches(baseAddr, size))
+              return true;
+          }
+          return false;
+
+        default:
+          return this->isDefined(kind);
+      }
+    }
+
+
     bool Callbacks::isDefined(void) const {
       return this->defined;
     }
@@ -0,0 +1,203 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <limits>
+
+#include <triton/exceptions.hpp>
+#include <triton/journal.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace snapshot {
+
+      Journal::Journal() {
+        this->enabled = false;
+      }
+
+
+      void Journal::enable(bool flag) {
+        this->enabled = flag;
+      }
+
+
+      triton::usize Journal::size(void) const {
+        return this->records.size();
+      }
+
+
+      void Journal::push(journal_e kind, triton::uint64 key, bool flag, triton::uint32 size) {
+        this->records.push_back({key, size, static_cast<triton::uint8>(kind), flag});
+      }
+
+
+      JournalEntry Journal::back(void) const {
+        if (this->records.empty())
+          throw triton::exceptions::SnapshotEngine("Journal::back(): The journal is empty.");
+
+        const Record& record = this->records.back();
+        JournalEntry entry = {static_cast<journal_e>(record.kind), record.key, record.flag, record.size, nullptr, &this->none, nullptr, nullptr, nullptr};
+
+        /* The payload of the most recent record is at the top of its stack */
+        switch (entry.kind) {
+          case JOURNAL_CONCRETE_MEMORY:
+            entry.values = this->bytes.data() + this->bytes.size() - record.size;
+            if (!record.flag)
+              entry.defined = this->defined.data() + this->defined.size() - record.size;
+            break;
+
+          case JOURNAL_CONCRETE_MEMORY_STATE:
+            entry.state = this->states.back().get();
+            break;
+
+          case JOURNAL_CONCRETE_REGISTER:
+          case JOURNAL_VARIABLE_VALUE:
+            entry.value = &this->values.back();
+            break;
+
+          case JOURNAL_SYMBOLIC_EXPRESSION_REMOVED:
+          case JOURNAL_SYMBOLIC_MEMORY:
+          case JOURNAL_SYMBOLIC_REGISTER:
+            if (record.flag)
+              entry.expr = &this->exprs.back();
+            break;
+
+          default:
+            break;
+        }
+
+        return entry;
+      }
+
+
+      void Journal::pop(void) {
+        if (this->records.empty())
+          throw triton::exceptions::SnapshotEngine("Journal::pop(): The journal is empty.");
+
+        const Record& record = this->records.back();
+        switch (record.kind) {
+          case JOURNAL_CONCRETE_MEMORY:
+            this->bytes.resize(this->bytes.size() - record.size);
+            if (!record.flag)
+              this->defined.resize(this->defined.size() - record.size);
+            break;
+
+          case JOURNAL_CONCRETE_MEMORY_STATE:
+            this->states.pop_back();
+            break;
+
+          case JOURNAL_CONCRETE_REGISTER:
+          case JOURNAL_VARIABLE_VALUE:
+            this->values.pop_back();
+            break;
+
+          case JOURNAL_SYMBOLIC_EXPRESSION_REMOVED:
+          case JOURNAL_SYMBOLIC_MEMORY:
+          case JOURNAL_SYMBOLIC_REGISTER:
+            if (record.flag)
+              this->exprs.pop_back();
+            break;
+
+          default:
+            break;
+        }
+
+        this->records.pop_back();
+      }
+
+
+      void Journal::clear(void) {
+        this->records.clear();
+        this->values.clear();
+        this->exprs.clear();
+        this->bytes.clear();
+        this->defined.clear();
+        this->states.clear();
+      }
+
+
+      void Journal::recordConcreteMemory(triton::uint64 baseAddr, const triton::uint8* values, const triton::uint8* defined, triton::usize size) {
+        /* A record holds at most 2^32-1 cells, larger ranges are split */
+        while (size) {
+          triton::uint32 chunk = static_cast<triton::uint32>(std::min<triton::usize>(size, std::numeric_limits<triton::uint32>::max()));
+
+          this->push(JOURNAL_CONCRETE_MEMORY, baseAddr, defined == nullptr, chunk);
+          this->bytes.insert(this->bytes.end(), values, values + chunk);
+          if (defined != nullptr) {
+            this->defined.insert(this->defined.end(), defined, defined + chunk);
+            defined += chunk;
+          }
+
+          baseAddr += chunk;
+          values   += chunk;
+          size     -= chunk;
+        }
+      }
+
+
+      void Journal::recordConcreteMemoryState(const triton::arch::ConcreteMemory& memory) {
+        this->push(JOURNAL_CONCRETE_MEMORY_STATE, 0, false);
+        this->states.push_back(std::make_shared<triton::arch::ConcreteMemory>(memory));
+      }
+
+
+      void Journal::recordConcreteRegister(triton::arch::register_e regId, const triton::uint512& value) {
+        this->push(JOURNAL_CONCRETE_REGISTER, regId, false);
+        this->values.push_back(value);
+      }
+
+
+      void Journal::recordSymbolicExpression(triton::usize id) {
+        this->push(JOURNAL_SYMBOLIC_EXPRESSION, id, false);
+      }
+
+
+      void Journal::recordSymbolicExpressionRemoved(const triton::engines::symbolic::SharedSymbolicExpression& expr) {
+        this->push(JOURNAL_SYMBOLIC_EXPRESSION_REMOVED, expr->getId(), true);
+        this->exprs.push_back(expr);
+      }
+
+
+      void Journal::recordSymbolicMemory(triton::uint64 addr, const triton::engines::symbolic::SharedSymbolicExpression& expr) {
+        this->push(JOURNAL_SYMBOLIC_MEMORY, addr, expr != nullptr);
+        if (expr != nullptr)
+          this->exprs.push_back(expr);
+      }
+
+
+      void Journal::recordSymbolicRegister(triton::arch::register_e regId, const triton::engines::symbolic::SharedSymbolicExpression& expr) {
+        this->push(JOURNAL_SYMBOLIC_REGISTER, regId, expr != nullptr);
+        if (expr != nullptr)
+          this->exprs.push_back(expr);
+      }
+
+
+      void Journal::recordSymbolicVariable(triton::usize id) {
+        this->push(JOURNAL_SYMBOLIC_VARIABLE, id, false);
+      }
+
+
+      void Journal::recordTaintedMemory(triton::uint64 addr, bool tainted) {
+        this->push(JOURNAL_TAINTED_MEMORY, addr, tainted);
+      }
+
+
+      void Journal::recordTaintedRegister(triton::arch::register_e regId, bool tainted) {
+        this->push(JOURNAL_TAINTED_REGISTER, regId, tainted);
+      }
+
+
+      void Journal::recordVariableValue(triton::usize id, const triton::uint512& value) {
+        this->push(JOURNAL_VARIABLE_VALUE, id, false);
+        this->values.push_back(value);
+      }
+
+    };
+  };
+};
@@ -0,0 +1,218 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <new>
+
+#include <triton/aarch64Cpu.hpp>
+#include <triton/arm32Cpu.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/snapshotEngine.hpp>
+#include <triton/x8664Cpu.hpp>
+#include <triton/x86Cpu.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace snapshot {
+
+      Snapshot::Snapshot(triton::arch::Architecture& arch,
+                         const triton::engines::symbolic::SymbolicEngine& symbolic,
+                         const triton::engines::taint::TaintEngine& taint,
+                         const triton::ast::AstContext& astCtxt)
+        : arch(arch.getArchitecture()),
+          symbolic(symbolic),
+          taint(taint),
+          variables(astCtxt.getVariables()) {
+
+        triton::arch::CpuInterface* cpu = arch.getCpuInstance();
+
+        switch (this->arch) {
+          case triton::arch::ARCH_X86_64:
+            this->cpu.reset(new(std::nothrow) triton::arch::x86::x8664Cpu(*static_cast<triton::arch::x86::x8664Cpu*>(cpu)));
+            break;
+
+          case triton::arch::ARCH_X86:
+            this->cpu.reset(new(std::nothrow) triton::arch::x86::x86Cpu(*static_cast<triton::arch::x86::x86Cpu*>(cpu)));
+            break;
+
+          case triton::arch::ARCH_AARCH64:
+            this->cpu.reset(new(std::nothrow) triton::arch::arm::aarch64::AArch64Cpu(*static_cast<triton::arch::arm::aarch64::AArch64Cpu*>(cpu)));
+            break;
+
+          case triton::arch::ARCH_ARM32:
+            this->cpu.reset(new(std::nothrow) triton::arch::arm::arm32::Arm32Cpu(*static_cast<triton::arch::arm::arm32::Arm32Cpu*>(cpu)));
+            break;
+
+          default:
+            throw triton::exceptions::SnapshotEngine("Snapshot::Snapshot(): Architecture not supported.");
+        }
+
+        if (this->cpu == nullptr)
+          throw triton::exceptions::SnapshotEngine("Snapshot::Snapshot(): Not enough memory.");
+      }
+
+
+      void Snapshot::restore(triton::arch::Architecture& arch,
+                             triton::engines::symbolic::SymbolicEngine& symbolic,
+                             triton::engines::taint::TaintEngine& taint,
+                             triton::ast::AstContext& astCtxt) const {
+
+        if (arch.getArchitecture() != this->arch)
+          throw triton::exceptions::SnapshotEngine("Snapshot::restore(): The architecture has changed since the snapshot.");
+
+        triton::arch::CpuInterface* cpu = arch.getCpuInstance();
+
+        switch (this->arch) {
+          case triton::arch::ARCH_X86_64:
+            *static_cast<triton::arch::x86::x8664Cpu*>(cpu) = *static_cast<const triton::arch::x86::x8664Cpu*>(this->cpu.get());
+            break;
+
+          case triton::arch::ARCH_X86:
+            *static_cast<triton::arch::x86::x86Cpu*>(cpu) = *static_cast<const triton::arch::x86::x86Cpu*>(this->cpu.get());
+            break;
+
+          case triton::arch::ARCH_AARCH64:
+            *static_cast<triton::arch::arm::aarch64::AArch64Cpu*>(cpu) = *static_cast<const triton::arch::arm::aarch64::AArch64Cpu*>(this->cpu.get());
+            break;
+
+          case triton::arch::ARCH_ARM32:
+            *static_cast<triton::arch::arm::arm32::Arm32Cpu*>(cpu) = *static_cast<const triton::arch::arm::arm32::Arm32Cpu*>(this->cpu.get());
+            break;
+
+          default:
+            throw triton::exceptions::SnapshotEngine("Snapshot::restore(): Architecture not supported.");
+        }
+
+        symbolic = this->symbolic;
+        taint    = this->taint;
+        astCtxt.setVariables(this->variables);
+
+        /* The cached unrolled ASTs may describe expressions which are replaced */
+        astCtxt.clearUnrolledAsts();
+      }
+
+
+      SnapshotEngine::SnapshotEngine(triton::arch::Architecture* architecture,
+                                     triton::engines::symbolic::SymbolicEngine* symbolicEngine,
+                                     triton::engines::taint::TaintEngine* taintEngine,
+                                     const triton::ast::SharedAstContext& astCtxt,
+                                     triton::engines::snapshot::Journal* journal)
+        : architecture(architecture),
+          symbolicEngine(symbolicEngine),
+          taintEngine(taintEngine),
+          journal(journal),
+          astCtxt(astCtxt),
+          uniqueSnapshotId(0) {
+
+        if (this->architecture == nullptr || this->symbolicEngine == nullptr || this->taintEngine == nullptr || this->astCtxt == nullptr || this->journal == nullptr)
+          throw triton::exceptions::SnapshotEngine("SnapshotEngine::SnapshotEngine(): The engines cannot be null.");
+      }
+
+
+      triton::usize SnapshotEngine::takeSnapshot(void) {
+        std::unique_ptr<Snapshot> snapshot(new(std::nothrow) Snapshot(*this->architecture, *this->symbolicEngine, *this->taintEngine, *this->astCtxt));
+        if (snapshot == nullptr)
+          throw triton::exceptions::SnapshotEngine("SnapshotEngine::takeSnapshot(): Not enough memory.");
+
+        triton::usize id = this->uniqueSnapshotId++;
+        this->snapshots[id] = std::move(snapshot);
+        return id;
+      }
+
+
+      void SnapshotEngine::restoreSnapshot(triton::usize id) {
+        auto it = this->snapshots.find(id);
+        if (it == this->snapshots.end())
+          throw triton::exceptions::SnapshotEngine("SnapshotEngine::restoreSnapshot(): Snapshot not found.");
+
+        /* The journal describes the state which is replaced */
+        this->clearCheckpoints();
+        it->second->restore(*this->architecture, *this->symbolicEngine, *this->taintEngine, *this->astCtxt);
+      }
+
+
+      void SnapshotEngine::removeSnapshot(triton::usize id) {
+        if (this->snapshots.erase(id) == 0)
+          throw triton::exceptions::SnapshotEngine("SnapshotEngine::removeSnapshot(): Snapshot not found.");
+      }
+
+
+      bool SnapshotEngine::isSnapshot(triton::usize id) const {
+        return (this->snapshots.find(id) != this->snapshots.end());
+      }
+
+
+      triton::usize SnapshotEngine::getNumberOfSnapshots(void) const {
+        return this->snapshots.size();
+      }
+
+
+      triton::usize SnapshotEngine::checkpoint(void) {
+        this->checkpoints.emplace_back(this->journal->size(), *this->symbolicEngine);
+        this->journal->enable(true);
+        return this->checkpoints.size() - 1;
+      }
+
+
+      void SnapshotEngine::rollback(triton::usize id) {
+        if (id >= this->checkpoints.size())
+          throw triton::exceptions::SnapshotEngine("SnapshotEngine::rollback(): Checkpoint not found.");
+
+        /* Undo entries must not be recorded again */
+        this->journal->enable(false);
+
+        while (this->journal->size() > this->checkpoints[id].first) {
+          JournalEntry entry = this->journal->back();
+
+          switch (entry.kind) {
+            case JOURNAL_CONCRETE_MEMORY:
+            case JOURNAL_CONCRETE_MEMORY_STATE:
+            case JOURNAL_CONCRETE_REGISTER:
+              this->architecture->undo(entry);
+              break;
+
+            case JOURNAL_TAINTED_MEMORY:
+            case JOURNAL_TAINTED_REGISTER:
+              this->taintEngine->undo(entry);
+              break;
+
+            default:
+              this->symbolicEngine->undo(entry);
+              break;
+          }
+
+          this->journal->pop();
+        }
+
+        static_cast<triton::engines::symbolic::PathManager&>(*this->symbolicEngine) = this->checkpoints[id].second;
+        this->astCtxt->clearUnrolledAsts();
+        this->checkpoints.erase(this->checkpoints.begin() + id + 1, this->checkpoints.end());
+        this->journal->enable(true);
+      }
+
+
+      void SnapshotEngine::clearCheckpoints(void) {
+        this->checkpoints.clear();
+        this->journal->clear();
+        this->journal->enable(false);
+      }
+
+
+      triton::usize SnapshotEngine::getNumberOfCheckpoints(void) const {
+        return this->checkpoints.size();
+      }
+
+
+      void SnapshotEngine::clear(void) {
+        this->snapshots.clear();
+        this->clearCheckpoints();
+      }
+
+    };
+  };
+};
@@ -0,0 +1,609 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <limits>
+#include <stack>
+#include <utility>
+
+#include <triton/astContext.hpp>
+#include <triton/eGraph.hpp>
+#include <triton/exceptions.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace symbolic {
+
+      /* Marks a variable which is not bound yet */
+      static const triton::usize unbound = std::numeric_limits<triton::usize>::max();
+
+      /* An infinite cost */
+      static const triton::usize infinite = std::numeric_limits<triton::usize>::max();
+
+      /* The maximum number of matches of a rule applied per iteration, so that no rule floods the e-graph */
+      static const triton::usize maxMatches = 1000;
+
+      /* The initial number of iterations a rule is banned for after reaching maxMatches */
+      static const triton::usize banIterations = 2;
+
+
+      /* The rules used by default. Each one must hold for any size. */
+      static const char* defaultRules = R"rules(
+        ; Boolean algebra
+        (bvand x x)                        -> x
+        (bvor x x)                         -> x
+        (bvxor x x)                        -> 0
+        (bvand x 0)                        -> 0
+        (bvand x -1)                       -> x
+        (bvor x 0)                         -> x
+        (bvor x -1)                        -> -1
+        (bvxor x 0)                        -> x
+        (bvxor x -1)                       -> (bvnot x)
+        (bvnot (bvnot x))                  -> x
+        (bvand x (bvnot x))                -> 0
+        (bvor x (bvnot x))                 -> -1
+        (bvxor x (bvnot x))                -> -1
+        (bvand x (bvor x y))               -> x
+        (bvor x (bvand x y))               -> x
+        (bvnot (bvand x y))                -> (bvor (bvnot x) (bvnot y))
+        (bvnot (bvor x y))                 -> (bvand (bvnot x) (bvnot y))
+        (bvnand x y)                       -> (bvnot (bvand x y))
+        (bvnor x y)                        -> (bvnot (bvor x y))
+        (bvxnor x y)                       -> (bvnot (bvxor x y))
+        (bvxor (bvnot x) (bvnot y))        -> (bvxor x y)
+        (bvor (bvand x (bvnot y)) (bvand (bvnot x) y)) -> (bvxor x y)
+        (bvand (bvand x y) z)              -> (bvand x (bvand y z))
+        (bvor (bvor x y) z)                -> (bvor x (bvor y z))
+        (bvxor (bvxor x y) z)              -> (bvxor x (bvxor y z))
+
+        ; Arithmetic
+        (bvadd x 0)                        -> x
+        (bvsub x 0)                        -> x
+        (bvsub x x)                        -> 0
+        (bvmul x 0)                        -> 0
+        (bvmul x 1)                        -> x
+        (bvneg (bvneg x))                  -> x
+        (bvsub x y)                        -> (bvadd x (bvneg y))
+        (bvadd x (bvneg y))                -> (bvsub x y)
+        (bvadd x (bvneg x))                -> 0
+        (bvneg x)                          -> (bvadd (bvnot x) 1)
+        (bvadd (bvnot x) 1)                -> (bvneg x)
+        (bvnot x)                          -> (bvsub -1 x)
+        (bvsub -1 x)                       -> (bvnot x)
+        (bvadd x x)                        -> (bvmul 2 x)
+        (bvadd (bvadd x y) z)              -> (bvadd x (bvadd y z))
+        (bvmul (bvmul x y) z)              -> (bvmul x (bvmul y z))
+        (bvadd (bvmul x y) (bvmul x z))    -> (bvmul x (bvadd y z))
+        (bvneg (bvmul x y))                -> (bvmul x (bvneg y))
+
+        ; Mixed boolean-arithmetic
+        (bvsub (bvadd x y) (bvand x y))    -> (bvor x y)
+        (bvsub (bvadd x y) (bvor x y))     -> (bvand x y)
+        (bvsub (bvor x y) (bvand x y))     -> (bvxor x y)
+        (bvsub (bvor x y) (bvxor x y))     -> (bvand x y)
+        (bvadd (bvxor x y) (bvand x y))    -> (bvor x y)
+        (bvadd (bvor x y) (bvand x y))     -> (bvadd x y)
+        (bvadd (bvxor x y) (bvmul 2 (bvand x y))) -> (bvadd x y)
+        (bvsub (bvmul 2 (bvor x y)) (bvxor x y))  -> (bvadd x y)
+        (bvsub (bvadd x y) (bvmul 2 (bvand x y))) -> (bvxor x y)
+        (bvsub x (bvand x y))              -> (bvand x (bvnot y))
+        (bvsub (bvor x y) y)               -> (bvand x (bvnot y))
+        (bvadd (bvand x (bvnot y)) y)      -> (bvor x y)
+        (bvadd (bvand x (bvnot y)) (bvand x y)) -> x
+        (bvxor x y)                        -> (bvsub (bvor x y) (bvand x y))
+      )rules";
+
+
+      bool EGraph::ENode::operator==(const ENode& other) const {
+        return this->op == other.op &&
+               this->size == other.size &&
+               this->value == other.value &&
+               this->origin == other.origin &&
+               this->children == other.children;
+      }
+
+
+      std::size_t EGraph::ENodeHash::operator()(const ENode& node) const {
+        std::size_t hash = std::hash<triton::uint32>()(node.op) ^ (std::hash<triton::uint32>()(node.size) << 1);
+
+        hash = hash * 31 + std::hash<triton::uint64>()(static_cast<triton::uint64>(node.value));
+        hash = hash * 31 + std::hash<triton::ast::AbstractNode*>()(node.origin.get());
+        for (triton::usize child : node.children)
+          hash = hash * 31 + std::hash<triton::usize>()(child);
+
+        return hash;
+      }
+
+
+      EGraph::EGraph(const RewriteEngine& rules, triton::usize nodeLimit, triton::usize timeLimit)
+        : rules(rules) {
+        if (nodeLimit == 0 && timeLimit == 0)
+          throw triton::exceptions::SymbolicSimplification("EGraph::EGraph(): The node limit and the time limit cannot be both unlimited.");
+
+        this->nodeLimit = nodeLimit;
+        this->timeLimit = timeLimit;
+        this->start     = std::chrono::steady_clock::now();
+      }
+
+
+      std::string EGraph::getDefaultRules(void) {
+        return defaultRules;
+      }
+
+
+      triton::usize EGraph::getNumberOfNodes(void) const {
+        return this->nodes.size();
+      }
+
+
+      triton::usize EGraph::find(triton::usize eclass) {
+        while (this->parents[eclass] != eclass) {
+          this->parents[eclass] = this->parents[this->parents[eclass]];
+          eclass = this->parents[eclass];
+        }
+        return eclass;
+      }
+
+
+      bool EGraph::merge(triton::usize a, triton::usize b) {
+        a = this->find(a);
+        b = this->find(b);
+
+        if (a == b)
+          return false;
+
+        if (this->classes[a].nodes.size() < this->classes[b].nodes.size())
+          std::swap(a, b);
+
+        EClass& root  = this->classes[a];
+        EClass& other = this->classes[b];
+
+        this->parents[b] = a;
+        root.nodes.insert(root.nodes.end(), other.nodes.begin(), other.nodes.end());
+        other.nodes.clear();
+
+        if (!root.constant && other.constant) {
+          root.constant = true;
+          root.value    = other.value;
+        }
+
+        return true;
+      }
+
+
+      triton::usize EGraph::addNode(ENode node) {
+        for (auto& child : node.children)
+          child = this->find(child);
+
+        auto it = this->hashcons.find(node);
+        if (it != this->hashcons.end())
+          return this->find(it->second);
+
+        triton::usize id = this->classes.size();
+        EClass eclass;
+
+        eclass.nodes.push_back(this->nodes.size());
+        eclass.size     = node.size;
+        eclass.constant = (node.op == triton::ast::BV_NODE && node.origin == nullptr);
+        eclass.value    = node.value;
+
+        this->hashcons[node] = id;
+        this->nodes.push_back(node);
+        this->owners.push_back(id);
+        this->classes.push_back(eclass);
+        this->parents.push_back(id);
+
+        this->fold(this->nodes.size() - 1);
+
+        return this->find(id);
+      }
+
+
+      triton::usize EGraph::addConstant(const triton::uint512& value, triton::uint32 size) {
+        ENode node;
+
+        node.op    = triton::ast::BV_NODE;
+        node.value = value;
+        node.size  = size;
+
+        return this->addNode(node);
+      }
+
+
+      bool EGraph::fold(triton::usize id) {
+        std::vector<triton::ast::SharedAbstractNode> operands;
+        triton::ast::ast_e op = this->nodes[id].op;
+        triton::uint32 size   = this->nodes[id].size;
+
+        if (!RewriteEngine::isOperator(op) || this->classes[this->find(this->owners[id])].constant)
+          return false;
+
+        for (triton::usize child : this->nodes[id].children) {
+          const EClass& eclass = this->classes[this->find(child)];
+          if (!eclass.constant)
+            return false;
+          operands.push_back(this->ctxt->bv(eclass.value, eclass.size));
+        }
+
+        /* The semantics of the operators are the ones of the AST */
+        triton::uint512 value = RewriteEngine::buildNode(this->ctxt, op, operands)->evaluate();
+        triton::usize eclass  = this->addConstant(value, size);
+
+        return this->merge(this->owners[id], eclass);
+      }
+
+
+      void EGraph::rebuild(void) {
+        bool changed = true;
+
+        /* Merge the congruent nodes until nothing changes */
+        while (changed) {
+          changed = false;
+          this->hashcons.clear();
+
+          for (triton::usize id = 0; id < this->nodes.size(); id++) {
+            for (auto& child : this->nodes[id].children)
+              child = this->find(child);
+
+            triton::usize owner = this->find(this->owners[id]);
+            auto it = this->hashcons.find(this->nodes[id]);
+            if (it == this->hashcons.end())
+              this->hashcons[this->nodes[id]] = owner;
+            else
+              changed |= this->merge(owner, it->second);
+          }
+
+          for (triton::usize id = 0; id < this->nodes.size(); id++)
+            changed |= this->fold(id);
+        }
+
+        /* Drop the duplicated nodes */
+        std::vector<ENode> nodes;
+        std::vector<triton::usize> owners;
+
+        for (auto& eclass : this->classes)
+          eclass.nodes.clear();
+
+        for (triton::usize id = 0; id < this->nodes.size(); id++) {
+          triton::usize owner = this->find(this->owners[id]);
+          auto it = this->hashcons.find(this->nodes[id]);
+          if (it == this->hashcons.end() || it->second == unbound)
+            continue;
+          it->second = unbound;
+          this->classes[owner].nodes.push_back(nodes.size());
+          nodes.push_back(this->nodes[id]);
+          owners.push_back(owner);
+        }
+
+        this->nodes.swap(nodes);
+        this->owners.swap(owners);
+
+        this->hashcons.clear();
+        for (triton::usize id = 0; id < this->nodes.size(); id++)
+          this->hashcons[this->nodes[id]] = this->owners[id];
+      }
+
+
+      bool EGraph::isOverBudget(void) const {
+        if (this->nodeLimit && this->nodes.size() >= this->nodeLimit)
+          return true;
+
+        if (this->timeLimit) {
+          auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - this->start);
+          if (static_cast<triton::usize>(elapsed.count()) >= this->timeLimit)
+            return true;
+        }
+
+        return false;
+      }
+
+
+      triton::usize EGraph::add(const triton::ast::SharedAbstractNode& node) {
+        std::unordered_map<triton::ast::AbstractNode*, triton::usize> eclasses;
+
+        if (node == nullptr)
+          throw triton::exceptions::SymbolicSimplification("EGraph::add(): node cannot be null.");
+
+        if (this->ctxt == nullptr)
+          this->ctxt = node->getContext();
+
+        for (const auto& n : triton::ast::childrenExtraction(node, false /* unroll */, true /* revert */)) {
+          ENode enode;
+
+          enode.op    = n->getType();
+          enode.size  = n->getBitvectorSize();
+          enode.value = 0;
+
+          if (enode.op == triton::ast::BV_NODE) {
+            enode.value = n->evaluate();
+          }
+          else {
+            for (const auto& child : n->getChildren())
+              enode.children.push_back(eclasses.at(child.get()));
+            if (!RewriteEngine::isOperator(enode.op))
+              enode.origin = n;
+          }
+
+          eclasses[n.get()] = this->addNode(enode);
+        }
+
+        this->rebuild();
+
+        return this->find(eclasses.at(node.get()));
+      }
+
+
+      void EGraph::match(std::vector<std::pair<triton::usize, triton::usize>>& pending, Substitution& subst, std::vector<Substitution>& out, triton::usize limit) {
+        if (out.size() >= limit)
+          return;
+
+        if (pending.empty()) {
+          out.push_back(subst);
+          return;
+        }
+
+        auto top = pending.back();
+        const RewriteEngine::Term& term = this->rules.terms[top.first];
+        triton::usize eclass = this->find(top.second);
+
+        pending.pop_back();
+
+        switch (term.kind) {
+          case RewriteEngine::TERM_VARIABLE:
+            if (subst[term.index] == unbound) {
+              subst[term.index] = eclass;
+              this->match(pending, subst, out, limit);
+              subst[term.index] = unbound;
+            }
+            else if (this->find(subst[term.index]) == eclass) {
+              this->match(pending, subst, out, limit);
+            }
+            break;
+
+          case RewriteEngine::TERM_LITERAL: {
+            const EClass& c = this->classes[eclass];
+            if (c.constant && c.value == this->rules.getLiteral(term.index, c.size))
+              this->match(pending, subst, out, limit);
+            break;
+          }
+
+          case RewriteEngine::TERM_OPERATOR:
+            for (triton::usize id = 0; id < this->classes[eclass].nodes.size() && out.size() < limit; id++) {
+              const ENode& node = this->nodes[this->classes[eclass].nodes[id]];
+
+              if (node.op != term.op || node.origin != nullptr || node.children.size() != term.children.size())
+                continue;
+
+              /* Commutative operators are matched in both orders */
+              triton::usize orders = 1;
+              if (RewriteEngine::isCommutative(node.op) && node.children.size() == 2 && node.children[0] != node.children[1])
+                orders = 2;
+
+              for (triton::usize order = 0; order < orders; order++) {
+                /* The children are matched from left to right */
+                for (triton::usize i = node.children.size(); i-- > 0;)
+                  pending.push_back(std::make_pair(term.children[i], node.children[order ? node.children.size() - 1 - i : i]));
+                this->match(pending, subst, out, limit);
+                pending.resize(pending.size() - node.children.size());
+              }
+            }
+            break;
+        }
+
+        pending.push_back(top);
+      }
+
+
+      triton::usize EGraph::instantiate(triton::usize index, const Substitution& subst, triton::uint32 size) {
+        const RewriteEngine::Term& term = this->rules.terms[index];
+
+        switch (term.kind) {
+          case RewriteEngine::TERM_VARIABLE:
+            return this->find(subst[term.index]);
+
+          case RewriteEngine::TERM_LITERAL:
+            return this->addConstant(this->rules.getLiteral(term.index, size), size);
+
+          default: {
+            ENode node;
+            node.op    = term.op;
+            node.size  = size;
+            node.value = 0;
+            for (triton::usize child : term.children)
+              node.children.push_back(this->instantiate(child, subst, size));
+            return this->addNode(node);
+          }
+        }
+      }
+
+
+      bool EGraph::saturate(void) {
+        /* A rule reaching maxMatches is banned for a number of iterations which doubles each time */
+        std::vector<triton::usize> bannedUntil(this->rules.rules.size(), 0);
+        std::vector<triton::usize> banLength(this->rules.rules.size(), banIterations);
+
+        this->start = std::chrono::steady_clock::now();
+
+        for (triton::usize iteration = 0; !this->isOverBudget(); iteration++) {
+          std::vector<std::pair<triton::usize, Substitution>> matches;
+          std::vector<triton::usize> roots;
+          bool banned = false;
+
+          /* Search all the matches before modifying the e-graph */
+          for (triton::usize r = 0; r < this->rules.rules.size() && !this->isOverBudget(); r++) {
+            const auto& rule = this->rules.rules[r];
+            triton::usize found = 0;
+
+            if (bannedUntil[r] > iteration) {
+              banned = true;
+              continue;
+            }
+
+            for (triton::usize eclass = 0; eclass < this->classes.size() && found < maxMatches && !this->isOverBudget(); eclass++) {
+              if (this->parents[eclass] != eclass)
+                continue;
+              std::vector<std::pair<triton::usize, triton::usize>> pending(1, std::make_pair(rule.lhs, eclass));
+              Substitution bindings(rule.variables, unbound);
+              std::vector<Substitution> out;
+              this->match(pending, bindings, out, maxMatches - found);
+              found += out.size();
+              for (auto& subst : out) {
+                matches.push_back(std::make_pair(r, std::move(subst)));
+                roots.push_back(eclass);
+              }
+            }
+
+            if (found >= maxMatches) {
+              bannedUntil[r] = iteration + 1 + banLength[r];
+              banLength[r] *= 2;
+            }
+          }
+
+          triton::usize count = this->nodes.size();
+          bool merged = false;
+
+          for (triton::usize i = 0; i < matches.size() && !this->isOverBudget(); i++) {
+            triton::usize eclass = this->find(roots[i]);
+            triton::usize rhs = this->instantiate(this->rules.rules[matches[i].first].rhs, matches[i].second, this->classes[eclass].size);
+            merged |= this->merge(eclass, rhs);
+          }
+
+          bool grown = (this->nodes.size() != count);
+          this->rebuild();
+
+          if (!merged && !grown) {
+            if (!banned)
+              return true;
+            /* Nothing changed without the banned rules, give them another chance */
+            std::fill(bannedUntil.begin(), bannedUntil.end(), 0);
+          }
+        }
+
+        return false;
+      }
+
+
+      triton::usize EGraph::getCost(const ENode& node, triton::engines::symbolic::cost_e cost) {
+        if (cost == SIZE_COST)
+          return 1;
+
+        switch (node.op) {
+          case triton::ast::BVAND_NODE:
+          case triton::ast::BVNAND_NODE:
+          case triton::ast::BVNOR_NODE:
+          case triton::ast::BVNOT_NODE:
+          case triton::ast::BVOR_NODE:
+          case triton::ast::BVXNOR_NODE:
+          case triton::ast::BVXOR_NODE:
+            return 1;
+
+          case triton::ast::BVADD_NODE:
+          case triton::ast::BVNEG_NODE:
+          case triton::ast::BVSUB_NODE:
+            return 2;
+
+          case triton::ast::BVASHR_NODE:
+          case triton::ast::BVLSHR_NODE:
+          case triton::ast::BVSHL_NODE:
+            return 4;
+
+          /* A multiplication by a constant is linear */
+          case triton::ast::BVMUL_NODE:
+            for (triton::usize child : node.children) {
+              if (this->classes[this->find(child)].constant)
+                return 2;
+            }
+            return 8;
+
+          case triton::ast::BVSDIV_NODE:
+          case triton::ast::BVSMOD_NODE:
+          case triton::ast::BVSREM_NODE:
+          case triton::ast::BVUDIV_NODE:
+          case triton::ast::BVUREM_NODE:
+            return 16;
+
+          default:
+            return node.children.empty() ? 1 : 2;
+        }
+      }
+
+
+      triton::ast::SharedAbstractNode EGraph::extract(triton::usize eclass, triton::engines::symbolic::cost_e cost) {
+        std::vector<triton::usize> costs(this->classes.size(), infinite);
+        std::vector<triton::usize> choices(this->classes.size(), unbound);
+        std::unordered_map<triton::usize, triton::ast::SharedAbstractNode> built;
+        std::stack<std::pair<triton::usize, bool>> worklist;
+        bool changed = true;
+
+        if (eclass >= this->classes.size())
+          throw triton::exceptions::SymbolicSimplification("EGraph::extract(): Invalid e-class.");
+
+        /* Cost of the cheapest AST of each e-class */
+        while (changed) {
+          changed = false;
+          for (triton::usize id = 0; id < this->nodes.size(); id++) {
+            triton::usize owner = this->find(this->owners[id]);
+            triton::usize total = this->getCost(this->nodes[id], cost);
+            for (triton::usize child : this->nodes[id].children) {
+              triton::usize c = costs[this->find(child)];
+              total = (c == infinite || total > infinite - c) ? infinite : total + c;
+            }
+            if (total < costs[owner]) {
+              costs[owner]   = total;
+              choices[owner] = id;
+              changed        = true;
+            }
+          }
+        }
+
+        /* Build the chosen nodes, children first. A child is always cheaper than its parent. */
+        worklist.push(std::make_pair(this->find(eclass), false));
+        while (!worklist.empty()) {
+          triton::usize c = worklist.top().first;
+          bool postorder  = worklist.top().second;
+          worklist.pop();
+
+          if (built.find(c) != built.end())
+            continue;
+
+          if (choices[c] == unbound)
+            throw triton::exceptions::SymbolicSimplification("EGraph::extract(): E-class without finite cost.");
+
+          const ENode& node = this->nodes[choices[c]];
+
+          if (!postorder) {
+            worklist.push(std::make_pair(c, true));
+            for (triton::usize child : node.children)
+              worklist.push(std::make_pair(this->find(child), false));
+            continue;
+          }
+
+          std::vector<triton::ast::SharedAbstractNode> children;
+          for (triton::usize child : node.children)
+            children.push_back(built.at(this->find(child)));
+
+          if (node.origin == nullptr && node.op == triton::ast::BV_NODE)
+            built[c] = this->ctxt->bv(node.value, node.size);
+
+          else if (node.origin == nullptr)
+            built[c] = RewriteEngine::buildNode(this->ctxt, node.op, children);
+
+          else if (children == node.origin->getChildren())
+            built[c] = node.origin;
+
+          else
+            built[c] = triton::ast::newInstance(node.origin.get(), children);
+        }
+
+        return built.at(this->find(eclass));
+      }
+
+    }; /* symbolic namespace */
+  }; /* engines namespace */
+}; /*triton namespace */
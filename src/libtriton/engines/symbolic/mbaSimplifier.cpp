@@ -0,0 +1,624 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <stack>
+#include <unordered_set>
+#include <utility>
+
+#include <triton/astContext.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/mbaSimplifier.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace symbolic {
+
+      /* The maximum number of combinations tried by the enumeration of the bitwise expressions */
+      static const triton::usize maxWork = 1 << 20;
+
+
+      /* Returns the number of nodes of an AST, without the atoms */
+      static triton::usize countNodes(triton::ast::AbstractNode* node, const std::unordered_set<triton::ast::AbstractNode*>& atoms) {
+        std::unordered_set<triton::ast::AbstractNode*> visited;
+        std::stack<triton::ast::AbstractNode*> worklist;
+
+        worklist.push(node);
+        while (!worklist.empty()) {
+          auto current = worklist.top();
+          worklist.pop();
+
+          if (atoms.find(current) != atoms.end() || !visited.insert(current).second)
+            continue;
+
+          /* A constant is one node */
+          if (current->getType() == triton::ast::BV_NODE)
+            continue;
+
+          for (const auto& child : current->getChildren())
+            worklist.push(child.get());
+        }
+
+        return visited.size();
+      }
+
+
+      /* Returns coef * expr */
+      static triton::ast::SharedAbstractNode multiply(const triton::ast::SharedAstContext& ctxt, const triton::uint512& coef, const triton::ast::SharedAbstractNode& expr) {
+        if (coef == 1)
+          return expr;
+
+        if (coef == expr->getBitvectorMask())
+          return ctxt->bvneg(expr);
+
+        return ctxt->bvmul(ctxt->bv(coef, expr->getBitvectorSize()), expr);
+      }
+
+
+      /* Returns the sum of coef * expr for each term, plus a constant */
+      static triton::ast::SharedAbstractNode sum(const triton::ast::SharedAstContext& ctxt, const std::vector<std::pair<triton::uint512, triton::ast::SharedAbstractNode>>& terms, const triton::uint512& constant, triton::uint32 size) {
+        triton::ast::SharedAbstractNode node = nullptr;
+
+        for (const auto& term : terms) {
+          if (node == nullptr)
+            node = multiply(ctxt, term.first, term.second);
+          else if (term.first == term.second->getBitvectorMask())
+            node = ctxt->bvsub(node, term.second);
+          else
+            node = ctxt->bvadd(node, multiply(ctxt, term.first, term.second));
+        }
+
+        if (node == nullptr)
+          return ctxt->bv(constant, size);
+
+        if (constant != 0)
+          node = ctxt->bvadd(node, ctxt->bv(constant, size));
+
+        return node;
+      }
+
+
+      MbaSimplifier::MbaSimplifier() {
+        this->syntheses.resize(MAX_VARIABLES + 1);
+      }
+
+
+      triton::ast::AbstractNode* MbaSimplifier::getCanonical(triton::ast::AbstractNode* atom) {
+        auto it = this->canonicals.find(atom);
+        if (it != this->canonicals.end())
+          return it->second;
+
+        auto& bucket = this->hashes[static_cast<triton::uint64>(atom->getHash())];
+        for (auto* other : bucket) {
+          if (other->equalTo(atom->shared_from_this()))
+            return this->canonicals[atom] = other;
+        }
+
+        bucket.push_back(atom);
+        return this->canonicals[atom] = atom;
+      }
+
+
+      void MbaSimplifier::visit(triton::ast::AbstractNode* node) {
+        Info info;
+
+        info.overflow = false;
+
+        if (!node->isSymbolized()) {
+          info.kind = KIND_CONSTANT;
+        }
+        else {
+          switch (node->getType()) {
+            case triton::ast::BVADD_NODE:
+            case triton::ast::BVNEG_NODE:
+            case triton::ast::BVSUB_NODE:
+              info.kind = KIND_ARITHMETIC;
+              break;
+
+            /* A product by a constant is linear */
+            case triton::ast::BVMUL_NODE:
+              info.kind = KIND_OTHER;
+              for (const auto& child : node->getChildren()) {
+                if (!child->isSymbolized())
+                  info.kind = KIND_ARITHMETIC;
+              }
+              break;
+
+            /* A shift by a constant is a product by a power of two */
+            case triton::ast::BVSHL_NODE:
+              info.kind = node->getChildren()[1]->isSymbolized() ? KIND_OTHER : KIND_ARITHMETIC;
+              break;
+
+            case triton::ast::BVAND_NODE:
+            case triton::ast::BVNAND_NODE:
+            case triton::ast::BVNOR_NODE:
+            case triton::ast::BVNOT_NODE:
+            case triton::ast::BVOR_NODE:
+            case triton::ast::BVXNOR_NODE:
+            case triton::ast::BVXOR_NODE:
+              info.kind = KIND_BITWISE;
+              break;
+
+            default:
+              info.kind = KIND_OTHER;
+              break;
+          }
+        }
+
+        /* Sets of atoms are merged up to MAX_VARIABLES */
+        if (info.kind == KIND_ARITHMETIC || info.kind == KIND_BITWISE) {
+          for (const auto& child : node->getChildren()) {
+            switch (this->getRole(child.get(), info.kind)) {
+              case ROLE_REGION: {
+                const Info& other = this->infos.at(child.get());
+                info.overflow |= other.overflow;
+                info.atoms.insert(info.atoms.end(), other.atoms.begin(), other.atoms.end());
+                break;
+              }
+              case ROLE_ATOM:
+                info.atoms.push_back(this->getCanonical(child.get()));
+                break;
+              default:
+                break;
+            }
+          }
+
+          std::sort(info.atoms.begin(), info.atoms.end(), [this](triton::ast::AbstractNode* a, triton::ast::AbstractNode* b) {
+            return this->ranks.at(a) < this->ranks.at(b);
+          });
+          info.atoms.erase(std::unique(info.atoms.begin(), info.atoms.end()), info.atoms.end());
+
+          if (info.overflow || info.atoms.size() > MAX_VARIABLES) {
+            info.overflow = true;
+            info.atoms.clear();
+          }
+        }
+
+        this->infos[node] = info;
+      }
+
+
+      MbaSimplifier::role_e MbaSimplifier::getRole(triton::ast::AbstractNode* child, kind_e kind) const {
+        switch (this->infos.at(child).kind) {
+          /* Only the uniform constants are bitwise functions */
+          case KIND_CONSTANT:
+            if (kind == KIND_BITWISE) {
+              triton::uint512 value = child->evaluate();
+              if (value != 0 && value != child->getBitvectorMask())
+                return ROLE_ATOM;
+            }
+            return ROLE_CONSTANT;
+
+          case KIND_ARITHMETIC:
+            return (kind == KIND_ARITHMETIC) ? ROLE_REGION : ROLE_ATOM;
+
+          case KIND_BITWISE:
+            return ROLE_REGION;
+
+          default:
+            return ROLE_ATOM;
+        }
+      }
+
+
+      std::vector<triton::ast::AbstractNode*> MbaSimplifier::getRegion(triton::ast::AbstractNode* node) const {
+        std::vector<triton::ast::AbstractNode*> region;
+        std::unordered_set<triton::ast::AbstractNode*> visited;
+        std::stack<std::pair<triton::ast::AbstractNode*, bool>> worklist;
+
+        worklist.push(std::make_pair(node, false));
+        while (!worklist.empty()) {
+          auto current   = worklist.top().first;
+          bool postorder = worklist.top().second;
+          worklist.pop();
+
+          if (postorder) {
+            region.push_back(current);
+            continue;
+          }
+
+          if (!visited.insert(current).second)
+            continue;
+
+          worklist.push(std::make_pair(current, true));
+          for (const auto& child : current->getChildren()) {
+            if (this->getRole(child.get(), this->infos.at(current).kind) == ROLE_REGION)
+              worklist.push(std::make_pair(child.get(), false));
+          }
+        }
+
+        return region;
+      }
+
+
+      std::vector<triton::uint512> MbaSimplifier::evaluate(const std::vector<triton::ast::AbstractNode*>& region, const std::vector<triton::ast::AbstractNode*>& atoms) const {
+        std::unordered_map<triton::ast::AbstractNode*, std::vector<triton::uint512>> values;
+        std::unordered_map<triton::ast::AbstractNode*, std::vector<triton::uint512>> inputs;
+        triton::usize points = static_cast<triton::usize>(1) << atoms.size();
+
+        /* A node may be an atom of a bitwise operator and a part of an arithmetic one */
+        for (triton::usize index = 0; index < atoms.size(); index++) {
+          auto& value = inputs[atoms[index]];
+          value.resize(points);
+          for (triton::usize point = 0; point < points; point++)
+            value[point] = (point >> index) & 1;
+        }
+
+        for (auto* node : region) {
+          const triton::uint512 mask = node->getBitvectorMask();
+          const triton::uint32 size  = node->getBitvectorSize();
+          std::vector<const std::vector<triton::uint512>*> operands;
+          std::vector<std::vector<triton::uint512>> constants;
+
+          /* Constants are broadcasted to all points */
+          constants.reserve(node->getChildren().size());
+          for (const auto& child : node->getChildren()) {
+            switch (this->getRole(child.get(), this->infos.at(node).kind)) {
+              case ROLE_CONSTANT:
+                constants.push_back(std::vector<triton::uint512>(points, child->evaluate()));
+                operands.push_back(&constants.back());
+                break;
+              case ROLE_ATOM:
+                operands.push_back(&inputs.at(this->canonicals.at(child.get())));
+                break;
+              default:
+                operands.push_back(&values.at(child.get()));
+                break;
+            }
+          }
+
+          auto& result = values[node];
+          result.resize(points);
+
+          for (triton::usize point = 0; point < points; point++) {
+            const triton::uint512& a = (*operands[0])[point];
+            const triton::uint512& b = (operands.size() > 1) ? (*operands[1])[point] : a;
+
+            switch (node->getType()) {
+              case triton::ast::BVADD_NODE:  result[point] = (a + b) & mask; break;
+              case triton::ast::BVSUB_NODE:  result[point] = (a - b) & mask; break;
+              case triton::ast::BVNEG_NODE:  result[point] = (mask - a + 1) & mask; break;
+              case triton::ast::BVMUL_NODE:  result[point] = (a * b) & mask; break;
+              case triton::ast::BVSHL_NODE:  result[point] = (b >= size) ? triton::uint512(0) : ((a << b.convert_to<triton::uint32>()) & mask); break;
+              case triton::ast::BVAND_NODE:  result[point] = a & b; break;
+              case triton::ast::BVNAND_NODE: result[point] = ~(a & b) & mask; break;
+              case triton::ast::BVNOR_NODE:  result[point] = ~(a | b) & mask; break;
+              case triton::ast::BVNOT_NODE:  result[point] = ~a & mask; break;
+              case triton::ast::BVOR_NODE:   result[point] = a | b; break;
+              case triton::ast::BVXNOR_NODE: result[point] = ~(a ^ b) & mask; break;
+              case triton::ast::BVXOR_NODE:  result[point] = a ^ b; break;
+              default:
+                throw triton::exceptions::SymbolicSimplification("MbaSimplifier::evaluate(): Invalid node.");
+            }
+          }
+        }
+
+        return values.at(region.back());
+      }
+
+
+      bool MbaSimplifier::expand(Synthesis& synthesis, triton::uint32 count) {
+        triton::uint32 full = (static_cast<triton::uint32>(1) << (1 << count)) - 1;
+        triton::uint32 cost = static_cast<triton::uint32>(synthesis.levels.size());
+        std::vector<triton::uint32> level;
+
+        if (cost > MAX_BITWISE_SIZE || synthesis.work >= maxWork)
+          return false;
+
+        auto add = [&](triton::uint32 table, triton::ast::ast_e op, triton::uint32 left, triton::uint32 right) {
+          if (synthesis.found.find(table) != synthesis.found.end())
+            return;
+          Bitwise bitwise;
+          bitwise.op    = op;
+          bitwise.left  = left;
+          bitwise.right = right;
+          bitwise.cost  = cost;
+          synthesis.found[table] = bitwise;
+          level.push_back(table);
+        };
+
+        /* The atoms cost 1 */
+        if (cost == 1) {
+          for (triton::uint32 index = 0; index < count; index++) {
+            triton::uint32 table = 0;
+            for (triton::uint32 point = 0; point < (static_cast<triton::uint32>(1) << count); point++)
+              table |= ((point >> index) & 1) << point;
+            add(table, triton::ast::VARIABLE_NODE, index, 0);
+          }
+        }
+
+        else if (cost > 1) {
+          for (triton::uint32 table : synthesis.levels[cost - 1])
+            add(~table & full, triton::ast::BVNOT_NODE, table, 0);
+
+          for (triton::uint32 lcost = 1; lcost <= (cost - 1) / 2; lcost++) {
+            const auto& lefts  = synthesis.levels[lcost];
+            const auto& rights = synthesis.levels[cost - 1 - lcost];
+            for (triton::usize l = 0; l < lefts.size() && synthesis.work < maxWork; l++) {
+              for (triton::usize r = 0; r < rights.size(); r++) {
+                add(lefts[l] & rights[r], triton::ast::BVAND_NODE, lefts[l], rights[r]);
+                add(lefts[l] | rights[r], triton::ast::BVOR_NODE,  lefts[l], rights[r]);
+                add(lefts[l] ^ rights[r], triton::ast::BVXOR_NODE, lefts[l], rights[r]);
+              }
+              synthesis.work += rights.size();
+            }
+          }
+        }
+
+        synthesis.levels.push_back(level);
+
+        return true;
+      }
+
+
+      triton::ast::SharedAbstractNode MbaSimplifier::build(triton::uint32 table, const Synthesis& synthesis, const std::vector<triton::ast::SharedAbstractNode>& atoms) const {
+        const Bitwise& bitwise = synthesis.found.at(table);
+        const auto& ctxt = atoms[0]->getContext();
+
+        switch (bitwise.op) {
+          case triton::ast::VARIABLE_NODE: return atoms[bitwise.left];
+          case triton::ast::BVNOT_NODE:    return ctxt->bvnot(this->build(bitwise.left, synthesis, atoms));
+          case triton::ast::BVAND_NODE:    return ctxt->bvand(this->build(bitwise.left, synthesis, atoms), this->build(bitwise.right, synthesis, atoms));
+          case triton::ast::BVOR_NODE:     return ctxt->bvor(this->build(bitwise.left, synthesis, atoms), this->build(bitwise.right, synthesis, atoms));
+          default:                         return ctxt->bvxor(this->build(bitwise.left, synthesis, atoms), this->build(bitwise.right, synthesis, atoms));
+        }
+      }
+
+
+      triton::ast::SharedAbstractNode MbaSimplifier::synthesize(triton::uint32 table, const std::vector<triton::ast::SharedAbstractNode>& atoms) {
+        triton::uint32 count  = static_cast<triton::uint32>(atoms.size());
+        triton::uint32 points = static_cast<triton::uint32>(1) << count;
+        triton::uint32 full   = (static_cast<triton::uint32>(1) << points) - 1;
+        triton::uint32 size   = atoms[0]->getBitvectorSize();
+        const auto& ctxt      = atoms[0]->getContext();
+        Synthesis& synthesis  = this->syntheses[count];
+
+        if (table == 0)
+          return ctxt->bv(0, size);
+
+        if (table == full)
+          return ctxt->bv(atoms[0]->getBitvectorMask(), size);
+
+        /* The level 0 is empty */
+        if (synthesis.levels.empty()) {
+          synthesis.levels.push_back(std::vector<triton::uint32>());
+          synthesis.work = 0;
+        }
+
+        while (synthesis.found.find(table) == synthesis.found.end()) {
+          if (!this->expand(synthesis, count))
+            break;
+        }
+
+        if (synthesis.found.find(table) != synthesis.found.end())
+          return this->build(table, synthesis, atoms);
+
+        /* Otherwise, the algebraic normal form (a xor of conjunctions) */
+        std::vector<triton::uint32> anf(points);
+        triton::ast::SharedAbstractNode node = nullptr;
+
+        for (triton::uint32 point = 0; point < points; point++)
+          anf[point] = (table >> point) & 1;
+
+        for (triton::uint32 index = 0; index < count; index++) {
+          for (triton::uint32 point = 0; point < points; point++) {
+            if (point & (1 << index))
+              anf[point] ^= anf[point ^ (1 << index)];
+          }
+        }
+
+        for (triton::uint32 point = 0; point < points; point++) {
+          if (anf[point] == 0)
+            continue;
+
+          triton::ast::SharedAbstractNode conjunction = nullptr;
+          for (triton::uint32 index = 0; index < count; index++) {
+            if (point & (1 << index))
+              conjunction = (conjunction == nullptr) ? atoms[index] : ctxt->bvand(conjunction, atoms[index]);
+          }
+          if (conjunction == nullptr)
+            conjunction = ctxt->bv(atoms[0]->getBitvectorMask(), size);
+
+          node = (node == nullptr) ? conjunction : ctxt->bvxor(node, conjunction);
+        }
+
+        return node;
+      }
+
+
+      triton::ast::SharedAbstractNode MbaSimplifier::normalize(triton::ast::AbstractNode* node) {
+        const auto& atoms           = this->infos.at(node).atoms;
+        const auto& ctxt            = node->getContext();
+        const triton::uint512 mask  = node->getBitvectorMask();
+        const triton::uint32 size   = node->getBitvectorSize();
+        const triton::usize points  = static_cast<triton::usize>(1) << atoms.size();
+        std::vector<triton::ast::AbstractNode*> region = this->getRegion(node);
+        std::vector<triton::ast::SharedAbstractNode> satoms;
+        std::vector<triton::ast::SharedAbstractNode> candidates;
+        std::vector<triton::uint512> distinct;
+
+        for (auto* atom : atoms)
+          satoms.push_back(this->results.at(atom));
+
+        /*
+         *  Each bit of a linear MBA is the same function h of the bits of the atoms (plus a carry
+         *  free constant), so e = e(0) + sum(v * F_v) where F_v is the boolean function true when h is v.
+         */
+        std::vector<triton::uint512> values = this->evaluate(region, atoms);
+        triton::uint512 constant = values[0];
+        for (auto& value : values) {
+          value = (value - constant) & mask;
+          if (value != 0 && std::find(distinct.begin(), distinct.end(), value) == distinct.end())
+            distinct.push_back(value);
+        }
+
+        /* A sum of boolean functions, or a complemented one when there is only one */
+        std::vector<std::pair<triton::uint512, triton::ast::SharedAbstractNode>> terms;
+        for (const auto& v : distinct) {
+          triton::uint32 table = 0;
+          for (triton::usize point = 0; point < points; point++)
+            table |= static_cast<triton::uint32>(values[point] == v) << point;
+          terms.push_back(std::make_pair(v, this->synthesize(table, satoms)));
+
+          if (distinct.size() == 1) {
+            triton::uint32 full = (static_cast<triton::uint32>(1) << points) - 1;
+            std::vector<std::pair<triton::uint512, triton::ast::SharedAbstractNode>> complement;
+            complement.push_back(std::make_pair((mask - v + 1) & mask, this->synthesize(~table & full, satoms)));
+            candidates.push_back(sum(ctxt, complement, (constant - v) & mask, size));
+          }
+        }
+        candidates.push_back(sum(ctxt, terms, constant, size));
+
+        /* A sum of conjunctions, the coefficients are the Moebius transform of h */
+        if (distinct.size() > 1) {
+          std::vector<triton::uint512> coefs = values;
+          for (triton::usize index = 0; index < atoms.size(); index++) {
+            for (triton::usize point = 0; point < points; point++) {
+              if (point & (static_cast<triton::usize>(1) << index))
+                coefs[point] = (coefs[point] - coefs[point ^ (static_cast<triton::usize>(1) << index)]) & mask;
+            }
+          }
+
+          terms.clear();
+          for (triton::usize point = 1; point < points; point++) {
+            if (coefs[point] == 0)
+              continue;
+            triton::ast::SharedAbstractNode conjunction = nullptr;
+            for (triton::usize index = 0; index < atoms.size(); index++) {
+              if (point & (static_cast<triton::usize>(1) << index))
+                conjunction = (conjunction == nullptr) ? satoms[index] : ctxt->bvand(conjunction, satoms[index]);
+            }
+            terms.push_back(std::make_pair(coefs[point], conjunction));
+          }
+          candidates.push_back(sum(ctxt, terms, constant, size));
+        }
+
+        /* Keep the smallest candidate if it is smaller than the subexpression */
+        std::unordered_set<triton::ast::AbstractNode*> original(atoms.begin(), atoms.end());
+        std::unordered_set<triton::ast::AbstractNode*> simplified;
+        for (const auto& atom : satoms)
+          simplified.insert(atom.get());
+
+        triton::ast::SharedAbstractNode best = nullptr;
+        triton::usize bestCost = countNodes(node, original);
+
+        for (const auto& candidate : candidates) {
+          triton::usize cost = countNodes(candidate.get(), simplified);
+          if (cost < bestCost) {
+            best     = candidate;
+            bestCost = cost;
+          }
+        }
+
+        return best;
+      }
+
+
+      triton::ast::SharedAbstractNode MbaSimplifier::rebuild(triton::ast::AbstractNode* node) {
+        std::unordered_map<triton::ast::AbstractNode*, triton::ast::SharedAbstractNode> rebuilt;
+
+        for (auto* current : this->getRegion(node)) {
+          std::vector<triton::ast::SharedAbstractNode> children;
+          bool changed = false;
+
+          for (const auto& child : current->getChildren()) {
+            switch (this->getRole(child.get(), this->infos.at(current).kind)) {
+              case ROLE_REGION: children.push_back(rebuilt.at(child.get())); break;
+              case ROLE_ATOM:   children.push_back(this->results.at(this->canonicals.at(child.get()))); break;
+              default:          children.push_back(child); break;
+            }
+            changed |= (children.back() != child);
+          }
+
+          rebuilt[current] = changed ? triton::ast::newInstance(current, children) : current->shared_from_this();
+        }
+
+        return rebuilt.at(node);
+      }
+
+
+      triton::ast::SharedAbstractNode MbaSimplifier::simplify(const triton::ast::SharedAbstractNode& node) {
+        std::stack<std::pair<triton::ast::AbstractNode*, bool>> worklist;
+
+        if (node == nullptr)
+          throw triton::exceptions::SymbolicSimplification("MbaSimplifier::simplify(): node cannot be null.");
+
+        this->infos.clear();
+        this->hashes.clear();
+        this->canonicals.clear();
+        this->ranks.clear();
+        this->results.clear();
+
+        /* Nodes are ranked from left to right */
+        std::stack<triton::ast::AbstractNode*> preorder;
+        preorder.push(node.get());
+        while (!preorder.empty()) {
+          auto current = preorder.top();
+          preorder.pop();
+          if (this->ranks.find(current) != this->ranks.end())
+            continue;
+          triton::usize rank = this->ranks.size();
+          this->ranks[current] = rank;
+          for (auto it = current->getChildren().rbegin(); it != current->getChildren().rend(); it++)
+            preorder.push(it->get());
+        }
+
+        for (const auto& n : triton::ast::childrenExtraction(node, false /* unroll */, true /* revert */))
+          this->visit(n.get());
+
+        /*
+         *  A linear subexpression depends on the simplified form of its atoms, any other
+         *  node on the simplified form of its children.
+         */
+        worklist.push(std::make_pair(node.get(), false));
+        while (!worklist.empty()) {
+          auto current   = worklist.top().first;
+          bool postorder = worklist.top().second;
+          worklist.pop();
+
+          if (this->results.find(current) != this->results.end())
+            continue;
+
+          const Info& info = this->infos.at(current);
+          bool linear = (info.kind == KIND_ARITHMETIC || info.kind == KIND_BITWISE) && !info.overflow;
+
+          if (!postorder) {
+            worklist.push(std::make_pair(current, true));
+            if (linear) {
+              for (auto* atom : info.atoms)
+                worklist.push(std::make_pair(atom, false));
+            }
+            else {
+              for (const auto& child : current->getChildren())
+                worklist.push(std::make_pair(child.get(), false));
+            }
+            continue;
+          }
+
+          if (linear) {
+            auto snode = this->normalize(current);
+            this->results[current] = (snode != nullptr) ? snode : this->rebuild(current);
+            continue;
+          }
+
+          std::vector<triton::ast::SharedAbstractNode> children;
+          bool changed = false;
+          for (const auto& child : current->getChildren()) {
+            children.push_back(this->results.at(child.get()));
+            changed |= (children.back() != child);
+          }
+          this->results[current] = changed ? triton::ast::newInstance(current, children) : current->shared_from_this();
+        }
+
+        return this->results.at(node.get());
+      }
+
+    }; /* symbolic namespace */
+  }; /* engines namespace */
+}; /*triton namespace */
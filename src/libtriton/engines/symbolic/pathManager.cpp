@@ -18,6 +18,7 @@ namespace triton {
 
       PathManager::PathManager(const triton::modes::SharedModes& modes, const triton::ast::SharedAstContext& astCtxt)
         : modes(modes), astCtxt(astCtxt) {
+        this->pathConstraints = std::make_shared<std::vector<triton::engines::symbolic::PathConstraint>>();
       }
 
 
@@ -35,14 +36,21 @@ namespace triton {
       }
 
 
+      std::vector<triton::engines::symbolic::PathConstraint>& PathManager::getWritablePathConstraints(void) {
+        if (this->pathConstraints.use_count() > 1)
+          this->pathConstraints = std::make_shared<std::vector<triton::engines::symbolic::PathConstraint>>(*this->pathConstraints);
+        return *this->pathConstraints;
+      }
+
+
       triton::usize PathManager::getSizeOfPathConstraints(void) const {
-        return this->pathConstraints.size();
+        return this->pathConstraints->size();
       }
 
 
       /* Returns the logical conjunction vector of path constraint */
       const std::vector<triton::engines::symbolic::PathConstraint>& PathManager::getPathConstraints(void) const {
-        return this->pathConstraints;
+        return *this->pathConstraints;
       }
 
 
@@ -50,7 +58,7 @@ namespace triton {
       std::vector<triton::engines::symbolic::PathConstraint> PathManager::getPathConstraintsOfThread(triton::uint32 threadId) const {
         std::vector<triton::engines::symbolic::PathConstraint> ret;
 
-        for (auto& pc : this->pathConstraints) {
+        for (auto& pc : *this->pathConstraints) {
           if (pc.getThreadId() == threadId) {
             ret.push_back(pc);
           }
@@ -69,14 +77,14 @@ namespace triton {
         }
 
         if (start < pcsize && end > pcsize) {
-          std::vector<triton::engines::symbolic::PathConstraint>::const_iterator first = this->pathConstraints.begin() + start;
-          std::vector<triton::engines::symbolic::PathConstraint>::const_iterator last  = this->pathConstraints.end();
+          std::vector<triton::engines::symbolic::PathConstraint>::const_iterator first = this->pathConstraints->begin() + start;
+          std::vector<triton::engines::symbolic::PathConstraint>::const_iterator last  = this->pathConstraints->end();
           return {first, last};
         }
 
         if (start < pcsize && end < pcsize && end > start) {
-          std::vector<triton::engines::symbolic::PathConstraint>::const_iterator first = this->pathConstraints.begin() + start;
-          std::vector<triton::engines::symbolic::PathConstraint>::const_iterator last  = this->pathConstraints.begin() + end;
+          std::vector<triton::engines::symbolic::PathConstraint>::const_iterator first = this->pathConstraints->begin() + start;
+          std::vector<triton::engines::symbolic::PathConstraint>::const_iterator last  = this->pathConstraints->begin() + end;
           return {first, last};
         }
 
@@ -95,7 +103,7 @@ namespace triton {
                     );
 
         /* Then, we create a conjunction of path constraint */
-        for (it = this->pathConstraints.begin(); it != this->pathConstraints.end(); it++) {
+        for (it = this->pathConstraints->begin(); it != this->pathConstraints->end(); it++) {
           node = this->astCtxt->land(node, it->getTakenPredicate());
         }
 
@@ -114,7 +122,7 @@ namespace triton {
                     );
 
         /* Go through all path constraints */
-        for (auto pc = this->pathConstraints.begin(); pc != this->pathConstraints.end(); pc++) {
+        for (auto pc = this->pathConstraints->begin(); pc != this->pathConstraints->end(); pc++) {
           auto branches = pc->getBranchConstraints();
           bool isMultib = (branches.size() >= 2);
 
@@ -213,7 +221,7 @@ namespace triton {
             bb2pc           /* expr which must be true to take the branch */
           );
 
-          this->pathConstraints.push_back(pco);
+          this->getWritablePathConstraints().push_back(pco);
         }
 
         /* Direct branch */
@@ -225,7 +233,7 @@ namespace triton {
             /* expr which must be true to take the branch */
             this->astCtxt->equal(pc, this->astCtxt->bv(dstAddr, size))
           );
-          this->pathConstraints.push_back(pco);
+          this->getWritablePathConstraints().push_back(pco);
         }
       }
 
@@ -248,26 +256,26 @@ namespace triton {
           node  /* expr which must be true to take the branch */
         );
 
-        this->pathConstraints.push_back(pco);
+        this->getWritablePathConstraints().push_back(pco);
       }
 
 
       /* Pushes constraint to the current path predicate. */
       void PathManager::pushPathConstraint(const triton::engines::symbolic::PathConstraint& pco) {
-        this->pathConstraints.push_back(pco);
+        this->getWritablePathConstraints().push_back(pco);
       }
 
 
       /* Pops the last constraints added to the path predicate. */
       void PathManager::popPathConstraint(void) {
-        if (this->pathConstraints.size())
-          this->pathConstraints.pop_back();
+        if (this->pathConstraints->size())
+          this->getWritablePathConstraints().pop_back();
       }
 
 
       /* Clears the current path predicate. */
       void PathManager::clearPathConstraints(void) {
-        this->pathConstraints.clear();
+        this->pathConstraints = std::make_shared<std::vector<triton::engines::symbolic::PathConstraint>>();
       }
 
     }; /* symbolic namespace */
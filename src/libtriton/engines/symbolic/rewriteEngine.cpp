@@ -0,0 +1,607 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <cctype>
+#include <unordered_map>
+
+#include <triton/astContext.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/rewriteEngine.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace symbolic {
+
+      /* An operator of the rules */
+      struct RewriteOperator {
+        const char* name;
+        triton::ast::ast_e op;
+        triton::usize arity;
+        bool commutative;
+      };
+
+
+      /* The operators of the rules, their operands have the size of the node */
+      static const RewriteOperator rewriteOperators[] = {
+        {"bvadd",  triton::ast::BVADD_NODE,  2, true},
+        {"bvand",  triton::ast::BVAND_NODE,  2, true},
+        {"bvashr", triton::ast::BVASHR_NODE, 2, false},
+        {"bvlshr", triton::ast::BVLSHR_NODE, 2, false},
+        {"bvmul",  triton::ast::BVMUL_NODE,  2, true},
+        {"bvnand", triton::ast::BVNAND_NODE, 2, true},
+        {"bvneg",  triton::ast::BVNEG_NODE,  1, false},
+        {"bvnor",  triton::ast::BVNOR_NODE,  2, true},
+        {"bvnot",  triton::ast::BVNOT_NODE,  1, false},
+        {"bvor",   triton::ast::BVOR_NODE,   2, true},
+        {"bvsdiv", triton::ast::BVSDIV_NODE, 2, false},
+        {"bvshl",  triton::ast::BVSHL_NODE,  2, false},
+        {"bvsmod", triton::ast::BVSMOD_NODE, 2, false},
+        {"bvsrem", triton::ast::BVSREM_NODE, 2, false},
+        {"bvsub",  triton::ast::BVSUB_NODE,  2, false},
+        {"bvudiv", triton::ast::BVUDIV_NODE, 2, false},
+        {"bvurem", triton::ast::BVUREM_NODE, 2, false},
+        {"bvxnor", triton::ast::BVXNOR_NODE, 2, true},
+        {"bvxor",  triton::ast::BVXOR_NODE,  2, true},
+      };
+
+
+      /* The maximum number of variants of a left-hand side */
+      static const triton::usize maxVariants = 256;
+
+
+      static const RewriteOperator* findOperator(const std::string& name) {
+        for (const auto& op : rewriteOperators) {
+          if (name == op.name)
+            return &op;
+        }
+        return nullptr;
+      }
+
+
+      static const RewriteOperator* findOperator(triton::ast::ast_e kind) {
+        for (const auto& op : rewriteOperators) {
+          if (kind == op.op)
+            return &op;
+        }
+        return nullptr;
+      }
+
+
+      bool RewriteEngine::isOperator(triton::ast::ast_e kind) {
+        return findOperator(kind) != nullptr;
+      }
+
+
+      bool RewriteEngine::isCommutative(triton::ast::ast_e kind) {
+        const RewriteOperator* op = findOperator(kind);
+        return op != nullptr && op->commutative;
+      }
+
+
+      triton::ast::SharedAbstractNode RewriteEngine::buildNode(const triton::ast::SharedAstContext& ctxt, triton::ast::ast_e op, const std::vector<triton::ast::SharedAbstractNode>& c) {
+        switch (op) {
+          case triton::ast::BVADD_NODE:   return ctxt->bvadd(c[0], c[1]);
+          case triton::ast::BVAND_NODE:   return ctxt->bvand(c[0], c[1]);
+          case triton::ast::BVASHR_NODE:  return ctxt->bvashr(c[0], c[1]);
+          case triton::ast::BVLSHR_NODE:  return ctxt->bvlshr(c[0], c[1]);
+          case triton::ast::BVMUL_NODE:   return ctxt->bvmul(c[0], c[1]);
+          case triton::ast::BVNAND_NODE:  return ctxt->bvnand(c[0], c[1]);
+          case triton::ast::BVNEG_NODE:   return ctxt->bvneg(c[0]);
+          case triton::ast::BVNOR_NODE:   return ctxt->bvnor(c[0], c[1]);
+          case triton::ast::BVNOT_NODE:   return ctxt->bvnot(c[0]);
+          case triton::ast::BVOR_NODE:    return ctxt->bvor(c[0], c[1]);
+          case triton::ast::BVSDIV_NODE:  return ctxt->bvsdiv(c[0], c[1]);
+          case triton::ast::BVSHL_NODE:   return ctxt->bvshl(c[0], c[1]);
+          case triton::ast::BVSMOD_NODE:  return ctxt->bvsmod(c[0], c[1]);
+          case triton::ast::BVSREM_NODE:  return ctxt->bvsrem(c[0], c[1]);
+          case triton::ast::BVSUB_NODE:   return ctxt->bvsub(c[0], c[1]);
+          case triton::ast::BVUDIV_NODE:  return ctxt->bvudiv(c[0], c[1]);
+          case triton::ast::BVUREM_NODE:  return ctxt->bvurem(c[0], c[1]);
+          case triton::ast::BVXNOR_NODE:  return ctxt->bvxnor(c[0], c[1]);
+          case triton::ast::BVXOR_NODE:   return ctxt->bvxor(c[0], c[1]);
+          default:
+            throw triton::exceptions::SymbolicSimplification("RewriteEngine::buildNode(): Invalid operator.");
+        }
+      }
+
+
+      /* Splits rules into tokens: parentheses, arrows and atoms. Comments are skipped. */
+      static std::vector<std::string> tokenize(const std::string& text) {
+        std::vector<std::string> tokens;
+        triton::usize i = 0;
+
+        while (i < text.size()) {
+          char c = text[i];
+
+          if (c == ';') {
+            while (i < text.size() && text[i] != '\n')
+              i++;
+          }
+          else if (std::isspace(static_cast<unsigned char>(c))) {
+            i++;
+          }
+          else if (c == '(' || c == ')') {
+            tokens.push_back(std::string(1, c));
+            i++;
+          }
+          else if (text.compare(i, 2, "->") == 0) {
+            tokens.push_back("->");
+            i += 2;
+          }
+          else {
+            triton::usize start = i;
+            while (i < text.size() && !std::isspace(static_cast<unsigned char>(text[i])) &&
+                   text[i] != '(' && text[i] != ')' && text[i] != ';' && text.compare(i, 2, "->") != 0)
+              i++;
+            tokens.push_back(text.substr(start, i - start));
+          }
+        }
+
+        return tokens;
+      }
+
+
+      /* Parses a decimal or hexadecimal literal, possibly negative */
+      static bool parseLiteral(const std::string& token, triton::uint512& value, bool& negative) {
+        triton::usize i = 0;
+        triton::uint32 base = 10;
+
+        negative = false;
+        value = 0;
+
+        if (token.size() > 1 && token[0] == '-') {
+          negative = true;
+          i++;
+        }
+
+        if (token.compare(i, 2, "0x") == 0 && token.size() > i + 2) {
+          base = 16;
+          i += 2;
+        }
+
+        if (i >= token.size())
+          return false;
+
+        for (; i < token.size(); i++) {
+          char c = static_cast<char>(std::tolower(static_cast<unsigned char>(token[i])));
+          triton::uint32 digit = 0;
+          if (c >= '0' && c <= '9')
+            digit = c - '0';
+          else if (base == 16 && c >= 'a' && c <= 'f')
+            digit = c - 'a' + 10;
+          else
+            return false;
+          value = value * base + digit;
+        }
+
+        return true;
+      }
+
+
+      static bool isIdentifier(const std::string& token) {
+        if (token.empty() || !(std::isalpha(static_cast<unsigned char>(token[0])) || token[0] == '_'))
+          return false;
+
+        for (char c : token) {
+          if (!(std::isalnum(static_cast<unsigned char>(c)) || c == '_'))
+            return false;
+        }
+
+        return true;
+      }
+
+
+      RewriteEngine::RewriteEngine() {
+        this->clearRules();
+      }
+
+
+      void RewriteEngine::clearRules(void) {
+        this->terms.clear();
+        this->literals.clear();
+        this->rules.clear();
+        this->states.clear();
+        this->states.push_back(State());
+        this->compiled = 0;
+      }
+
+
+      bool RewriteEngine::isEmpty(void) const {
+        return this->rules.empty();
+      }
+
+
+      std::vector<std::string> RewriteEngine::getRules(void) const {
+        std::vector<std::string> ret;
+
+        for (const auto& rule : this->rules)
+          ret.push_back(rule.text);
+
+        return ret;
+      }
+
+
+      triton::usize RewriteEngine::parseTerm(const std::vector<std::string>& tokens, triton::usize& pos, std::vector<std::string>& names, bool lhs) {
+        Term term;
+
+        if (pos >= tokens.size())
+          throw triton::exceptions::SymbolicSimplification("RewriteEngine::addRules(): Unexpected end of rule.");
+
+        const std::string& token = tokens[pos++];
+
+        if (token == "(") {
+          if (pos >= tokens.size())
+            throw triton::exceptions::SymbolicSimplification("RewriteEngine::addRules(): Unexpected end of rule.");
+
+          const RewriteOperator* op = findOperator(tokens[pos]);
+          if (op == nullptr)
+            throw triton::exceptions::SymbolicSimplification("RewriteEngine::addRules(): Unsupported operator: " + tokens[pos]);
+          pos++;
+
+          term.kind  = TERM_OPERATOR;
+          term.op    = op->op;
+          term.index = 0;
+          while (pos < tokens.size() && tokens[pos] != ")")
+            term.children.push_back(this->parseTerm(tokens, pos, names, lhs));
+
+          if (pos >= tokens.size())
+            throw triton::exceptions::SymbolicSimplification("RewriteEngine::addRules(): Missing closing parenthesis.");
+          pos++;
+
+          if (term.children.size() != op->arity)
+            throw triton::exceptions::SymbolicSimplification("RewriteEngine::addRules(): Invalid number of operands for " + std::string(op->name) + ".");
+        }
+
+        else if (token == ")" || token == "->") {
+          throw triton::exceptions::SymbolicSimplification("RewriteEngine::addRules(): Unexpected token: " + token);
+        }
+
+        else {
+          triton::uint512 value = 0;
+          bool negative = false;
+
+          term.op = triton::ast::ANY_NODE;
+
+          if (parseLiteral(token, value, negative)) {
+            term.kind  = TERM_LITERAL;
+            term.index = this->literals.size();
+            for (triton::usize i = 0; i < this->literals.size(); i++) {
+              if (this->literals[i].first == value && this->literals[i].second == negative) {
+                term.index = i;
+                break;
+              }
+            }
+            if (term.index == this->literals.size())
+              this->literals.push_back(std::make_pair(value, negative));
+          }
+
+          else if (isIdentifier(token)) {
+            term.kind  = TERM_VARIABLE;
+            term.index = names.size();
+            for (triton::usize i = 0; i < names.size(); i++) {
+              if (names[i] == token) {
+                term.index = i;
+                break;
+              }
+            }
+            if (term.index == names.size()) {
+              if (!lhs)
+                throw triton::exceptions::SymbolicSimplification("RewriteEngine::addRules(): Unbound variable: " + token);
+              names.push_back(token);
+            }
+          }
+
+          else {
+            throw triton::exceptions::SymbolicSimplification("RewriteEngine::addRules(): Invalid token: " + token);
+          }
+        }
+
+        this->terms.push_back(term);
+        return this->terms.size() - 1;
+      }
+
+
+      std::vector<std::vector<RewriteEngine::Symbol>> RewriteEngine::expand(triton::usize index) const {
+        std::vector<std::vector<Symbol>> ret;
+        const Term& term = this->terms[index];
+        Symbol symbol;
+
+        symbol.kind  = term.kind;
+        symbol.op    = term.op;
+        symbol.index = term.index;
+
+        if (term.kind != TERM_OPERATOR) {
+          ret.push_back(std::vector<Symbol>(1, symbol));
+          return ret;
+        }
+
+        std::vector<std::vector<triton::usize>> orders(1, term.children);
+        if (isCommutative(term.op) && term.children.size() == 2)
+          orders.push_back(std::vector<triton::usize>(term.children.rbegin(), term.children.rend()));
+
+        for (const auto& order : orders) {
+          std::vector<std::vector<Symbol>> prefixes(1, std::vector<Symbol>(1, symbol));
+          for (triton::usize child : order) {
+            std::vector<std::vector<Symbol>> next;
+            for (const auto& prefix : prefixes) {
+              for (const auto& suffix : this->expand(child)) {
+                next.push_back(prefix);
+                next.back().insert(next.back().end(), suffix.begin(), suffix.end());
+              }
+            }
+            if (next.size() > maxVariants)
+              throw triton::exceptions::SymbolicSimplification("RewriteEngine::addRules(): Too many commutative operators in a rule.");
+            prefixes.swap(next);
+          }
+
+          /* Swapping equal operands gives the same variant */
+          for (const auto& variant : prefixes) {
+            bool duplicate = false;
+            for (const auto& other : ret) {
+              duplicate = (other.size() == variant.size());
+              for (triton::usize i = 0; duplicate && i < variant.size(); i++)
+                duplicate = (other[i].kind == variant[i].kind && other[i].op == variant[i].op && other[i].index == variant[i].index);
+              if (duplicate)
+                break;
+            }
+            if (!duplicate)
+              ret.push_back(variant);
+          }
+        }
+
+        if (ret.size() > maxVariants)
+          throw triton::exceptions::SymbolicSimplification("RewriteEngine::addRules(): Too many commutative operators in a rule.");
+
+        return ret;
+      }
+
+
+      void RewriteEngine::compile(const std::vector<Symbol>& symbols, triton::usize rule) const {
+        std::vector<triton::usize> variables;
+        triton::usize state = 0;
+
+        for (const auto& symbol : symbols) {
+          triton::usize next = 0;
+
+          switch (symbol.kind) {
+            case TERM_OPERATOR: {
+              auto it = this->states[state].operators.find(symbol.op);
+              if (it != this->states[state].operators.end())
+                next = it->second;
+              break;
+            }
+
+            case TERM_LITERAL:
+              for (const auto& edge : this->states[state].literals) {
+                if (edge.first == symbol.index)
+                  next = edge.second;
+              }
+              break;
+
+            case TERM_VARIABLE:
+              next = this->states[state].wildcard;
+              variables.push_back(symbol.index);
+              break;
+          }
+
+          if (next == 0) {
+            next = this->states.size();
+            this->states.push_back(State());
+            switch (symbol.kind) {
+              case TERM_OPERATOR: this->states[state].operators[symbol.op] = next; break;
+              case TERM_LITERAL:  this->states[state].literals.push_back(std::make_pair(symbol.index, next)); break;
+              case TERM_VARIABLE: this->states[state].wildcard = next; break;
+            }
+          }
+
+          state = next;
+        }
+
+        this->states[state].accept.push_back(std::make_pair(rule, variables));
+      }
+
+
+      void RewriteEngine::prepare(void) const {
+        for (; this->compiled < this->rules.size(); this->compiled++) {
+          for (const auto& variant : this->expand(this->rules[this->compiled].lhs))
+            this->compile(variant, this->compiled);
+        }
+      }
+
+
+      void RewriteEngine::addRules(const std::string& text) {
+        std::vector<std::string> tokens = tokenize(text);
+        std::vector<Rule> parsed;
+        triton::usize terms    = this->terms.size();
+        triton::usize literals = this->literals.size();
+        triton::usize pos      = 0;
+
+        /* Parse all rules before adding them */
+        try {
+          while (pos < tokens.size()) {
+            std::vector<std::string> names;
+            triton::usize start = pos;
+            Rule rule;
+
+            rule.lhs = this->parseTerm(tokens, pos, names, true);
+            if (this->terms[rule.lhs].kind != TERM_OPERATOR)
+              throw triton::exceptions::SymbolicSimplification("RewriteEngine::addRules(): The left-hand side must be an operator.");
+
+            if (pos >= tokens.size() || tokens[pos] != "->")
+              throw triton::exceptions::SymbolicSimplification("RewriteEngine::addRules(): Expected '->'.");
+            pos++;
+
+            rule.rhs = this->parseTerm(tokens, pos, names, false);
+            rule.variables = names.size();
+
+            for (triton::usize i = start; i < pos; i++) {
+              if (i != start && tokens[i] != ")" && tokens[i - 1] != "(")
+                rule.text += " ";
+              rule.text += tokens[i];
+            }
+
+            parsed.push_back(rule);
+          }
+        }
+        catch (const triton::exceptions::SymbolicSimplification&) {
+          this->terms.resize(terms);
+          this->literals.resize(literals);
+          throw;
+        }
+
+        /* The discrimination tree is updated by the next rewrite */
+        this->rules.insert(this->rules.end(), parsed.begin(), parsed.end());
+      }
+
+
+      triton::uint512 RewriteEngine::getLiteral(triton::usize index, triton::uint32 size) const {
+        const auto& literal = this->literals[index];
+        triton::uint512 mask = -1;
+
+        mask = mask >> (512 - size);
+        if (literal.second)
+          return ((mask - (literal.first & mask)) + 1) & mask;
+
+        return literal.first & mask;
+      }
+
+
+      void RewriteEngine::match(triton::usize state, std::vector<triton::ast::AbstractNode*>& pending, std::vector<triton::ast::AbstractNode*>& wildcards, Match& best) const {
+        const State& s = this->states[state];
+
+        /* The whole node is matched, check that the occurrences of each variable are equal */
+        if (pending.empty()) {
+          for (const auto& accept : s.accept) {
+            if (accept.first >= best.rule)
+              continue;
+
+            std::vector<triton::ast::SharedAbstractNode> bindings(this->rules[accept.first].variables);
+            bool valid = true;
+
+            for (triton::usize i = 0; valid && i < wildcards.size(); i++) {
+              auto& binding = bindings[accept.second[i]];
+              auto node = wildcards[i]->shared_from_this();
+              if (binding == nullptr)
+                binding = node;
+              else
+                valid = (binding == node || binding->equalTo(node));
+            }
+
+            if (valid) {
+              best.rule = accept.first;
+              best.bindings.swap(bindings);
+            }
+          }
+          return;
+        }
+
+        triton::ast::AbstractNode* node = pending.back();
+        pending.pop_back();
+
+        if (s.wildcard) {
+          wildcards.push_back(node);
+          this->match(s.wildcard, pending, wildcards, best);
+          wildcards.pop_back();
+        }
+
+        auto it = s.operators.find(node->getType());
+        if (it != s.operators.end()) {
+          triton::usize size = pending.size();
+          const auto& children = node->getChildren();
+          for (auto child = children.rbegin(); child != children.rend(); ++child)
+            pending.push_back(child->get());
+          this->match(it->second, pending, wildcards, best);
+          pending.resize(size);
+        }
+
+        if (node->getType() == triton::ast::BV_NODE) {
+          for (const auto& edge : s.literals) {
+            if (this->getLiteral(edge.first, node->getBitvectorSize()) == node->evaluate())
+              this->match(edge.second, pending, wildcards, best);
+          }
+        }
+
+        pending.push_back(node);
+      }
+
+
+      triton::ast::SharedAbstractNode RewriteEngine::instantiate(triton::usize index, const Match& match, triton::uint32 size, const triton::ast::SharedAstContext& ctxt, triton::usize& budget) const {
+        const Term& term = this->terms[index];
+
+        switch (term.kind) {
+          case TERM_VARIABLE:
+            return match.bindings[term.index];
+
+          case TERM_LITERAL:
+            return ctxt->bv(this->getLiteral(term.index, size), size);
+
+          default: {
+            std::vector<triton::ast::SharedAbstractNode> children;
+            for (triton::usize child : term.children)
+              children.push_back(this->instantiate(child, match, size, ctxt, budget));
+            /* The new node may match other rules */
+            return this->rewriteNode(buildNode(ctxt, term.op, children), budget);
+          }
+        }
+      }
+
+
+      triton::ast::SharedAbstractNode RewriteEngine::rewriteNode(const triton::ast::SharedAbstractNode& node, triton::usize& budget) const {
+        std::vector<triton::ast::AbstractNode*> pending(1, node.get());
+        std::vector<triton::ast::AbstractNode*> wildcards;
+        Match best;
+
+        if (budget == 0 || this->states[0].operators.find(node->getType()) == this->states[0].operators.end())
+          return node;
+
+        best.rule = this->rules.size();
+        this->match(0, pending, wildcards, best);
+        if (best.rule == this->rules.size())
+          return node;
+
+        budget--;
+        return this->instantiate(this->rules[best.rule].rhs, best, node->getBitvectorSize(), node->getContext(), budget);
+      }
+
+
+      triton::ast::SharedAbstractNode RewriteEngine::rewrite(const triton::ast::SharedAbstractNode& node) const {
+        std::unordered_map<triton::ast::AbstractNode*, triton::ast::SharedAbstractNode> rewritten;
+
+        if (node == nullptr)
+          throw triton::exceptions::SymbolicSimplification("RewriteEngine::rewrite(): node cannot be null.");
+
+        if (this->rules.empty())
+          return node;
+
+        this->prepare();
+
+        /* Children come first, so each node is rewritten once with its rewritten children */
+        for (const auto& n : triton::ast::childrenExtraction(node, false /* unroll */, true /* revert */)) {
+          std::vector<triton::ast::SharedAbstractNode> children;
+          triton::ast::SharedAbstractNode current = n;
+          triton::usize budget = REWRITE_LIMIT;
+          bool changed = false;
+
+          for (const auto& child : n->getChildren()) {
+            children.push_back(rewritten.at(child.get()));
+            changed |= (children.back() != child);
+          }
+
+          if (changed)
+            current = triton::ast::newInstance(n.get(), children);
+
+          rewritten[n.get()] = this->rewriteNode(current, budget);
+        }
+
+        return rewritten.at(node.get());
+      }
+
+    }; /* symbolic namespace */
+  }; /* engines namespace */
+}; /*triton namespace */
@@ -5,8 +5,12 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <algorithm>
 #include <cstring>
 #include <new>
+#include <stack>
+#include <tuple>
+#include <unordered_set>
 
 #include <triton/exceptions.hpp>
 #include <triton/coreUtils.hpp>
@@ -22,7 +26,8 @@ namespace triton {
       SymbolicEngine::SymbolicEngine(triton::arch::Architecture* architecture,
                                      const triton::modes::SharedModes& modes,
                                      const triton::ast::SharedAstContext& astCtxt,
-                                     triton::callbacks::Callbacks* callbacks)
+                                     triton::callbacks::Callbacks* callbacks,
+                                     triton::engines::snapshot::Journal* journal)
         : triton::engines::symbolic::SymbolicSimplification(callbacks),
           triton::engines::symbolic::PathManager(modes, astCtxt),
           astCtxt(astCtxt),
@@ -35,9 +40,11 @@ namespace triton {
         this->architecture      = architecture;
         this->callbacks         = callbacks;
         this->enableFlag        = true;
+        this->journal           = journal;
         this->numberOfRegisters = this->architecture->numberOfRegisters();
         this->uniqueSymExprId   = 0;
         this->uniqueSymVarId    = 0;
+        this->symbolicExpressionsLimit = 1024;
 
         this->symbolicReg.resize(this->numberOfRegisters);
       }
@@ -53,9 +60,11 @@ namespace triton {
         this->architecture                = other.architecture;
         this->callbacks                   = other.callbacks;
         this->enableFlag                  = other.enableFlag;
+        this->journal                     = other.journal;
         this->memoryReference             = other.memoryReference;
         this->numberOfRegisters           = other.numberOfRegisters;
         this->symbolicExpressions         = other.symbolicExpressions;
+        this->symbolicExpressionsLimit    = other.symbolicExpressionsLimit;
         this->symbolicReg                 = other.symbolicReg;
         this->symbolicVariables           = other.symbolicVariables;
         this->uniqueSymExprId             = other.uniqueSymExprId;
@@ -79,10 +88,12 @@ namespace triton {
         this->astCtxt                     = other.astCtxt;
         this->callbacks                   = other.callbacks;
         this->enableFlag                  = other.enableFlag;
+        this->journal                     = other.journal;
         this->memoryReference             = other.memoryReference;
         this->modes                       = other.modes;
         this->numberOfRegisters           = other.numberOfRegisters;
         this->symbolicExpressions         = other.symbolicExpressions;
+        this->symbolicExpressionsLimit    = other.symbolicExpressionsLimit;
         this->symbolicReg                 = other.symbolicReg;
         this->symbolicVariables           = other.symbolicVariables;
         this->uniqueSymExprId             = other.uniqueSymExprId;
@@ -101,6 +112,8 @@ namespace triton {
         triton::arch::register_e parentId = reg.getParent();
 
         if (this->architecture->isRegisterValid(parentId)) {
+          if (this->isJournaling())
+            this->journal->recordSymbolicRegister(parentId, this->symbolicReg[parentId]);
           this->symbolicReg[parentId] = nullptr;
         }
       }
@@ -109,6 +122,8 @@ namespace triton {
       /* Same as concretizeRegister but with all registers */
       void SymbolicEngine::concretizeAllRegister(void) {
         for (triton::uint32 i = 0; i < this->numberOfRegisters; i++) {
+          if (this->isJournaling() && this->symbolicReg[i] != nullptr)
+            this->journal->recordSymbolicRegister(triton::arch::register_e(i), this->symbolicReg[i]);
           this->symbolicReg[i] = nullptr;
         }
       }
@@ -120,12 +135,33 @@ namespace triton {
        * before symbolic processing.
        */
       void SymbolicEngine::concretizeMemory(const triton::arch::MemoryAccess& mem) {
-        triton::uint64 addr = mem.getAddress();
-        triton::uint32 size = mem.getSize();
+        this->concretizeMemory(mem.getAddress(), mem.getSize());
+      }
 
-        for (triton::uint32 index = 0; index < size; index++) {
-          this->concretizeMemory(addr+index);
+
+      /* Concretizes [baseAddr, baseAddr+size) in time proportional to the symbolic memory it overlaps */
+      void SymbolicEngine::concretizeMemory(triton::uint64 baseAddr, triton::usize size) {
+        if (size == 0 || this->isMemoryConcrete())
+          return;
+
+        if (this->isJournaling()) {
+          if (size <= this->memoryReference.size()) {
+            for (triton::usize index = 0; index < size; index++) {
+              const SharedSymbolicExpression* expr = this->memoryReference.get(baseAddr + index);
+              if (expr != nullptr)
+                this->journal->recordSymbolicMemory(baseAddr + index, *expr);
+            }
+          }
+          else {
+            this->memoryReference.forEach([this, baseAddr, size] (triton::uint64 addr, const SharedSymbolicExpression& expr) {
+              if (addr - baseAddr < size)
+                this->journal->recordSymbolicMemory(addr, expr);
+            });
+          }
         }
+
+        this->memoryReference.eraseRange(baseAddr, size);
+        this->removeAlignedMemory(baseAddr, size);
       }
 
 
@@ -135,72 +171,97 @@ namespace triton {
        * before symbolic processing.
        */
       void SymbolicEngine::concretizeMemory(triton::uint64 addr) {
+        /* Fast path for bulk concrete writes on a concrete memory */
+        if (this->isMemoryConcrete())
+          return;
+
+        if (this->isJournaling() && this->memoryReference.has(addr))
+          this->journal->recordSymbolicMemory(addr, *this->memoryReference.get(addr));
         this->memoryReference.erase(addr);
         this->removeAlignedMemory(addr, triton::size::byte);
       }
 
 
+      /* Returns true if no memory cell has a symbolic reference */
+      bool SymbolicEngine::isMemoryConcrete(void) const {
+        return this->memoryReference.empty() && std::all_of(this->alignedMemoryReference.begin(), this->alignedMemoryReference.end(),
+          [] (const triton::utils::PagedMap<SharedSymbolicExpression, 6>& aligned) { return aligned.empty(); });
+      }
+
+
       /* Same as concretizeMemory but with all address memory */
       void SymbolicEngine::concretizeAllMemory(void) {
+        if (this->isJournaling()) {
+          this->memoryReference.forEach([this] (triton::uint64 addr, const SharedSymbolicExpression& expr) {
+            this->journal->recordSymbolicMemory(addr, expr);
+          });
+        }
         this->memoryReference.clear();
-        this->alignedMemoryReference.clear();
+        for (auto& aligned : this->alignedMemoryReference)
+          aligned.clear();
+      }
+
+
+      /* Returns the index of an aligned size */
+      triton::uint32 SymbolicEngine::getAlignedIndex(triton::uint32 size) const {
+        triton::uint32 index = 0;
+
+        while (index < this->alignedMemoryReference.size() && (1U << index) != size)
+          index++;
+
+        return index;
       }
 
 
       /* Gets an aligned entry. */
-      const SharedSymbolicExpression& SymbolicEngine::getAlignedMemory(triton::uint64 address, triton::uint32 size) {
-        return this->alignedMemoryReference[std::make_pair(address, size)];
+      const SharedSymbolicExpression* SymbolicEngine::getAlignedMemory(triton::uint64 address, triton::uint32 size) const {
+        triton::uint32 index = this->getAlignedIndex(size);
+
+        if (index == this->alignedMemoryReference.size())
+          return nullptr;
+
+        return this->alignedMemoryReference[index].get(address);
       }
 
 
       /* Checks if the aligned memory is recored. */
-      bool SymbolicEngine::isAlignedMemory(triton::uint64 address, triton::uint32 size) {
-        if (this->alignedMemoryReference.find(std::make_pair(address, size)) != this->alignedMemoryReference.end()) {
-          return true;
-        }
-        return false;
+      bool SymbolicEngine::isAlignedMemory(triton::uint64 address, triton::uint32 size) const {
+        return this->getAlignedMemory(address, size) != nullptr;
       }
 
 
       /* Adds an aligned memory */
       void SymbolicEngine::addAlignedMemory(triton::uint64 address, triton::uint32 size, const SharedSymbolicExpression& expr) {
+        triton::uint32 index = this->getAlignedIndex(size);
+
         this->removeAlignedMemory(address, size);
+        if (index == this->alignedMemoryReference.size())
+          return;
+
         if (!(this->modes->isModeEnabled(triton::modes::ONLY_ON_SYMBOLIZED) && expr->getAst()->isSymbolized() == false)) {
-          this->alignedMemoryReference[std::make_pair(address, size)] = expr;
+          this->alignedMemoryReference[index].set(address, expr);
         }
       }
 
 
-      /* Removes an aligned memory */
-      void SymbolicEngine::removeAlignedMemory(triton::uint64 address, triton::uint32 size) {
-        /* Remove overloaded positive ranges */
-        for (triton::uint32 index = 0; index < size; index++) {
-          this->alignedMemoryReference.erase(std::make_pair(address+index, triton::size::byte));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, triton::size::word));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, triton::size::dword));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, triton::size::qword));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, triton::size::dqword));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, triton::size::qqword));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, triton::size::dqqword));
-        }
+      /* Removes the aligned entries overlapping [address, address+size) */
+      void SymbolicEngine::removeAlignedMemory(triton::uint64 address, triton::usize size) {
+        for (triton::uint32 index = 0; index < this->alignedMemoryReference.size(); index++) {
+          triton::utils::PagedMap<SharedSymbolicExpression, 6>& aligned = this->alignedMemoryReference[index];
+          triton::uint32 width = (1U << index);
 
-        /* Remove overloaded negative ranges */
-        for (triton::uint32 index = 1; index < triton::size::dqqword; index++) {
-          if (index < triton::size::word)    this->alignedMemoryReference.erase(std::make_pair(address-index, triton::size::word));
-          if (index < triton::size::dword)   this->alignedMemoryReference.erase(std::make_pair(address-index, triton::size::dword));
-          if (index < triton::size::qword)   this->alignedMemoryReference.erase(std::make_pair(address-index, triton::size::qword));
-          if (index < triton::size::dqword)  this->alignedMemoryReference.erase(std::make_pair(address-index, triton::size::dqword));
-          if (index < triton::size::qqword)  this->alignedMemoryReference.erase(std::make_pair(address-index, triton::size::qqword));
-          if (index < triton::size::dqqword) this->alignedMemoryReference.erase(std::make_pair(address-index, triton::size::dqqword));
+          /* The entries of this size starting in [address-width+1, address+size) */
+          if (!aligned.empty())
+            aligned.eraseRange(address - (width - 1), size + (width - 1));
         }
       }
 
 
       /* Returns the reference memory if it's referenced otherwise returns nullptr */
       SharedSymbolicExpression SymbolicEngine::getSymbolicMemory(triton::uint64 addr) const {
-        auto it = this->memoryReference.find(addr);
-        if (it != this->memoryReference.end()) {
-          return it->second;
+        const SharedSymbolicExpression* expr = this->memoryReference.get(addr);
+        if (expr != nullptr) {
+          return *expr;
         }
         return nullptr;
       }
@@ -208,12 +269,12 @@ namespace triton {
 
       /* Returns the symbolic variable otherwise raises an exception */
       SharedSymbolicVariable SymbolicEngine::getSymbolicVariable(triton::usize symVarId) const {
-        auto it = this->symbolicVariables.find(symVarId);
-        if (it == this->symbolicVariables.end()) {
+        const WeakSymbolicVariable* weak = this->symbolicVariables.get(symVarId);
+        if (weak == nullptr) {
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::getSymbolicVariable(): Unregistred symbolic variable.");
         }
 
-        if (auto node = it->second.lock()) {
+        if (auto node = weak->lock()) {
           return node;
         }
 
@@ -227,13 +288,21 @@ namespace triton {
          * FIXME: When there is a ton of symvar, this loop takes a while to go through.
          *        What about adding two maps {id:symvar} and {string:symvar}? See #648.
          */
-        for (auto& sv: this->symbolicVariables) {
-          if (auto symVar = sv.second.lock()) {
+        SharedSymbolicVariable ret = nullptr;
+
+        this->symbolicVariables.forEach([&] (triton::usize id, const WeakSymbolicVariable& sv) {
+          if (ret != nullptr)
+            return;
+          if (auto symVar = sv.lock()) {
             if (symVar->getName() == symVarName) {
-              return symVar;
+              ret = symVar;
             }
           }
-        }
+        });
+
+        if (ret != nullptr)
+          return ret;
+
         throw triton::exceptions::SymbolicEngine("SymbolicEngine::getSymbolicVariable(): Unregistred or dead symbolic variable.");
       }
 
@@ -244,13 +313,13 @@ namespace triton {
         std::unordered_map<triton::usize, SharedSymbolicVariable> ret;
         std::vector<triton::usize> toRemove;
 
-        for (auto& kv : this->symbolicVariables) {
-          if (auto sp = kv.second.lock()) {
-            ret[kv.first] = sp;
+        this->symbolicVariables.forEach([&] (triton::usize id, const WeakSymbolicVariable& sv) {
+          if (auto sp = sv.lock()) {
+            ret[id] = sp;
           } else {
-            toRemove.push_back(kv.first);
+            toRemove.push_back(id);
           }
-        }
+        });
 
         for (triton::usize id : toRemove) {
           this->symbolicVariables.erase(id);
@@ -322,6 +391,8 @@ namespace triton {
       /* Get an unique id.
        * Mainly used when a new symbolic expression is created */
       triton::usize SymbolicEngine::getUniqueSymExprId(void) {
+        if (this->isJournaling())
+          this->journal->recordSymbolicExpression(this->uniqueSymExprId);
         return this->uniqueSymExprId++;
       }
 
@@ -330,6 +401,8 @@ namespace triton {
       /* Get an unique id.
        * Mainly used when a new symbolic variable is created */
       triton::usize SymbolicEngine::getUniqueSymVarId(void) {
+        if (this->isJournaling())
+          this->journal->recordSymbolicVariable(this->uniqueSymVarId);
         return this->uniqueSymVarId++;
       }
 
@@ -364,14 +437,19 @@ namespace triton {
         }
 
         /* Save and returns the new shared symbolic expression */
-        this->symbolicExpressions[id] = expr;
+        this->symbolicExpressions.set(id, expr);
+
+        /* Forget the expressions which do not exist anymore (amortized). The trimming is done between instructions. */
+        if (!this->modes->isModeEnabled(triton::modes::TRIM_SYMBOLIC_EXPRESSIONS))
+          this->compactSymbolicExpressions(false);
+
         return expr;
       }
 
 
       /* Removes the symbolic expression corresponding to the id */
       void SymbolicEngine::removeSymbolicExpression(const SharedSymbolicExpression& expr) {
-        if (this->symbolicExpressions.find(expr->getId()) != this->symbolicExpressions.end()) {
+        if (this->symbolicExpressions.has(expr->getId())) {
           /* Concretize memory */
           if (expr->getType() == MEMORY_EXPRESSION) {
             const auto& mem = expr->getOriginMemory();
@@ -385,6 +463,8 @@ namespace triton {
           }
 
           /* Delete and remove the pointer */
+          if (this->isJournaling())
+            this->journal->recordSymbolicExpressionRemoved(expr);
           this->symbolicExpressions.erase(expr->getId());
         }
       }
@@ -392,12 +472,12 @@ namespace triton {
 
       /* Gets the shared symbolic expression from a symbolic id */
       SharedSymbolicExpression SymbolicEngine::getSymbolicExpression(triton::usize symExprId) const {
-        auto it = this->symbolicExpressions.find(symExprId);
-        if (it == this->symbolicExpressions.end()) {
+        const WeakSymbolicExpression* weak = this->symbolicExpressions.get(symExprId);
+        if (weak == nullptr) {
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::getSymbolicExpression(): symbolic expression id not found");
         }
 
-        if (auto sp = it->second.lock()) {
+        if (auto sp = weak->lock()) {
           return sp;
         }
 
@@ -412,13 +492,13 @@ namespace triton {
         std::unordered_map<triton::usize, SharedSymbolicExpression> ret;
         std::vector<triton::usize> toRemove;
 
-        for (auto& kv : this->symbolicExpressions) {
-          if (auto sp = kv.second.lock()) {
-            ret[kv.first] = sp;
+        this->symbolicExpressions.forEach([&] (triton::usize id, const WeakSymbolicExpression& se) {
+          if (auto sp = se.lock()) {
+            ret[id] = sp;
           } else {
-            toRemove.push_back(kv.first);
+            toRemove.push_back(id);
           }
-        }
+        });
 
         for (auto id : toRemove)
           this->symbolicExpressions.erase(id);
@@ -427,26 +507,134 @@ namespace triton {
       }
 
 
+      /* Removes the expired expressions from the map of ids */
+      triton::usize SymbolicEngine::compactSymbolicExpressions(bool force) {
+        if (!force && this->symbolicExpressions.size() <= this->symbolicExpressionsLimit)
+          return 0;
+
+        triton::usize count = this->symbolicExpressions.eraseIf([] (triton::usize id, const WeakSymbolicExpression& se) {
+          return se.expired();
+        });
+
+        this->symbolicExpressionsLimit = std::max<triton::usize>(1024, this->symbolicExpressions.size() * 2);
+        return count;
+      }
+
+
+      /* Removes the expressions which are not reachable from the symbolic state from the map of ids */
+      triton::usize SymbolicEngine::trimSymbolicExpressions(bool force) {
+        if (!force && this->symbolicExpressions.size() <= this->symbolicExpressionsLimit)
+          return 0;
+
+        std::vector<SharedSymbolicExpression> roots;
+        std::stack<triton::ast::AbstractNode*> worklist;
+        std::unordered_set<triton::ast::AbstractNode*> visited;
+
+        for (const auto& se : this->symbolicReg) {
+          if (se != nullptr)
+            roots.push_back(se);
+        }
+
+        this->memoryReference.forEach([&] (triton::uint64 addr, const SharedSymbolicExpression& se) {
+          if (se != nullptr)
+            roots.push_back(se);
+        });
+
+        for (const auto& aligned : this->alignedMemoryReference) {
+          aligned.forEach([&] (triton::uint64 addr, const SharedSymbolicExpression& se) {
+            roots.push_back(se);
+          });
+        }
+
+        /* The path constraints are ASTs, their references are roots */
+        for (const auto& pco : this->getPathConstraints()) {
+          for (const auto& branch : pco.getBranchConstraints())
+            worklist.push(std::get<3>(branch).get());
+        }
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* node = worklist.top();
+          worklist.pop();
+          if (!visited.insert(node).second)
+            continue;
+          if (node->getType() == triton::ast::REFERENCE_NODE) {
+            roots.push_back(reinterpret_cast<triton::ast::ReferenceNode*>(node)->getSymbolicExpression());
+            continue;
+          }
+          for (const auto& child : node->getChildren())
+            worklist.push(child.get());
+        }
+
+        /* The slice of the roots */
+        std::vector<bool> reachable(this->uniqueSymExprId, false);
+        std::vector<SymbolicExpression*> exprs;
+        auto mark = [&] (SymbolicExpression* se) {
+          if (se->getId() >= reachable.size())
+            reachable.resize(se->getId() + 1, false);
+          if (!reachable[se->getId()]) {
+            reachable[se->getId()] = true;
+            exprs.push_back(se);
+          }
+        };
+
+        for (const auto& se : roots)
+          mark(se.get());
+        while (!exprs.empty()) {
+          SymbolicExpression* se = exprs.back();
+          exprs.pop_back();
+          for (const auto& dep : se->getDependencies())
+            mark(dep.get());
+        }
+
+        triton::usize count = this->symbolicExpressions.eraseIf([&] (triton::usize id, const WeakSymbolicExpression& se) {
+          if (id < reachable.size() && reachable[id])
+            return false;
+          if (this->isJournaling()) {
+            if (auto sp = se.lock())
+              this->journal->recordSymbolicExpressionRemoved(sp);
+          }
+          return true;
+        });
+
+        this->symbolicExpressionsLimit = std::max<triton::usize>(1024, this->symbolicExpressions.size() * 2);
+        return count;
+      }
+
+
       /* Slices all expressions from a given one */
       std::unordered_map<triton::usize, SharedSymbolicExpression> SymbolicEngine::sliceExpressions(const SharedSymbolicExpression& expr) {
-        std::unordered_map<triton::usize, SharedSymbolicExpression> exprs;
-
         if (expr == nullptr) {
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::sliceExpressions(): expr cannot be null.");
         }
 
-        exprs[expr->getId()] = expr;
+        return this->sliceExpressions(std::vector<SharedSymbolicExpression>(1, expr));
+      }
+
+
+      std::unordered_map<triton::usize, SharedSymbolicExpression> SymbolicEngine::sliceExpressions(const std::vector<SharedSymbolicExpression>& exprs) {
+        std::unordered_map<triton::usize, SharedSymbolicExpression> slice;
+        std::vector<SymbolicExpression*> worklist;
 
-        auto worklist = triton::ast::childrenExtraction(expr->getAst(), true /* unroll */, false /* revert */);
-        for (auto&& n : worklist) {
-          if (n->getType() == triton::ast::REFERENCE_NODE) {
-            auto expr  = reinterpret_cast<triton::ast::ReferenceNode*>(n.get())->getSymbolicExpression();
-            auto eid   = expr->getId();
-            exprs[eid] = expr;
+        for (const auto& expr : exprs) {
+          if (expr == nullptr) {
+            throw triton::exceptions::SymbolicEngine("SymbolicEngine::sliceExpressions(): expr cannot be null.");
+          }
+          if (slice.insert({expr->getId(), expr}).second) {
+            worklist.push_back(expr.get());
           }
         }
 
-        return exprs;
+        /* Walks the dependencies of the expressions, each expression is visited once for all targets */
+        while (!worklist.empty()) {
+          SymbolicExpression* expr = worklist.back();
+          worklist.pop_back();
+          for (const auto& dep : expr->getDependencies()) {
+            if (slice.insert({dep->getId(), dep}).second) {
+              worklist.push_back(dep.get());
+            }
+          }
+        }
+
+        return slice;
       }
 
 
@@ -521,15 +709,15 @@ namespace triton {
         std::vector<SharedSymbolicExpression> taintedExprs;
         std::vector<triton::usize> invalidSymExpr;
 
-        for (auto it = this->symbolicExpressions.begin(); it != this->symbolicExpressions.end(); it++) {
-          if (auto sp = it->second.lock()) {
+        this->symbolicExpressions.forEach([&] (triton::usize id, const WeakSymbolicExpression& se) {
+          if (auto sp = se.lock()) {
             if (sp->isTainted) {
               taintedExprs.push_back(sp);
             }
           } else {
-            invalidSymExpr.push_back(it->first);
+            invalidSymExpr.push_back(id);
           }
-        }
+        });
 
         for (auto id : invalidSymExpr) {
           this->symbolicExpressions.erase(id);
@@ -554,8 +742,20 @@ namespace triton {
 
 
       /* Returns the map of symbolic memory defined */
-      const std::unordered_map<triton::uint64, SharedSymbolicExpression>& SymbolicEngine::getSymbolicMemory(void) const {
-        return this->memoryReference;
+      std::unordered_map<triton::uint64, SharedSymbolicExpression> SymbolicEngine::getSymbolicMemory(void) const {
+        std::unordered_map<triton::uint64, SharedSymbolicExpression> ret;
+
+        this->memoryReference.forEach([&] (triton::uint64 addr, const SharedSymbolicExpression& expr) {
+          ret[addr] = expr;
+        });
+
+        return ret;
+      }
+
+
+      /* Iterates over the symbolic memory defined */
+      void SymbolicEngine::forEachSymbolicMemory(const std::function<void(triton::uint64, const SharedSymbolicExpression&)>& f) const {
+        this->memoryReference.forEach(f);
       }
 
 
@@ -662,7 +862,7 @@ namespace triton {
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::newSymbolicVariable(): Cannot allocate a new symbolic variable");
         }
 
-        this->symbolicVariables[uniqueId] = symVar;
+        this->symbolicVariables.set(uniqueId, symVar);
         return symVar;
       }
 
@@ -856,8 +1056,10 @@ namespace triton {
          * Symbolic optimization
          * If the memory access is aligned, don't split the memory.
          */
-        if (this->modes->isModeEnabled(triton::modes::ALIGNED_MEMORY) && this->isAlignedMemory(address, size)) {
-          return this->getAlignedMemory(address, size)->getAst();
+        if (this->modes->isModeEnabled(triton::modes::ALIGNED_MEMORY)) {
+          const SharedSymbolicExpression* aligned = this->getAlignedMemory(address, size);
+          if (aligned != nullptr)
+            return (*aligned)->getAst();
         }
 
         /* If the memory access is 1 byte long, just return the appropriate 8-bit vector */
@@ -1089,7 +1291,11 @@ namespace triton {
 
       /* Adds and assign a new memory reference */
       inline void SymbolicEngine::addMemoryReference(triton::uint64 mem, const SharedSymbolicExpression& expr) {
-        this->memoryReference[mem] = expr;
+        if (this->isJournaling()) {
+          const SharedSymbolicExpression* old = this->memoryReference.get(mem);
+          this->journal->recordSymbolicMemory(mem, (old != nullptr) ? *old : nullptr);
+        }
+        this->memoryReference.set(mem, expr);
       }
 
 
@@ -1113,6 +1319,8 @@ namespace triton {
 
         if (reg.isMutable()) {
           /* Assign if this register is mutable */
+          if (this->isJournaling())
+            this->journal->recordSymbolicRegister(triton::arch::register_e(id), this->symbolicReg[id]);
           this->symbolicReg[id] = se;
           /* Synchronize the concrete state */
           this->architecture->setConcreteRegisterValue(reg, node->evaluate());
@@ -1168,10 +1376,10 @@ namespace triton {
 
       /* Returns true if the symbolic expression ID exists */
       bool SymbolicEngine::isSymbolicExpressionExists(triton::usize symExprId) const {
-        auto it = this->symbolicExpressions.find(symExprId);
+        const WeakSymbolicExpression* weak = this->symbolicExpressions.get(symExprId);
 
-        if (it != this->symbolicExpressions.end()) {
-          return (it->second.use_count() > 0);
+        if (weak != nullptr) {
+          return (weak->use_count() > 0);
         }
 
         return false;
@@ -1282,6 +1490,8 @@ namespace triton {
         }
 
         /* Update the symbolic variable value */
+        if (this->isJournaling())
+          this->journal->recordVariableValue(symVar->getId(), this->astCtxt->getVariableValue(symVar->getName()));
         this->astCtxt->updateVariable(symVar->getName(), value);
 
         /* Synchronize concrete state */
@@ -1299,6 +1509,53 @@ namespace triton {
         }
       }
 
+
+
+      void SymbolicEngine::undo(const triton::engines::snapshot::JournalEntry& entry) {
+        switch (entry.kind) {
+          case triton::engines::snapshot::JOURNAL_SYMBOLIC_EXPRESSION:
+            this->symbolicExpressions.erase(entry.key);
+            this->uniqueSymExprId = entry.key;
+            break;
+
+          case triton::engines::snapshot::JOURNAL_SYMBOLIC_EXPRESSION_REMOVED:
+            this->symbolicExpressions.set(entry.key, *entry.expr);
+            break;
+
+          case triton::engines::snapshot::JOURNAL_SYMBOLIC_MEMORY:
+            /* Aligned entries may still point to the reverted expression */
+            this->removeAlignedMemory(entry.key, triton::size::byte);
+            if (*entry.expr != nullptr)
+              this->memoryReference.set(entry.key, *entry.expr);
+            else
+              this->memoryReference.erase(entry.key);
+            break;
+
+          case triton::engines::snapshot::JOURNAL_SYMBOLIC_REGISTER:
+            this->symbolicReg[entry.key] = *entry.expr;
+            break;
+
+          case triton::engines::snapshot::JOURNAL_SYMBOLIC_VARIABLE:
+            this->symbolicVariables.erase(entry.key);
+            this->astCtxt->removeVariable(TRITON_SYMVAR_NAME + std::to_string(entry.key));
+            this->uniqueSymVarId = entry.key;
+            break;
+
+          case triton::engines::snapshot::JOURNAL_VARIABLE_VALUE: {
+            /* The variable may have died since, then there is no value to restore */
+            std::string name = TRITON_SYMVAR_NAME + std::to_string(entry.key);
+            const auto& variables = this->astCtxt->getVariables();
+            auto it = variables.find(name);
+            if (it != variables.end() && !it->second.first.expired())
+              this->astCtxt->updateVariable(name, *entry.value);
+            break;
+          }
+
+          default:
+            throw triton::exceptions::SymbolicEngine("SymbolicEngine::undo(): Not a symbolic journal entry.");
+        }
+      }
+
     }; /* symbolic namespace */
   }; /* engines namespace */
 }; /*triton namespace */
@@ -5,9 +5,12 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <algorithm>
 #include <iosfwd>
 #include <string>
 #include <sstream>
+#include <stack>
+#include <unordered_set>
 
 #include <triton/ast.hpp>
 #include <triton/astContext.hpp>
@@ -26,33 +29,38 @@ namespace triton {
       SymbolicExpression::SymbolicExpression(const triton::ast::SharedAbstractNode& node, triton::usize id, triton::engines::symbolic::expression_e type, const std::string& comment)
         : originMemory(),
           originRegister() {
-        this->ast           = node;
-        this->comment       = comment;
-        this->id            = id;
-        this->isTainted     = false;
-        this->type          = type;
+        this->ast                   = node;
+        this->comment               = comment;
+        this->dependenciesComputed  = false;
+        this->id                    = id;
+        this->isTainted             = false;
+        this->type                  = type;
       }
 
 
       SymbolicExpression::SymbolicExpression(const SymbolicExpression& other) {
-        this->ast            = other.ast;
-        this->comment        = other.comment;
-        this->id             = other.id;
-        this->isTainted      = other.isTainted;
-        this->originMemory   = other.originMemory;
-        this->originRegister = other.originRegister;
-        this->type           = other.type;
+        this->ast                   = other.ast;
+        this->comment               = other.comment;
+        this->dependencies          = other.dependencies;
+        this->dependenciesComputed  = other.dependenciesComputed;
+        this->id                    = other.id;
+        this->isTainted             = other.isTainted;
+        this->originMemory          = other.originMemory;
+        this->originRegister        = other.originRegister;
+        this->type                  = other.type;
       }
 
 
       SymbolicExpression& SymbolicExpression::operator=(const SymbolicExpression& other) {
-        this->ast            = other.ast;
-        this->comment        = other.comment;
-        this->id             = other.id;
-        this->isTainted      = other.isTainted;
-        this->originMemory   = other.originMemory;
-        this->originRegister = other.originRegister;
-        this->type           = other.type;
+        this->ast                   = other.ast;
+        this->comment               = other.comment;
+        this->dependencies          = other.dependencies;
+        this->dependenciesComputed  = other.dependenciesComputed;
+        this->id                    = other.id;
+        this->isTainted             = other.isTainted;
+        this->originMemory          = other.originMemory;
+        this->originRegister        = other.originRegister;
+        this->type                  = other.type;
         return *this;
       }
 
@@ -76,6 +84,41 @@ namespace triton {
       }
 
 
+      const std::vector<SharedSymbolicExpression>& SymbolicExpression::getDependencies(void) const {
+        if (this->dependenciesComputed)
+          return this->dependencies;
+
+        std::stack<triton::ast::AbstractNode*> worklist;
+        std::unordered_set<triton::ast::AbstractNode*> visited;
+
+        /* The references are not unrolled, each one is an edge of the dependency graph */
+        worklist.push(this->getAst().get());
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* node = worklist.top();
+          worklist.pop();
+
+          if (!visited.insert(node).second)
+            continue;
+
+          if (node->getType() == triton::ast::REFERENCE_NODE) {
+            this->dependencies.push_back(reinterpret_cast<triton::ast::ReferenceNode*>(node)->getSymbolicExpression());
+            continue;
+          }
+
+          for (const auto& child : node->getChildren())
+            worklist.push(child.get());
+        }
+
+        std::sort(this->dependencies.begin(), this->dependencies.end(), [](const SharedSymbolicExpression& a, const SharedSymbolicExpression& b) {
+          return a->getId() < b->getId();
+        });
+        this->dependencies.erase(std::unique(this->dependencies.begin(), this->dependencies.end()), this->dependencies.end());
+        this->dependenciesComputed = true;
+
+        return this->dependencies;
+      }
+
+
       triton::usize SymbolicExpression::getId(void) const {
         return this->id;
       }
@@ -170,6 +213,11 @@ namespace triton {
 
         /* Set the new ast */
         this->ast = node;
+        this->dependencies.clear();
+        this->dependenciesComputed = false;
+
+        /* The unrolled ASTs of the expressions referencing this one are stale */
+        this->ast->getContext()->clearUnrolledAsts();
 
         /* Do not init parents if the new node has same properties that the old one */
         if (!old || !old->canReplaceNodeWithoutUpdate(ast)) {
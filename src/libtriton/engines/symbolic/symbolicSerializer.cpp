@@ -0,0 +1,563 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <stack>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <triton/exceptions.hpp>
+#include <triton/symbolicSerializer.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace symbolic {
+
+      /* The format identification */
+      static const char magic[4] = {'T', 'R', 'T', 'N'};
+
+      /* The format version */
+      static const triton::uint32 version = 1;
+
+      /* The record kind of a symbolic expression. Other records are nodes (ast_e) */
+      static const triton::uint32 expressionRecord = triton::ast::INVALID_NODE;
+
+      /* Origins of a symbolic expression */
+      enum origin_e {
+        NO_ORIGIN,
+        MEMORY_ORIGIN,
+        REGISTER_ORIGIN,
+      };
+
+
+      static void writeVarint(std::ostream& stream, triton::uint64 value) {
+        do {
+          triton::uint8 byte = static_cast<triton::uint8>(value & 0x7f);
+          value >>= 7;
+          if (value)
+            byte |= 0x80;
+          stream.put(static_cast<char>(byte));
+        } while (value);
+      }
+
+
+      static void writeInteger(std::ostream& stream, triton::uint512 value) {
+        do {
+          triton::uint8 byte = static_cast<triton::uint8>(value & 0x7f);
+          value >>= 7;
+          if (value)
+            byte |= 0x80;
+          stream.put(static_cast<char>(byte));
+        } while (value);
+      }
+
+
+      static void writeString(std::ostream& stream, const std::string& value) {
+        writeVarint(stream, value.size());
+        stream.write(value.data(), value.size());
+      }
+
+
+      static triton::uint8 readByte(std::istream& stream) {
+        int byte = stream.get();
+        if (byte == std::char_traits<char>::eof())
+          throw triton::exceptions::SymbolicEngine("SymbolicSerializer::deserialize(): Unexpected end of stream.");
+        return static_cast<triton::uint8>(byte);
+      }
+
+
+      static triton::uint64 readVarint(std::istream& stream) {
+        triton::uint64 value = 0;
+        for (triton::uint32 shift = 0; shift < 64; shift += 7) {
+          triton::uint8 byte = readByte(stream);
+          value |= static_cast<triton::uint64>(byte & 0x7f) << shift;
+          if ((byte & 0x80) == 0)
+            return value;
+        }
+        throw triton::exceptions::SymbolicEngine("SymbolicSerializer::deserialize(): Invalid varint.");
+      }
+
+
+      static triton::uint512 readInteger(std::istream& stream) {
+        triton::uint512 value = 0;
+        for (triton::uint32 shift = 0; shift < 512; shift += 7) {
+          triton::uint8 byte = readByte(stream);
+          value |= triton::uint512(byte & 0x7f) << shift;
+          if ((byte & 0x80) == 0)
+            return value;
+        }
+        throw triton::exceptions::SymbolicEngine("SymbolicSerializer::deserialize(): Invalid integer.");
+      }
+
+
+      static std::string readString(std::istream& stream) {
+        triton::uint64 size = readVarint(stream);
+        std::string value;
+        char buffer[4096];
+
+        /* Read by chunks so that a corrupted size does not allocate a huge string */
+        while (size) {
+          std::streamsize count = static_cast<std::streamsize>(std::min<triton::uint64>(size, sizeof(buffer)));
+          if (!stream.read(buffer, count))
+            throw triton::exceptions::SymbolicEngine("SymbolicSerializer::deserialize(): Unexpected end of stream.");
+          value.append(buffer, static_cast<size_t>(count));
+          size -= count;
+        }
+
+        return value;
+      }
+
+
+      /* Reads an index written as a delta from the number of items already loaded */
+      static triton::usize readIndex(std::istream& stream, triton::usize count) {
+        triton::uint64 delta = readVarint(stream);
+        if (delta == 0 || delta > count)
+          throw triton::exceptions::SymbolicEngine("SymbolicSerializer::deserialize(): Invalid index.");
+        return static_cast<triton::usize>(count - delta);
+      }
+
+
+      /* Reads an index into a table */
+      static triton::usize readTableIndex(std::istream& stream, triton::usize size) {
+        triton::uint64 index = readVarint(stream);
+        if (index >= size)
+          throw triton::exceptions::SymbolicEngine("SymbolicSerializer::deserialize(): Invalid index.");
+        return static_cast<triton::usize>(index);
+      }
+
+
+      /* Returns the value of an integer node */
+      static triton::uint512 getInteger(const triton::ast::SharedAbstractNode& node) {
+        if (node->getType() != triton::ast::INTEGER_NODE)
+          throw triton::exceptions::SymbolicEngine("SymbolicSerializer::deserialize(): Expects an integer node.");
+        return reinterpret_cast<triton::ast::IntegerNode*>(node.get())->getInteger();
+      }
+
+
+      /* Returns the value of a string node */
+      static std::string getString(const triton::ast::SharedAbstractNode& node) {
+        if (node->getType() != triton::ast::STRING_NODE)
+          throw triton::exceptions::SymbolicEngine("SymbolicSerializer::deserialize(): Expects a string node.");
+        return reinterpret_cast<triton::ast::StringNode*>(node.get())->getString();
+      }
+
+
+      /* Returns the value of an integer node used as parameter */
+      static triton::uint32 getParameter(const triton::ast::SharedAbstractNode& node) {
+        return static_cast<triton::uint32>(getInteger(node));
+      }
+
+
+      SymbolicSerializer::SymbolicSerializer(const triton::arch::Architecture* architecture, triton::engines::symbolic::SymbolicEngine* symbolic, const triton::ast::SharedAstContext& astCtxt)
+        : architecture(architecture),
+          symbolic(symbolic),
+          astCtxt(astCtxt) {
+      }
+
+
+      void SymbolicSerializer::serialize(std::ostream& stream,
+                                         const std::vector<triton::ast::SharedAbstractNode>& nodes,
+                                         const std::vector<SharedSymbolicExpression>& exprs,
+                                         const std::vector<triton::engines::symbolic::PathConstraint>& pcs) const {
+        /* A record is either a node or an expression */
+        using Record = std::pair<triton::ast::AbstractNode*, SymbolicExpression*>;
+
+        std::unordered_map<const triton::ast::AbstractNode*, triton::usize> nodeIds;
+        std::unordered_map<const SymbolicExpression*, triton::usize> exprIds;
+        std::unordered_map<const SymbolicVariable*, triton::usize> varIds;
+        std::vector<triton::ast::AbstractNode*> vars;
+        std::unordered_set<const void*> visited;
+        std::stack<std::pair<Record, bool>> worklist;
+        std::vector<Record> records;
+
+        for (const auto& node : nodes)
+          worklist.push({Record(node.get(), nullptr), false});
+
+        for (const auto& expr : exprs)
+          worklist.push({Record(nullptr, expr.get()), false});
+
+        for (const auto& pc : pcs) {
+          for (const auto& branch : pc.getBranchConstraints())
+            worklist.push({Record(std::get<3>(branch).get(), nullptr), false});
+        }
+
+        /*
+         *  Sort nodes and expressions topologically, so that a record
+         *  only refers to records written before it.
+         */
+        while (!worklist.empty()) {
+          Record record   = worklist.top().first;
+          bool postOrder  = worklist.top().second;
+          worklist.pop();
+
+          if (postOrder) {
+            if (record.first) {
+              nodeIds.emplace(record.first, nodeIds.size());
+              if (record.first->getType() == triton::ast::VARIABLE_NODE) {
+                const auto& var = reinterpret_cast<triton::ast::VariableNode*>(record.first)->getSymbolicVariable();
+                if (varIds.emplace(var.get(), vars.size()).second)
+                  vars.push_back(record.first);
+              }
+            }
+            else {
+              exprIds.emplace(record.second, exprIds.size());
+            }
+            records.push_back(record);
+            continue;
+          }
+
+          const void* key = record.first ? static_cast<const void*>(record.first) : static_cast<const void*>(record.second);
+          if (key == nullptr)
+            throw triton::exceptions::SymbolicEngine("SymbolicSerializer::serialize(): Node cannot be null.");
+
+          if (!visited.insert(key).second)
+            continue;
+
+          worklist.push({record, true});
+
+          if (record.first) {
+            for (const auto& child : record.first->getChildren()) {
+              if (visited.find(child.get()) == visited.end())
+                worklist.push({Record(child.get(), nullptr), false});
+            }
+            if (record.first->getType() == triton::ast::REFERENCE_NODE) {
+              auto* expr = reinterpret_cast<triton::ast::ReferenceNode*>(record.first)->getSymbolicExpression().get();
+              if (visited.find(expr) == visited.end())
+                worklist.push({Record(nullptr, expr), false});
+            }
+          }
+          else {
+            auto* ast = record.second->getAst().get();
+            if (visited.find(ast) == visited.end())
+              worklist.push({Record(ast, nullptr), false});
+          }
+        }
+
+        /* Header */
+        stream.write(magic, sizeof(magic));
+        writeVarint(stream, version);
+        writeVarint(stream, this->architecture->getArchitecture());
+
+        /* Symbolic variables */
+        writeVarint(stream, vars.size());
+        for (auto* node : vars) {
+          const auto& var = reinterpret_cast<triton::ast::VariableNode*>(node)->getSymbolicVariable();
+          writeVarint(stream, var->getId());
+          writeVarint(stream, var->getType());
+          writeVarint(stream, var->getOrigin());
+          writeVarint(stream, var->getSize());
+          writeString(stream, var->getAlias());
+          writeString(stream, var->getComment());
+          writeInteger(stream, node->evaluate());
+        }
+
+        /* Records */
+        triton::usize nodeCount = 0;
+        writeVarint(stream, records.size());
+        for (const auto& record : records) {
+          if (record.second) {
+            const SymbolicExpression* expr = record.second;
+            writeVarint(stream, expressionRecord);
+            writeVarint(stream, expr->getType());
+            writeString(stream, expr->getComment());
+            if (expr->isMemory() && expr->getOriginMemory().getSize()) {
+              writeVarint(stream, MEMORY_ORIGIN);
+              writeVarint(stream, expr->getOriginMemory().getAddress());
+              writeVarint(stream, expr->getOriginMemory().getSize());
+            }
+            else if (expr->isRegister() && expr->getOriginRegister().getId() != triton::arch::ID_REG_INVALID) {
+              writeVarint(stream, REGISTER_ORIGIN);
+              writeVarint(stream, expr->getOriginRegister().getId());
+            }
+            else {
+              writeVarint(stream, NO_ORIGIN);
+            }
+            writeVarint(stream, nodeCount - nodeIds.at(expr->getAst().get()));
+            continue;
+          }
+
+          triton::ast::AbstractNode* node = record.first;
+          writeVarint(stream, node->getType());
+          switch (node->getType()) {
+            case triton::ast::INTEGER_NODE:
+              writeInteger(stream, reinterpret_cast<triton::ast::IntegerNode*>(node)->getInteger());
+              break;
+
+            case triton::ast::STRING_NODE:
+              writeString(stream, reinterpret_cast<triton::ast::StringNode*>(node)->getString());
+              break;
+
+            case triton::ast::VARIABLE_NODE:
+              writeVarint(stream, varIds.at(reinterpret_cast<triton::ast::VariableNode*>(node)->getSymbolicVariable().get()));
+              break;
+
+            case triton::ast::REFERENCE_NODE:
+              writeVarint(stream, exprIds.at(reinterpret_cast<triton::ast::ReferenceNode*>(node)->getSymbolicExpression().get()));
+              break;
+
+            default:
+              writeVarint(stream, node->getChildren().size());
+              for (const auto& child : node->getChildren())
+                writeVarint(stream, nodeCount - nodeIds.at(child.get()));
+              break;
+          }
+          nodeCount++;
+        }
+
+        /* Roots */
+        writeVarint(stream, nodes.size());
+        for (const auto& node : nodes)
+          writeVarint(stream, nodeIds.at(node.get()));
+
+        writeVarint(stream, exprs.size());
+        for (const auto& expr : exprs)
+          writeVarint(stream, exprIds.at(expr.get()));
+
+        writeVarint(stream, pcs.size());
+        for (const auto& pc : pcs) {
+          writeVarint(stream, pc.getThreadId());
+          writeVarint(stream, pc.getBranchConstraints().size());
+          for (const auto& branch : pc.getBranchConstraints()) {
+            writeVarint(stream, std::get<0>(branch));
+            writeVarint(stream, std::get<1>(branch));
+            writeVarint(stream, std::get<2>(branch));
+            writeVarint(stream, nodeIds.at(std::get<3>(branch).get()));
+          }
+        }
+
+        if (!stream)
+          throw triton::exceptions::SymbolicEngine("SymbolicSerializer::serialize(): Cannot write the stream.");
+      }
+
+
+      triton::ast::SharedAbstractNode SymbolicSerializer::loadVariable(std::istream& stream, const std::unordered_map<std::string, SharedSymbolicVariable>& existing) {
+        triton::usize id        = static_cast<triton::usize>(readVarint(stream));
+        triton::uint64 type     = readVarint(stream);
+        triton::uint64 origin   = readVarint(stream);
+        triton::uint64 size     = readVarint(stream);
+        std::string alias       = readString(stream);
+        std::string comment     = readString(stream);
+        triton::uint512 value   = readInteger(stream);
+        SharedSymbolicVariable var = nullptr;
+
+        if (type > UNDEFINED_VARIABLE || size == 0 || size > triton::bitsize::max_supported)
+          throw triton::exceptions::SymbolicEngine("SymbolicSerializer::deserialize(): Invalid symbolic variable.");
+
+        /* Reuse the variable if the same name (or alias) is requested with the same size. It keeps its value. */
+        auto it = existing.find(alias.empty() ? TRITON_SYMVAR_NAME + std::to_string(id) : alias);
+        if (it != existing.end() && it->second->getSize() == size)
+          return this->astCtxt->variable(it->second);
+
+        var = this->symbolic->newSymbolicVariable(static_cast<variable_e>(type), origin, static_cast<triton::uint32>(size), alias);
+        var->setComment(comment);
+
+        auto node = this->astCtxt->variable(var);
+        this->astCtxt->updateVariable(var->getName(), value & node->getBitvectorMask());
+
+        return node;
+      }
+
+
+      triton::ast::SharedAbstractNode SymbolicSerializer::loadNode(triton::uint32 kind, std::istream& stream,
+                                                                   const std::vector<triton::ast::SharedAbstractNode>& nodes,
+                                                                   const std::vector<triton::ast::SharedAbstractNode>& vars,
+                                                                   const std::vector<SharedSymbolicExpression>& exprs) {
+        switch (kind) {
+          case triton::ast::INTEGER_NODE:   return this->astCtxt->integer(readInteger(stream));
+          case triton::ast::STRING_NODE:    return this->astCtxt->string(readString(stream));
+          case triton::ast::VARIABLE_NODE:  return vars[readTableIndex(stream, vars.size())];
+          case triton::ast::REFERENCE_NODE: return this->astCtxt->reference(exprs[readTableIndex(stream, exprs.size())]);
+          default:
+            break;
+        }
+
+        /* Children, a child may be repeated. Each index takes at least one byte, thus the stream bounds the count. */
+        triton::uint64 count = readVarint(stream);
+        std::vector<triton::ast::SharedAbstractNode> c;
+        c.reserve(static_cast<size_t>(std::min<triton::uint64>(count, nodes.size())));
+        for (triton::uint64 i = 0; i < count; i++)
+          c.push_back(nodes[readIndex(stream, nodes.size())]);
+
+        auto arity = [&](triton::usize n) {
+          if (c.size() != n)
+            throw triton::exceptions::SymbolicEngine("SymbolicSerializer::deserialize(): Invalid number of children.");
+        };
+
+        auto variadic = [&](triton::usize n) {
+          if (c.size() < n)
+            throw triton::exceptions::SymbolicEngine("SymbolicSerializer::deserialize(): Invalid number of children.");
+        };
+
+        switch (kind) {
+          case triton::ast::ASSERT_NODE:    arity(1); return this->astCtxt->assert_(c[0]);
+          case triton::ast::BVADD_NODE:     arity(2); return this->astCtxt->bvadd(c[0], c[1]);
+          case triton::ast::BVAND_NODE:     arity(2); return this->astCtxt->bvand(c[0], c[1]);
+          case triton::ast::BVASHR_NODE:    arity(2); return this->astCtxt->bvashr(c[0], c[1]);
+          case triton::ast::BVLSHR_NODE:    arity(2); return this->astCtxt->bvlshr(c[0], c[1]);
+          case triton::ast::BVMUL_NODE:     arity(2); return this->astCtxt->bvmul(c[0], c[1]);
+          case triton::ast::BVNAND_NODE:    arity(2); return this->astCtxt->bvnand(c[0], c[1]);
+          case triton::ast::BVNEG_NODE:     arity(1); return this->astCtxt->bvneg(c[0]);
+          case triton::ast::BVNOR_NODE:     arity(2); return this->astCtxt->bvnor(c[0], c[1]);
+          case triton::ast::BVNOT_NODE:     arity(1); return this->astCtxt->bvnot(c[0]);
+          case triton::ast::BVOR_NODE:      arity(2); return this->astCtxt->bvor(c[0], c[1]);
+          case triton::ast::BVROL_NODE:     arity(2); return this->astCtxt->bvrol(c[0], getParameter(c[1]));
+          case triton::ast::BVROR_NODE:     arity(2); return this->astCtxt->bvror(c[0], getParameter(c[1]));
+          case triton::ast::BVSDIV_NODE:    arity(2); return this->astCtxt->bvsdiv(c[0], c[1]);
+          case triton::ast::BVSGE_NODE:     arity(2); return this->astCtxt->bvsge(c[0], c[1]);
+          case triton::ast::BVSGT_NODE:     arity(2); return this->astCtxt->bvsgt(c[0], c[1]);
+          case triton::ast::BVSHL_NODE:     arity(2); return this->astCtxt->bvshl(c[0], c[1]);
+          case triton::ast::BVSLE_NODE:     arity(2); return this->astCtxt->bvsle(c[0], c[1]);
+          case triton::ast::BVSLT_NODE:     arity(2); return this->astCtxt->bvslt(c[0], c[1]);
+          case triton::ast::BVSMOD_NODE:    arity(2); return this->astCtxt->bvsmod(c[0], c[1]);
+          case triton::ast::BVSREM_NODE:    arity(2); return this->astCtxt->bvsrem(c[0], c[1]);
+          case triton::ast::BVSUB_NODE:     arity(2); return this->astCtxt->bvsub(c[0], c[1]);
+          case triton::ast::BVUDIV_NODE:    arity(2); return this->astCtxt->bvudiv(c[0], c[1]);
+          case triton::ast::BVUGE_NODE:     arity(2); return this->astCtxt->bvuge(c[0], c[1]);
+          case triton::ast::BVUGT_NODE:     arity(2); return this->astCtxt->bvugt(c[0], c[1]);
+          case triton::ast::BVULE_NODE:     arity(2); return this->astCtxt->bvule(c[0], c[1]);
+          case triton::ast::BVULT_NODE:     arity(2); return this->astCtxt->bvult(c[0], c[1]);
+          case triton::ast::BVUREM_NODE:    arity(2); return this->astCtxt->bvurem(c[0], c[1]);
+          case triton::ast::BVXNOR_NODE:    arity(2); return this->astCtxt->bvxnor(c[0], c[1]);
+          case triton::ast::BVXOR_NODE:     arity(2); return this->astCtxt->bvxor(c[0], c[1]);
+          case triton::ast::BV_NODE:        arity(2); return this->astCtxt->bv(getInteger(c[0]), getParameter(c[1]));
+          case triton::ast::COMPOUND_NODE:  variadic(1); return this->astCtxt->compound(c);
+          case triton::ast::CONCAT_NODE:    variadic(2); return this->astCtxt->concat(c);
+          case triton::ast::DECLARE_NODE:   arity(1); return this->astCtxt->declare(c[0]);
+          case triton::ast::DISTINCT_NODE:  arity(2); return this->astCtxt->distinct(c[0], c[1]);
+          case triton::ast::EQUAL_NODE:     arity(2); return this->astCtxt->equal(c[0], c[1]);
+          case triton::ast::EXTRACT_NODE:   arity(3); return this->astCtxt->extract(getParameter(c[0]), getParameter(c[1]), c[2]);
+          case triton::ast::FORALL_NODE:    variadic(2); return this->astCtxt->forall(std::vector<triton::ast::SharedAbstractNode>(c.begin(), c.end() - 1), c.back());
+          case triton::ast::IFF_NODE:       arity(2); return this->astCtxt->iff(c[0], c[1]);
+          case triton::ast::ITE_NODE:       arity(3); return this->astCtxt->ite(c[0], c[1], c[2]);
+          case triton::ast::LAND_NODE:      variadic(2); return this->astCtxt->land(c);
+          case triton::ast::LET_NODE:       arity(3); return this->astCtxt->let(getString(c[0]), c[1], c[2]);
+          case triton::ast::LNOT_NODE:      arity(1); return this->astCtxt->lnot(c[0]);
+          case triton::ast::LOR_NODE:       variadic(2); return this->astCtxt->lor(c);
+          case triton::ast::LXOR_NODE:      variadic(2); return this->astCtxt->lxor(c);
+          case triton::ast::SX_NODE:        arity(2); return this->astCtxt->sx(getParameter(c[0]), c[1]);
+          case triton::ast::ZX_NODE:        arity(2); return this->astCtxt->zx(getParameter(c[0]), c[1]);
+          default:
+            throw triton::exceptions::SymbolicEngine("SymbolicSerializer::deserialize(): Invalid kind of node.");
+        }
+      }
+
+
+      SharedSymbolicExpression SymbolicSerializer::loadExpression(std::istream& stream, const std::vector<triton::ast::SharedAbstractNode>& nodes) {
+        triton::uint64 type     = readVarint(stream);
+        std::string comment     = readString(stream);
+        triton::uint64 origin   = readVarint(stream);
+        triton::arch::MemoryAccess mem;
+        triton::arch::register_e reg = triton::arch::ID_REG_INVALID;
+
+        if (type > VOLATILE_EXPRESSION)
+          throw triton::exceptions::SymbolicEngine("SymbolicSerializer::deserialize(): Invalid symbolic expression.");
+
+        switch (origin) {
+          case NO_ORIGIN:
+            break;
+
+          case MEMORY_ORIGIN: {
+            triton::uint64 addr = readVarint(stream);
+            triton::uint64 size = readVarint(stream);
+            mem = triton::arch::MemoryAccess(addr, static_cast<triton::uint32>(size));
+            break;
+          }
+
+          case REGISTER_ORIGIN:
+            reg = static_cast<triton::arch::register_e>(readVarint(stream));
+            break;
+
+          default:
+            throw triton::exceptions::SymbolicEngine("SymbolicSerializer::deserialize(): Invalid origin.");
+        }
+
+        const auto& ast = nodes[readIndex(stream, nodes.size())];
+        auto expr = this->symbolic->newSymbolicExpression(ast, static_cast<expression_e>(type), comment);
+
+        if (origin == MEMORY_ORIGIN)
+          expr->setOriginMemory(mem);
+        else if (origin == REGISTER_ORIGIN)
+          expr->setOriginRegister(this->architecture->getRegister(reg));
+
+        return expr;
+      }
+
+
+      void SymbolicSerializer::deserialize(std::istream& stream,
+                                           std::vector<triton::ast::SharedAbstractNode>& nodes,
+                                           std::vector<SharedSymbolicExpression>& exprs,
+                                           std::vector<triton::engines::symbolic::PathConstraint>& pcs,
+                                           bool reuseVariables) {
+        std::vector<triton::ast::SharedAbstractNode> nodeTable;
+        std::vector<triton::ast::SharedAbstractNode> varTable;
+        std::vector<SharedSymbolicExpression> exprTable;
+        char header[sizeof(magic)];
+
+        /* Header */
+        if (!stream.read(header, sizeof(header)) || std::memcmp(header, magic, sizeof(magic)) != 0)
+          throw triton::exceptions::SymbolicEngine("SymbolicSerializer::deserialize(): Invalid format.");
+
+        if (readVarint(stream) != version)
+          throw triton::exceptions::SymbolicEngine("SymbolicSerializer::deserialize(): Unsupported version.");
+
+        if (readVarint(stream) != this->architecture->getArchitecture())
+          throw triton::exceptions::SymbolicEngine("SymbolicSerializer::deserialize(): The architecture does not match.");
+
+        /* Symbolic variables, the existing ones are looked up by alias and by name */
+        std::unordered_map<std::string, SharedSymbolicVariable> existing;
+        if (reuseVariables) {
+          for (const auto& item : this->symbolic->getSymbolicVariables()) {
+            existing.emplace(item.second->getName(), item.second);
+            if (!item.second->getAlias().empty())
+              existing.emplace(item.second->getAlias(), item.second);
+          }
+        }
+
+        triton::uint64 count = readVarint(stream);
+        for (triton::uint64 i = 0; i < count; i++)
+          varTable.push_back(this->loadVariable(stream, existing));
+
+        /* Records */
+        count = readVarint(stream);
+        for (triton::uint64 i = 0; i < count; i++) {
+          triton::uint64 kind = readVarint(stream);
+          if (kind == expressionRecord)
+            exprTable.push_back(this->loadExpression(stream, nodeTable));
+          else
+            nodeTable.push_back(this->loadNode(static_cast<triton::uint32>(kind), stream, nodeTable, varTable, exprTable));
+        }
+
+        /* Roots */
+        count = readVarint(stream);
+        for (triton::uint64 i = 0; i < count; i++)
+          nodes.push_back(nodeTable[readTableIndex(stream, nodeTable.size())]);
+
+        count = readVarint(stream);
+        for (triton::uint64 i = 0; i < count; i++)
+          exprs.push_back(exprTable[readTableIndex(stream, exprTable.size())]);
+
+        count = readVarint(stream);
+        for (triton::uint64 i = 0; i < count; i++) {
+          triton::engines::symbolic::PathConstraint pc;
+          pc.setThreadId(static_cast<triton::uint32>(readVarint(stream)));
+          triton::uint64 branches = readVarint(stream);
+          for (triton::uint64 j = 0; j < branches; j++) {
+            bool taken          = readVarint(stream) != 0;
+            triton::uint64 src  = readVarint(stream);
+            triton::uint64 dst  = readVarint(stream);
+            pc.addBranchConstraint(taken, src, dst, nodeTable[readTableIndex(stream, nodeTable.size())]);
+          }
+          pcs.push_back(pc);
+        }
+      }
+
+    };
+  };
+};
@@ -6,7 +6,10 @@
 */
 
 #include <list>
+#include <memory>
+#include <triton/eGraph.hpp>
 #include <triton/exceptions.hpp>
+#include <triton/mbaSimplifier.hpp>
 #include <triton/symbolicSimplification.hpp>
 
 
@@ -104,6 +107,64 @@ if __name__ == "__main__":
     print 'Simp: ', c
 ~~~~~~~~~~~~~
 
+\subsection SMT_simplification_rules Simplification via rewrite rules
+<hr>
+
+Callbacks are called on every node, which is slow when they are written in Python. Triton also embeds a rewrite
+engine (see triton::engines::symbolic::RewriteEngine) with declarative rules written `lhs -> rhs`. The left-hand
+sides are compiled into a single matcher and the rules are applied bottom-up, once per node of the DAG, before the
+simplification callbacks. Variables are identifiers, literals take the size of the matched node and text after `;`
+is a comment.
+
+~~~~~~~~~~~~~{.py}
+>>> ctx.addSimplificationRule('''
+...     (bvxor x x)          -> 0      ; A ^ A = 0
+...     (bvand x (bvnot x))  -> 0
+...     (bvor (bvand x (bvnot y)) (bvand (bvnot x) y)) -> (bvxor x y)
+... ''')
+
+>>> a = ctx.getAstContext().variable(ctx.newSymbolicVariable(8))
+>>> b = ctx.getAstContext().variable(ctx.newSymbolicVariable(8))
+>>> print ctx.simplify((~b & a) | (~a & b))
+(bvxor SymVar_0 SymVar_1)
+~~~~~~~~~~~~~
+
+\subsection SMT_simplification_egraph Simplification via equality saturation
+<hr>
+
+Rewriting in one direction may get stuck in a local minimum, typically on mixed boolean-arithmetic expressions where
+an expression must grow before it shrinks. The triton::API::processEqualitySaturation() function (`saturate()` in Python)
+adds the AST to an e-graph (see triton::engines::symbolic::EGraph), applies the saturation rules everywhere without
+removing anything until nothing changes or a budget (number of nodes, time in milliseconds) is exhausted, then extracts
+the cheapest equivalent AST. The cost is either the number of nodes (SYMBOLIC.SIZE_COST) or a weight favoring the linear
+operators for a solver (SYMBOLIC.SOLVER_COST). A default set of rules is provided, see triton::API::addSaturationRule()
+and triton::API::clearSaturationRules() to change it.
+
+~~~~~~~~~~~~~{.py}
+>>> x = ctx.getAstContext().variable(ctx.newSymbolicVariable(32))
+>>> y = ctx.getAstContext().variable(ctx.newSymbolicVariable(32))
+>>> print ctx.saturate(((x ^ y) + 2 * (x & y)) - y)
+SymVar_0
+~~~~~~~~~~~~~
+
+\subsection SMT_simplification_mba Simplification of mixed boolean-arithmetic expressions
+<hr>
+
+Obfuscators hide simple operations behind linear mixed boolean-arithmetic (MBA) expressions, sums of bitwise expressions
+multiplied by constants. Such an expression over `t` subexpressions (its atoms) is fully determined by its values when
+each atom is 0 or 1. The triton::API::processMbaSimplification() function (`simplifyMba()` in Python) finds the linear
+MBA subexpressions of an AST over at most 4 atoms, evaluates each one on the `2^t` points and rewrites it to a minimal
+normal form (see triton::engines::symbolic::MbaSimplifier). No solver is involved and references are not unrolled.
+
+~~~~~~~~~~~~~{.py}
+>>> x = ctx.getAstContext().variable(ctx.newSymbolicVariable(32))
+>>> y = ctx.getAstContext().variable(ctx.newSymbolicVariable(32))
+>>> print ctx.simplifyMba((x ^ y) + 2 * (x & y))
+(bvadd SymVar_0 SymVar_1)
+>>> print ctx.simplifyMba(((x | y) << 1) - (x ^ y) - x - y + ~x + 1)
+(bvneg SymVar_0)
+~~~~~~~~~~~~~
+
 \subsection SMT_simplification_z3 Simplification via Z3
 <hr>
 
@@ -157,8 +218,20 @@ namespace triton {
     namespace symbolic {
 
 
+      /* The default rules of the equality saturation, parsed once */
+      static const std::shared_ptr<const RewriteEngine>& getDefaultSaturationRules(void) {
+        static const std::shared_ptr<const RewriteEngine> rules = [] () -> std::shared_ptr<const RewriteEngine> {
+          std::shared_ptr<RewriteEngine> engine = std::make_shared<RewriteEngine>();
+          engine->addRules(triton::engines::symbolic::EGraph::getDefaultRules());
+          return engine;
+        }();
+        return rules;
+      }
+
+
       SymbolicSimplification::SymbolicSimplification(triton::callbacks::Callbacks* callbacks) {
-        this->callbacks = callbacks;
+        this->callbacks       = callbacks;
+        this->saturationRules = getDefaultSaturationRules();
       }
 
 
@@ -168,7 +241,62 @@ namespace triton {
 
 
       void SymbolicSimplification::copy(const SymbolicSimplification& other) {
-        this->callbacks = other.callbacks;
+        this->callbacks       = other.callbacks;
+        this->rewriteEngine   = other.rewriteEngine;
+        this->saturationRules = other.saturationRules;
+      }
+
+
+      void SymbolicSimplification::addSimplificationRule(const std::string& rule) {
+        this->rewriteEngine.addRules(rule);
+      }
+
+
+      void SymbolicSimplification::clearSimplificationRules(void) {
+        this->rewriteEngine.clearRules();
+      }
+
+
+      std::vector<std::string> SymbolicSimplification::getSimplificationRules(void) const {
+        return this->rewriteEngine.getRules();
+      }
+
+
+      void SymbolicSimplification::addSaturationRule(const std::string& rule) {
+        std::shared_ptr<RewriteEngine> rules = std::make_shared<RewriteEngine>(*this->saturationRules);
+        rules->addRules(rule);
+        this->saturationRules = rules;
+      }
+
+
+      void SymbolicSimplification::clearSaturationRules(void) {
+        this->saturationRules = std::make_shared<RewriteEngine>();
+      }
+
+
+      std::vector<std::string> SymbolicSimplification::getSaturationRules(void) const {
+        return this->saturationRules->getRules();
+      }
+
+
+      triton::ast::SharedAbstractNode SymbolicSimplification::processEqualitySaturation(const triton::ast::SharedAbstractNode& node, triton::usize nodeLimit, triton::usize timeLimit, triton::engines::symbolic::cost_e cost) const {
+        if (node == nullptr)
+          throw triton::exceptions::SymbolicSimplification("SymbolicSimplification::processEqualitySaturation(): node cannot be null.");
+
+        triton::engines::symbolic::EGraph egraph(*this->saturationRules, nodeLimit, timeLimit);
+        triton::usize eclass = egraph.add(node);
+        egraph.saturate();
+
+        return egraph.extract(eclass, cost);
+      }
+
+
+      triton::ast::SharedAbstractNode SymbolicSimplification::processMbaSimplification(const triton::ast::SharedAbstractNode& node) const {
+        if (node == nullptr)
+          throw triton::exceptions::SymbolicSimplification("SymbolicSimplification::processMbaSimplification(): node cannot be null.");
+
+        triton::engines::symbolic::MbaSimplifier mba;
+        return mba.simplify(node);
       }
 
 
@@ -179,8 +307,11 @@ namespace triton {
         if (node == nullptr)
           throw triton::exceptions::SymbolicSimplification("SymbolicSimplification::processSimplification(): node cannot be null.");
 
+        if (!this->rewriteEngine.isEmpty())
+          snode = this->rewriteEngine.rewrite(snode);
+
         if (this->callbacks && this->callbacks->isDefined(triton::callbacks::SYMBOLIC_SIMPLIFICATION)) {
-          snode = this->callbacks->processCallbacks(triton::callbacks::SYMBOLIC_SIMPLIFICATION, node);
+          snode = this->callbacks->processCallbacks(triton::callbacks::SYMBOLIC_SIMPLIFICATION, snode);
           /*
            *  We use a worklist strategy to avoid recursive calls
            *  and so stack overflow when going through a big AST.
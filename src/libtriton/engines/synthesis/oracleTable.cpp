@@ -0,0 +1,375 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <fstream>
+#include <sstream>
+
+#include <triton/astContext.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/oracleTable.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace synthesis {
+
+      /* The names of the tokens in the files */
+      static const char* tokenNames[] = {"x", "y", "z", "not", "neg", "add", "sub", "mul", "and", "or", "xor"};
+
+
+      /* Returns the number of operands of a token */
+      static triton::uint32 getArity(OracleTable::token_e token) {
+        switch (token) {
+          case OracleTable::TOKEN_X:
+          case OracleTable::TOKEN_Y:
+          case OracleTable::TOKEN_Z:
+            return 0;
+          case OracleTable::TOKEN_NOT:
+          case OracleTable::TOKEN_NEG:
+            return 1;
+          default:
+            return 2;
+        }
+      }
+
+
+      /* Applies an operation */
+      static triton::uint64 apply(OracleTable::token_e token, triton::uint64 a, triton::uint64 b) {
+        switch (token) {
+          case OracleTable::TOKEN_NOT: return ~a;
+          case OracleTable::TOKEN_NEG: return ~a + 1;
+          case OracleTable::TOKEN_ADD: return a + b;
+          case OracleTable::TOKEN_SUB: return a - b;
+          case OracleTable::TOKEN_MUL: return a * b;
+          case OracleTable::TOKEN_AND: return a & b;
+          case OracleTable::TOKEN_OR:  return a | b;
+          case OracleTable::TOKEN_XOR: return a ^ b;
+          default:
+            throw triton::exceptions::SynthesisEngine("OracleTable::apply(): Invalid operation.");
+        }
+      }
+
+
+      /* Hashes outputs masked to a size */
+      static triton::uint64 getSignature(const std::vector<triton::uint64>& outputs, triton::uint64 mask) {
+        triton::uint64 hash = 0xcbf29ce484222325;
+        for (triton::uint64 value : outputs) {
+          hash ^= (value & mask) + 0x9e3779b97f4a7c15 + (hash << 6) + (hash >> 2);
+          hash *= 0x100000001b3;
+        }
+        return hash;
+      }
+
+
+      /* Returns the mask of a size */
+      static triton::uint64 getMask(triton::uint32 size) {
+        return (size >= 64) ? ~0ULL : ((1ULL << size) - 1);
+      }
+
+
+      OracleTable::OracleTable() {
+        /* The points 0, 1 and -1 then pseudo-random points (splitmix64), the same on all platforms */
+        triton::uint64 state = 0x5472697430726163;
+
+        this->operations = 0;
+        for (triton::usize i = 0; i < SAMPLES; i++) {
+          std::array<triton::uint64, VARIABLES> point;
+          for (triton::uint32 v = 0; v < VARIABLES; v++) {
+            if (i == 0)      point[v] = 0;
+            else if (i == 1) point[v] = 1;
+            else if (i == 2) point[v] = ~0ULL;
+            else {
+              state += 0x9e3779b97f4a7c15;
+              triton::uint64 z = state;
+              z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+              z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+              point[v] = z ^ (z >> 31);
+            }
+          }
+          this->samples.push_back(point);
+        }
+      }
+
+
+      std::vector<triton::uint64> OracleTable::run(const std::vector<token_e>& program) const {
+        std::vector<triton::uint64> outputs;
+
+        for (const auto& point : this->samples) {
+          std::vector<triton::uint64> stack;
+          for (token_e token : program) {
+            triton::uint32 arity = getArity(token);
+            if (stack.size() < arity)
+              throw triton::exceptions::SynthesisEngine("OracleTable::run(): Invalid expression.");
+            if (arity == 0) {
+              stack.push_back(point[token - TOKEN_X]);
+            }
+            else if (arity == 1) {
+              stack.back() = apply(token, stack.back(), 0);
+            }
+            else {
+              triton::uint64 b = stack.back();
+              stack.pop_back();
+              stack.back() = apply(token, stack.back(), b);
+            }
+          }
+          if (stack.size() != 1)
+            throw triton::exceptions::SynthesisEngine("OracleTable::run(): Invalid expression.");
+          outputs.push_back(stack.back());
+        }
+
+        return outputs;
+      }
+
+
+      void OracleTable::add(const std::vector<token_e>& program, triton::uint32 operations, const std::vector<triton::uint64>& outputs) {
+        Oracle oracle;
+        oracle.program    = program;
+        oracle.operations = operations;
+        oracle.outputs    = outputs;
+        this->oracles.push_back(oracle);
+        this->signatures.clear();
+      }
+
+
+      void OracleTable::build(triton::uint32 operations) {
+        /* The expressions of each 64-bit behavior, to keep only the smallest one */
+        std::unordered_map<triton::uint64, std::vector<triton::usize>> seen;
+        /* The expressions by number of tokens */
+        std::vector<std::vector<triton::usize>> sizes(2 * operations + 2);
+
+        static const token_e unary[]  = {TOKEN_NOT, TOKEN_NEG};
+        static const token_e binary[] = {TOKEN_ADD, TOKEN_SUB, TOKEN_MUL, TOKEN_AND, TOKEN_OR, TOKEN_XOR};
+
+        this->oracles.clear();
+        this->signatures.clear();
+        this->operations = operations;
+
+        auto insert = [&](const std::vector<token_e>& program, triton::uint32 ops, const std::vector<triton::uint64>& outputs) {
+          auto& bucket = seen[getSignature(outputs, ~0ULL)];
+          for (triton::usize index : bucket) {
+            if (this->oracles[index].outputs == outputs)
+              return;
+          }
+          bucket.push_back(this->oracles.size());
+          sizes[program.size()].push_back(this->oracles.size());
+          this->add(program, ops, outputs);
+        };
+
+        for (triton::uint32 v = 0; v < VARIABLES; v++) {
+          std::vector<token_e> program(1, static_cast<token_e>(TOKEN_X + v));
+          insert(program, 0, this->run(program));
+        }
+
+        for (triton::usize size = 2; size < sizes.size(); size++) {
+          std::vector<triton::uint64> outputs(SAMPLES);
+
+          /* Unary operations of the expressions of size - 1 */
+          for (triton::usize index = 0; index < sizes[size - 1].size(); index++) {
+            const Oracle operand = this->oracles[sizes[size - 1][index]];
+            if (operand.operations + 1 > operations)
+              continue;
+            for (token_e op : unary) {
+              for (triton::usize i = 0; i < SAMPLES; i++)
+                outputs[i] = apply(op, operand.outputs[i], 0);
+              std::vector<token_e> program = operand.program;
+              program.push_back(op);
+              insert(program, operand.operations + 1, outputs);
+            }
+          }
+
+          /* Binary operations of the expressions of sizes left and size - 1 - left */
+          for (triton::usize left = 1; left + 2 <= size; left++) {
+            triton::usize right = size - 1 - left;
+            for (triton::usize i = 0; i < sizes[left].size(); i++) {
+              const Oracle a = this->oracles[sizes[left][i]];
+              for (triton::usize j = 0; j < sizes[right].size(); j++) {
+                const Oracle& b = this->oracles[sizes[right][j]];
+                triton::uint32 ops = a.operations + b.operations + 1;
+                if (ops > operations)
+                  continue;
+
+                std::vector<std::pair<token_e, std::vector<triton::uint64>>> candidates;
+                for (token_e op : binary) {
+                  /* Commutative operations are enumerated once */
+                  if (op != TOKEN_SUB && (left > right || (left == right && i > j)))
+                    continue;
+                  for (triton::usize k = 0; k < SAMPLES; k++)
+                    outputs[k] = apply(op, a.outputs[k], b.outputs[k]);
+                  candidates.push_back(std::make_pair(op, outputs));
+                }
+
+                std::vector<token_e> operands = a.program;
+                operands.insert(operands.end(), b.program.begin(), b.program.end());
+                for (const auto& candidate : candidates) {
+                  std::vector<token_e> program = operands;
+                  program.push_back(candidate.first);
+                  insert(program, ops, candidate.second);
+                }
+              }
+            }
+          }
+        }
+      }
+
+
+      void OracleTable::load(const std::string& path) {
+        std::ifstream file(path);
+        std::string line;
+        std::vector<Oracle> loaded;
+        bool header = false;
+        triton::uint32 operations = 0;
+
+        if (!file.is_open())
+          throw triton::exceptions::SynthesisEngine("OracleTable::load(): Cannot open the file.");
+
+        while (std::getline(file, line)) {
+          std::istringstream stream(line);
+          std::string word;
+          std::vector<token_e> program;
+
+          if (line.empty() || line[0] == '#')
+            continue;
+
+          if (!header) {
+            if (!(stream >> operations))
+              throw triton::exceptions::SynthesisEngine("OracleTable::load(): Invalid header.");
+            header = true;
+            continue;
+          }
+
+          triton::uint32 ops = 0;
+          while (stream >> word) {
+            triton::uint32 token = 0;
+            while (token < TOKEN_LAST && word != tokenNames[token])
+              token++;
+            if (token == TOKEN_LAST)
+              throw triton::exceptions::SynthesisEngine("OracleTable::load(): Invalid token: " + word);
+            program.push_back(static_cast<token_e>(token));
+            ops += (getArity(static_cast<token_e>(token)) > 0);
+          }
+
+          Oracle oracle;
+          oracle.program    = program;
+          oracle.operations = ops;
+          oracle.outputs    = this->run(program);
+          loaded.push_back(oracle);
+        }
+
+        if (!header)
+          throw triton::exceptions::SynthesisEngine("OracleTable::load(): Invalid header.");
+
+        this->oracles    = loaded;
+        this->operations = operations;
+        this->signatures.clear();
+      }
+
+
+      void OracleTable::save(const std::string& path) const {
+        std::ofstream file(path);
+
+        if (!file.is_open())
+          throw triton::exceptions::SynthesisEngine("OracleTable::save(): Cannot open the file.");
+
+        file << "# Triton synthesis oracles: the maximum number of operations, then one expression in postfix order per line" << std::endl;
+        file << this->operations << std::endl;
+        for (const auto& oracle : this->oracles) {
+          for (triton::usize i = 0; i < oracle.program.size(); i++)
+            file << (i ? " " : "") << tokenNames[oracle.program[i]];
+          file << std::endl;
+        }
+
+        if (!file.good())
+          throw triton::exceptions::SynthesisEngine("OracleTable::save(): Cannot write the file.");
+      }
+
+
+      bool OracleTable::isEmpty(void) const {
+        return this->oracles.empty();
+      }
+
+
+      triton::usize OracleTable::getSize(void) const {
+        return this->oracles.size();
+      }
+
+
+      triton::uint32 OracleTable::getOperations(void) const {
+        return this->operations;
+      }
+
+
+      const std::vector<std::array<triton::uint64, OracleTable::VARIABLES>>& OracleTable::getSamples(void) const {
+        return this->samples;
+      }
+
+
+      std::vector<const OracleTable::Oracle*> OracleTable::lookup(const std::vector<triton::uint64>& outputs, triton::uint32 size) const {
+        std::vector<const Oracle*> ret;
+        triton::uint64 mask = getMask(size);
+
+        if (outputs.size() != SAMPLES)
+          throw triton::exceptions::SynthesisEngine("OracleTable::lookup(): Wrong number of outputs.");
+
+        auto it = this->signatures.find(size);
+        if (it == this->signatures.end()) {
+          it = this->signatures.insert(std::make_pair(size, std::unordered_map<triton::uint64, std::vector<triton::usize>>())).first;
+          for (triton::usize index = 0; index < this->oracles.size(); index++)
+            it->second[getSignature(this->oracles[index].outputs, mask)].push_back(index);
+        }
+
+        auto bucket = it->second.find(getSignature(outputs, mask));
+        if (bucket == it->second.end())
+          return ret;
+
+        for (triton::usize index : bucket->second) {
+          const Oracle& oracle = this->oracles[index];
+          bool equal = true;
+          for (triton::usize i = 0; i < SAMPLES && equal; i++)
+            equal = ((oracle.outputs[i] & mask) == (outputs[i] & mask));
+          if (equal)
+            ret.push_back(&oracle);
+        }
+
+        return ret;
+      }
+
+
+      triton::ast::SharedAbstractNode OracleTable::getAst(const Oracle& oracle, const std::vector<triton::ast::SharedAbstractNode>& variables) const {
+        std::vector<triton::ast::SharedAbstractNode> stack;
+
+        for (token_e token : oracle.program) {
+          if (getArity(token) == 0) {
+            if (static_cast<triton::usize>(token - TOKEN_X) >= variables.size())
+              throw triton::exceptions::SynthesisEngine("OracleTable::getAst(): Missing variable.");
+            stack.push_back(variables[token - TOKEN_X]);
+            continue;
+          }
+
+          const auto& ctxt = stack.back()->getContext();
+          if (token == TOKEN_NOT) { stack.back() = ctxt->bvnot(stack.back()); continue; }
+          if (token == TOKEN_NEG) { stack.back() = ctxt->bvneg(stack.back()); continue; }
+
+          triton::ast::SharedAbstractNode b = stack.back();
+          stack.pop_back();
+          triton::ast::SharedAbstractNode a = stack.back();
+          switch (token) {
+            case TOKEN_ADD: stack.back() = ctxt->bvadd(a, b); break;
+            case TOKEN_SUB: stack.back() = ctxt->bvsub(a, b); break;
+            case TOKEN_MUL: stack.back() = ctxt->bvmul(a, b); break;
+            case TOKEN_AND: stack.back() = ctxt->bvand(a, b); break;
+            case TOKEN_OR:  stack.back() = ctxt->bvor(a, b); break;
+            default:        stack.back() = ctxt->bvxor(a, b); break;
+          }
+        }
+
+        return stack.back();
+      }
+
+    }; /* synthesis namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
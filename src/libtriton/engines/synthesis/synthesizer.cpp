@@ -0,0 +1,230 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <stack>
+
+#include <triton/astContext.hpp>
+#include <triton/batchEvaluator.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/symbolicExpression.hpp>
+#include <triton/symbolicVariable.hpp>
+#include <triton/synthesizer.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace synthesis {
+
+      Synthesizer::Synthesizer(const OracleTable& oracles, const triton::engines::solver::SolverEngine& solver, bool constant)
+        : oracles(oracles), solver(solver) {
+        this->constant = constant;
+      }
+
+
+      void Synthesizer::collect(const triton::ast::SharedAbstractNode& node) {
+        for (const auto& n : triton::ast::childrenExtraction(node, true /* unroll */, true /* revert */)) {
+          std::vector<triton::usize>& ids = this->variables[n.get()];
+
+          if (n->getType() == triton::ast::VARIABLE_NODE) {
+            ids.push_back(reinterpret_cast<triton::ast::VariableNode*>(n.get())->getSymbolicVariable()->getId());
+            continue;
+          }
+
+          if (n->getType() == triton::ast::REFERENCE_NODE) {
+            ids = this->variables[reinterpret_cast<triton::ast::ReferenceNode*>(n.get())->getSymbolicExpression()->getAst().get()];
+            continue;
+          }
+
+          for (const auto& child : n->getChildren()) {
+            for (triton::usize id : this->variables[child.get()]) {
+              if (ids.size() > OracleTable::VARIABLES)
+                break;
+              auto it = std::lower_bound(ids.begin(), ids.end(), id);
+              if (it == ids.end() || *it != id)
+                ids.insert(it, id);
+            }
+          }
+          if (ids.size() > OracleTable::VARIABLES)
+            ids.resize(OracleTable::VARIABLES + 1);
+        }
+      }
+
+
+      std::vector<triton::ast::SharedAbstractNode> Synthesizer::getCandidates(const triton::ast::SharedAbstractNode& node) const {
+        std::vector<std::pair<triton::usize, triton::ast::SharedAbstractNode>> candidates;
+        std::vector<triton::ast::SharedAbstractNode> ret;
+        const auto& ctxt = node->getContext();
+        triton::uint32 size = node->getBitvectorSize();
+
+        if (node->isLogical() || !node->isSymbolized() || size > 64 || node->getType() == triton::ast::VARIABLE_NODE)
+          return ret;
+
+        auto it = this->variables.find(node.get());
+        if (it == this->variables.end() || it->second.empty() || it->second.size() > OracleTable::VARIABLES)
+          return ret;
+
+        try {
+          triton::ast::BatchEvaluator batch(node);
+          const auto& vars = batch.getVariables();
+          const auto& samples = this->oracles.getSamples();
+          triton::uint64 mask = (size == 64) ? ~0ULL : ((1ULL << size) - 1);
+          triton::usize cost = batch.getTapeSize();
+          bool sameSize = true;
+
+          if (!batch.isVectorizable())
+            return ret;
+
+          /* Evaluates the node on the sample points, the variable i is the variable i of the table */
+          std::vector<std::vector<triton::uint64>> inputs(vars.size());
+          for (triton::usize v = 0; v < vars.size(); v++) {
+            triton::uint32 varSize = vars[v]->getSize();
+            triton::uint64 varMask = (varSize >= 64) ? ~0ULL : ((1ULL << varSize) - 1);
+            sameSize &= (varSize == size);
+            for (const auto& point : samples)
+              inputs[v].push_back(point[v] & varMask);
+          }
+          std::vector<triton::uint64> outputs = batch.evaluate(inputs);
+          for (auto& value : outputs)
+            value &= mask;
+
+          std::vector<triton::ast::SharedAbstractNode> nodes;
+          for (const auto& var : vars)
+            nodes.push_back(ctxt->variable(var));
+
+          /* A constant */
+          if (std::all_of(outputs.begin(), outputs.end(), [&](triton::uint64 value) { return value == outputs[0]; })) {
+            candidates.push_back(std::make_pair(1, ctxt->bv(outputs[0], size)));
+          }
+
+          /* The operations of the table commute with the truncation only if the variables have the size of the node */
+          if (sameSize) {
+            for (const OracleTable::Oracle* oracle : this->oracles.lookup(outputs, size)) {
+              if (oracle->program.size() >= cost)
+                break;
+              bool defined = std::all_of(oracle->program.begin(), oracle->program.end(), [&](OracleTable::token_e token) {
+                return token > OracleTable::TOKEN_Z || static_cast<triton::usize>(token) < nodes.size();
+              });
+              if (defined)
+                candidates.push_back(std::make_pair(oracle->program.size(), this->oracles.getAst(*oracle, nodes)));
+              if (candidates.size() > MAX_CANDIDATES)
+                break;
+            }
+          }
+
+          /* x op c, the constant is the output on the point 0, 1 or -1 */
+          if (this->constant && sameSize && vars.size() == 1 && cost > 3) {
+            const triton::ast::SharedAbstractNode& x = nodes[0];
+            triton::uint64 c0 = outputs[0];
+            triton::uint64 c1 = outputs[1];
+            triton::uint64 cm = outputs[2];
+            bool isXor = true, isAdd = true, isOr = true, isAnd = true, isMul = true;
+
+            for (triton::usize i = 0; i < outputs.size(); i++) {
+              triton::uint64 a = inputs[0][i];
+              isXor &= (((a ^ c0) & mask) == outputs[i]);
+              isAdd &= (((a + c0) & mask) == outputs[i]);
+              isOr  &= (((a | c0) & mask) == outputs[i]);
+              isAnd &= (((a & cm) & mask) == outputs[i]);
+              isMul &= (((a * c1) & mask) == outputs[i]);
+            }
+
+            if (isXor) candidates.push_back(std::make_pair(3, ctxt->bvxor(x, ctxt->bv(c0, size))));
+            if (isAdd) candidates.push_back(std::make_pair(3, ctxt->bvadd(x, ctxt->bv(c0, size))));
+            if (isOr)  candidates.push_back(std::make_pair(3, ctxt->bvor(x, ctxt->bv(c0, size))));
+            if (isAnd) candidates.push_back(std::make_pair(3, ctxt->bvand(x, ctxt->bv(cm, size))));
+            if (isMul) candidates.push_back(std::make_pair(3, ctxt->bvmul(x, ctxt->bv(c1, size))));
+          }
+        }
+        catch (const triton::exceptions::Exception&) {
+          /* Not supported by the batch evaluator */
+          return ret;
+        }
+
+        std::stable_sort(candidates.begin(), candidates.end(),
+          [](const std::pair<triton::usize, triton::ast::SharedAbstractNode>& a, const std::pair<triton::usize, triton::ast::SharedAbstractNode>& b) {
+            return a.first < b.first;
+          }
+        );
+
+        for (const auto& candidate : candidates) {
+          if (ret.size() == MAX_CANDIDATES)
+            break;
+          ret.push_back(candidate.second);
+        }
+
+        return ret;
+      }
+
+
+      triton::ast::SharedAbstractNode Synthesizer::replace(const triton::ast::SharedAbstractNode& node) const {
+        const auto& ctxt = node->getContext();
+
+        for (const auto& candidate : this->getCandidates(node)) {
+          triton::engines::solver::status_e status;
+          this->solver.isSat(ctxt->distinct(node, candidate), &status);
+          if (status == triton::engines::solver::UNSAT)
+            return candidate;
+        }
+
+        return nullptr;
+      }
+
+
+      triton::ast::SharedAbstractNode Synthesizer::synthesize(const triton::ast::SharedAbstractNode& node) {
+        std::unordered_map<triton::ast::AbstractNode*, triton::ast::SharedAbstractNode> results;
+        std::stack<std::pair<triton::ast::SharedAbstractNode, bool>> worklist;
+
+        if (node == nullptr)
+          throw triton::exceptions::SynthesisEngine("Synthesizer::synthesize(): The node cannot be null.");
+
+        this->variables.clear();
+        this->collect(node);
+
+        /* From the root, the children of a node are visited only if it is not replaced */
+        worklist.push(std::make_pair(node, false));
+        while (!worklist.empty()) {
+          triton::ast::SharedAbstractNode current = worklist.top().first;
+          bool postOrder = worklist.top().second;
+          worklist.pop();
+
+          if (postOrder) {
+            std::vector<triton::ast::SharedAbstractNode> children;
+            bool modified = false;
+            for (const auto& child : current->getChildren()) {
+              children.push_back(results.at(child.get()));
+              modified |= (children.back() != child);
+            }
+            results[current.get()] = modified ? triton::ast::newInstance(current.get(), children) : current;
+            continue;
+          }
+
+          if (results.find(current.get()) != results.end())
+            continue;
+
+          triton::ast::SharedAbstractNode replaced = this->replace(current);
+          if (replaced != nullptr) {
+            results[current.get()] = replaced;
+            continue;
+          }
+
+          /* The node is kept until its children are done */
+          results[current.get()] = current;
+          worklist.push(std::make_pair(current, true));
+          for (const auto& child : current->getChildren()) {
+            if (results.find(child.get()) == results.end())
+              worklist.push(std::make_pair(child, false));
+          }
+        }
+
+        return results.at(node.get());
+      }
+
+    }; /* synthesis namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
@@ -14,10 +14,11 @@ namespace triton {
   namespace engines {
     namespace taint {
 
-      TaintEngine::TaintEngine(const triton::modes::SharedModes& modes, triton::engines::symbolic::SymbolicEngine* symbolicEngine, triton::arch::CpuInterface& cpu)
+      TaintEngine::TaintEngine(const triton::modes::SharedModes& modes, triton::engines::symbolic::SymbolicEngine* symbolicEngine, triton::arch::CpuInterface& cpu, triton::engines::snapshot::Journal* journal)
         : modes(modes),
           symbolicEngine(symbolicEngine),
           cpu(cpu),
+          journal(journal),
           enableFlag(true) {
 
         if (this->symbolicEngine == nullptr)
@@ -29,6 +30,7 @@ namespace triton {
         : modes(other.modes),
           cpu(other.cpu) {
         this->enableFlag       = other.enableFlag;
+        this->journal          = other.journal;
         this->symbolicEngine   = other.symbolicEngine;
         this->taintedMemory    = other.taintedMemory;
         this->taintedRegisters = other.taintedRegisters;
@@ -38,6 +40,7 @@ namespace triton {
       TaintEngine& TaintEngine::operator=(const TaintEngine& other) {
         this->cpu              = other.cpu;
         this->enableFlag       = other.enableFlag;
+        this->journal          = other.journal;
         this->modes            = other.modes;
         this->symbolicEngine   = other.symbolicEngine;
         this->taintedMemory    = other.taintedMemory;
@@ -46,6 +49,38 @@ namespace triton {
       }
 
 
+      void TaintEngine::updateTaintedMemory(triton::uint64 addr, bool flag) {
+        bool old = this->taintedMemory.has(addr);
+
+        if (old == flag)
+          return;
+
+        if (this->journal != nullptr && this->journal->isEnabled())
+          this->journal->recordTaintedMemory(addr, old);
+
+        if (flag == TAINTED)
+          this->taintedMemory.insert(addr);
+        else
+          this->taintedMemory.erase(addr);
+      }
+
+
+      void TaintEngine::updateTaintedRegister(triton::arch::register_e parentId, bool flag) {
+        bool old = (this->taintedRegisters.find(parentId) != this->taintedRegisters.end());
+
+        if (old == flag)
+          return;
+
+        if (this->journal != nullptr && this->journal->isEnabled())
+          this->journal->recordTaintedRegister(parentId, old);
+
+        if (flag == TAINTED)
+          this->taintedRegisters.insert(parentId);
+        else
+          this->taintedRegisters.erase(parentId);
+      }
+
+
       bool TaintEngine::isEnabled(void) const {
         return this->enableFlag;
       }
@@ -57,8 +92,20 @@ namespace triton {
 
 
       /* Returns the tainted addresses */
-      const std::unordered_set<triton::uint64>& TaintEngine::getTaintedMemory(void) const {
-        return this->taintedMemory;
+      std::unordered_set<triton::uint64> TaintEngine::getTaintedMemory(void) const {
+        std::unordered_set<triton::uint64> res;
+
+        this->taintedMemory.forEach([&] (triton::uint64 addr) {
+          res.insert(addr);
+        });
+
+        return res;
+      }
+
+
+      /* Iterates over the tainted addresses */
+      void TaintEngine::forEachTaintedMemory(const std::function<void(triton::uint64)>& f) const {
+        this->taintedMemory.forEach(f);
       }
 
 
@@ -79,7 +126,7 @@ namespace triton {
         triton::uint32 size = mem.getSize();
 
         for (triton::uint32 index = 0; index < size; index++) {
-          if (this->taintedMemory.find(addr+index) != this->taintedMemory.end())
+          if (this->taintedMemory.has(addr+index))
             return TAINTED;
         }
 
@@ -100,7 +147,7 @@ namespace triton {
       /* Returns true of false if the address is currently tainted */
       bool TaintEngine::isMemoryTainted(triton::uint64 addr, triton::uint32 size) const {
         for (triton::uint32 index = 0; index < size; index++) {
-          if (this->taintedMemory.find(addr+index) != this->taintedMemory.end())
+          if (this->taintedMemory.has(addr+index))
             return TAINTED;
         }
 
@@ -133,7 +180,7 @@ namespace triton {
       bool TaintEngine::taintRegister(const triton::arch::Register& reg) {
         if (!this->isEnabled())
           return this->isRegisterTainted(reg);
-        this->taintedRegisters.insert(reg.getParent());
+        this->updateTaintedRegister(reg.getParent(), TAINTED);
 
         return TAINTED;
       }
@@ -143,7 +190,7 @@ namespace triton {
       bool TaintEngine::untaintRegister(const triton::arch::Register& reg) {
         if (!this->isEnabled())
           return this->isRegisterTainted(reg);
-        this->taintedRegisters.erase(reg.getParent());
+        this->updateTaintedRegister(reg.getParent(), !TAINTED);
 
         return !TAINTED;
       }
@@ -200,7 +247,7 @@ namespace triton {
           return this->isMemoryTainted(mem);
 
         for (triton::uint32 index = 0; index < size; index++)
-          this->taintedMemory.insert(addr+index);
+          this->updateTaintedMemory(addr+index, TAINTED);
 
         return TAINTED;
       }
@@ -210,7 +257,7 @@ namespace triton {
       bool TaintEngine::taintMemory(triton::uint64 addr) {
         if (!this->isEnabled())
           return this->isMemoryTainted(addr);
-        this->taintedMemory.insert(addr);
+        this->updateTaintedMemory(addr, TAINTED);
         return TAINTED;
       }
 
@@ -224,7 +271,7 @@ namespace triton {
           return this->isMemoryTainted(mem);
 
         for (triton::uint32 index = 0; index < size; index++)
-          this->taintedMemory.erase(addr+index);
+          this->updateTaintedMemory(addr+index, !TAINTED);
 
         return !TAINTED;
       }
@@ -234,7 +281,7 @@ namespace triton {
       bool TaintEngine::untaintMemory(triton::uint64 addr) {
         if (!this->isEnabled())
           return this->isMemoryTainted(addr);
-        this->taintedMemory.erase(addr);
+        this->updateTaintedMemory(addr, !TAINTED);
         return !TAINTED;
       }
 
@@ -636,6 +683,28 @@ namespace triton {
         return !TAINTED;
       }
 
+
+      void TaintEngine::undo(const triton::engines::snapshot::JournalEntry& entry) {
+        switch (entry.kind) {
+          case triton::engines::snapshot::JOURNAL_TAINTED_MEMORY:
+            if (entry.flag == TAINTED)
+              this->taintedMemory.insert(entry.key);
+            else
+              this->taintedMemory.erase(entry.key);
+            break;
+
+          case triton::engines::snapshot::JOURNAL_TAINTED_REGISTER:
+            if (entry.flag == TAINTED)
+              this->taintedRegisters.insert(static_cast<triton::arch::register_e>(entry.key));
+            else
+              this->taintedRegisters.erase(static_cast<triton::arch::register_e>(entry.key));
+            break;
+
+          default:
+            throw triton::exceptions::TaintEngine("TaintEngine::undo(): Not a taint journal entry.");
+        }
+      }
+
     }; /* taint namespace */
   }; /* engines namespace */
 }; /* triton namespace */
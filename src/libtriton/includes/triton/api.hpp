@@ -8,20 +8,28 @@
 #ifndef TRITON_API_H
 #define TRITON_API_H
 
+#include <functional>
+#include <map>
+#include <set>
+
 #include <triton/architecture.hpp>
 #include <triton/ast.hpp>
 #include <triton/astContext.hpp>
 #include <triton/astRepresentation.hpp>
 #include <triton/callbacks.hpp>
 #include <triton/dllexport.hpp>
+#include <triton/eGraph.hpp>
 #include <triton/immediate.hpp>
 #include <triton/instruction.hpp>
 #include <triton/irBuilder.hpp>
+#include <triton/journal.hpp>
 #include <triton/memoryAccess.hpp>
 #include <triton/modes.hpp>
 #include <triton/operandWrapper.hpp>
+#include <triton/oracleTable.hpp>
 #include <triton/register.hpp>
 #include <triton/shortcutRegister.hpp>
+#include <triton/snapshotEngine.hpp>
 #include <triton/solverEngine.hpp>
 #include <triton/solverEnums.hpp>
 #include <triton/symbolicEngine.hpp>
@@ -38,7 +46,13 @@ namespace triton {
  */
 
     /*! \class API
-     *  \brief This is used as C++ API. */
+     *  \brief This is used as C++ API.
+     *
+     *  \details
+     *  Independent instances may be used concurrently from several threads (one
+     *  instance per thread). An instance, as well as the AST nodes and symbolic
+     *  expressions it creates, must not be shared between threads without locking.
+     */
     class API {
       private:
         //! Raises an exception if the architecture is not initialized.
@@ -56,11 +70,17 @@ namespace triton {
         //! Raises an exception if the taint engine is not initialized.
         inline void checkTaint(void) const;
 
+        //! Raises an exception if the snapshot engine is not initialized.
+        inline void checkSnapshot(void) const;
+
 
       protected:
         //! The Callbacks interface.
         triton::callbacks::Callbacks callbacks;
 
+        //! The undo journal used by checkpoints.
+        triton::engines::snapshot::Journal journal;
+
         //! The architecture entry.
         triton::arch::Architecture arch;
 
@@ -76,12 +96,18 @@ namespace triton {
         //! The solver engine.
         triton::engines::solver::SolverEngine* solver = nullptr;
 
+        //! The snapshot engine.
+        triton::engines::snapshot::SnapshotEngine* snapshot = nullptr;
+
         //! The AST Context interface.
         triton::ast::SharedAstContext astCtxt;
 
         //! The IR builder.
         triton::arch::IrBuilder* irBuilder = nullptr;
 
+        //! The oracle table of the synthesis, built on first use.
+        triton::engines::synthesis::OracleTable oracles;
+
 
       public:
         //! A shortcut to access to a Register class from a register name.
@@ -178,6 +204,9 @@ namespace triton {
         //! [**architecture api**] - Returns the concrete value of a memory area.
         TRITON_EXPORT std::vector<triton::uint8> getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks=true) const;
 
+        //! [**architecture api**] - Copies the concrete value of a memory area into `area` (`size` bytes).
+        TRITON_EXPORT void getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::uint8* area, triton::usize size, bool execCallbacks=true) const;
+
         //! [**architecture api**] - Returns the concrete value of a register.
         TRITON_EXPORT triton::uint512 getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks=true) const;
 
@@ -233,6 +262,30 @@ namespace triton {
         //! Clears concrete values assigned to the memory cells
         TRITON_EXPORT void clearConcreteMemoryValue(triton::uint64 baseAddr, triton::usize size=1);
 
+        /*!
+         * \brief [**architecture api**] - Maps a caller-owned read-only area as concrete memory without copying it.
+         *
+         * \details The area is read in place and writes go to a copy-on-write overlay, so `area` is
+         * never modified. It must stay valid while it is mapped (snapshots included), `owner` may be
+         * used to tie its lifetime to the mapping. The symbolic memory of the area is concretized.
+         */
+        TRITON_EXPORT void mapConcreteMemoryArea(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size, const std::shared_ptr<const void>& owner=nullptr);
+
+        /*!
+         * \brief [**architecture api**] - Maps `size` bytes of the file `path` from `offset` as concrete memory at `baseAddr`.
+         *
+         * \details The file is mapped read-only (`mmap`) and its pages are only loaded when read. Writes go
+         * to a copy-on-write overlay, the file is never modified. If `size` is 0, the file is mapped up to
+         * its end. The file stays mapped while the area is mapped (snapshots included).
+         */
+        TRITON_EXPORT void mapConcreteMemoryFile(triton::uint64 baseAddr, const std::string& path, triton::uint64 offset=0, triton::usize size=0);
+
+        //! [**architecture api**] - Unmaps the area mapped at `baseAddr`. Its concrete values become undefined.
+        TRITON_EXPORT void unmapConcreteMemoryArea(triton::uint64 baseAddr);
+
+        //! [**architecture api**] - Returns the mapped areas as (base address, size).
+        TRITON_EXPORT std::map<triton::uint64, triton::usize> getMappedConcreteMemoryAreas(void) const;
+
         //! [**architecture api**] - Disassembles the instruction and setup operands. You must define an architecture before. \sa processing().
         TRITON_EXPORT void disassembly(triton::arch::Instruction& inst) const;
 
@@ -243,6 +296,36 @@ namespace triton {
         //! [**proccesing api**] - Processes an instruction and updates engines according to the instruction semantics. Returns true if the instruction is supported.
         TRITON_EXPORT bool processing(triton::arch::Instruction& inst);
 
+        /*!
+         * \brief [**proccesing api**] - Runs the program from `pc` and returns the address where the execution stopped.
+         *
+         * \details Opcodes are fetched from the concrete memory and the next address is read from the program
+         * counter after each instruction. The execution stops before an address of `stopAddrs`, after
+         * `maxInstructions` instructions (0 means no limit) or on an unsupported instruction (its address is
+         * returned). Before the instruction at an address of `hooks` is processed, its hook is called with this
+         * address. The hook may change the program counter to redirect the execution and returns true to stop it.
+         * A redirection counts as one instruction against `maxInstructions`: without a limit, hooks which keep
+         * redirecting the execution to each other never return. Opcodes are fetched without executing the
+         * memory callbacks.
+         */
+        TRITON_EXPORT triton::uint64 run(triton::uint64 pc,
+                                         triton::usize maxInstructions=0,
+                                         const std::set<triton::uint64>& stopAddrs=std::set<triton::uint64>(),
+                                         const std::map<triton::uint64, std::function<bool(triton::uint64)>>& hooks=std::map<triton::uint64, std::function<bool(triton::uint64)>>());
+
+        /*!
+         * \brief [**proccesing api**] - Replays an execution trace recorded by a tracer and returns the number of processed instructions.
+         *
+         * \details Sync records set the concrete registers, the bytes read by an instruction are set in the concrete
+         * memory before the instruction is processed and write records update the concrete memory afterwards. Only
+         * the concrete state is updated so that the symbolic analysis matches an inline one: a register is concretized
+         * at a sync record only if its symbolic value differs from the recorded one. The
+         * records from the offset `begin` to the offset `end` are replayed (0 means the first record and the end of
+         * the trace). `begin` should be a sync point (see triton::utils::TraceReader::getSyncPoints()), chunks between
+         * sync points may be replayed independently in several contexts. \sa triton::utils::TraceWriter.
+         */
+        TRITON_EXPORT triton::usize replayTrace(std::istream& stream, triton::uint64 begin=0, triton::uint64 end=0);
+
         //! [**proccesing api**] - Initializes everything.
         TRITON_EXPORT void initEngines(void);
 
@@ -272,6 +355,9 @@ namespace triton {
         //! [**AST representation api**] - Sets the AST representation mode.
         TRITON_EXPORT void setAstRepresentationMode(triton::uint32 mode);
 
+        //! [**AST representation api**] - Prints a node as a SMT2 script where shared sub-expressions are defined once. If `assert_` is true, then (assert <node>).
+        TRITON_EXPORT std::ostream& printSmtDag(std::ostream& stream, const triton::ast::SharedAbstractNode& node, bool assert_=false);
+
 
 
         /* Callbacks API ================================================================================= */
@@ -281,6 +367,11 @@ namespace triton {
           this->callbacks.addCallback(kind, cb);
         }
 
+        //! [**callbacks api**] - Adds a memory callback which only watches [baseAddr, baseAddr+size). A size of 0 watches the whole memory.
+        template <typename T> void addCallback(triton::callbacks::callback_e kind, T cb, triton::uint64 baseAddr, triton::usize size) {
+          this->callbacks.addCallback(kind, cb, baseAddr, size);
+        }
+
         //! [**callbacks api**] - Removes a callback.
         template <typename T> void removeCallback(triton::callbacks::callback_e kind, T cb) {
           this->callbacks.removeCallback(kind, cb);
@@ -321,9 +412,12 @@ namespace triton {
         //! [**symbolic api**] - Returns the map of symbolic registers defined.
         TRITON_EXPORT std::unordered_map<triton::arch::register_e, triton::engines::symbolic::SharedSymbolicExpression> getSymbolicRegisters(void) const;
 
-        //! [**symbolic api**] - Returns the map (<Addr : SymExpr>) of symbolic memory defined.
+        //! [**symbolic api**] - Returns the map (<Addr : SymExpr>) of symbolic memory defined. The map is built on each call, prefer forEachSymbolicMemory() to walk it.
         TRITON_EXPORT std::unordered_map<triton::uint64, triton::engines::symbolic::SharedSymbolicExpression> getSymbolicMemory(void) const;
 
+        //! [**symbolic api**] - Calls `f(addr, expr)` on each symbolic memory byte defined.
+        TRITON_EXPORT void forEachSymbolicMemory(const std::function<void(triton::uint64, const triton::engines::symbolic::SharedSymbolicExpression&)>& f) const;
+
         //! [**symbolic api**] - Returns the shared symbolic expression corresponding to the memory address.
         TRITON_EXPORT triton::engines::symbolic::SharedSymbolicExpression getSymbolicMemory(triton::uint64 addr) const;
 
@@ -393,6 +487,33 @@ namespace triton {
         //! [**symbolic api**] - Assigns a symbolic expression to a register.
         TRITON_EXPORT void assignSymbolicExpressionToRegister(const triton::engines::symbolic::SharedSymbolicExpression& se, const triton::arch::Register& reg);
 
+        //! [**symbolic api**] - Adds simplification rules such as `(bvxor x x) -> 0`. See triton::engines::symbolic::RewriteEngine.
+        TRITON_EXPORT void addSimplificationRule(const std::string& rule);
+
+        //! [**symbolic api**] - Removes all simplification rules.
+        TRITON_EXPORT void clearSimplificationRules(void);
+
+        //! [**symbolic api**] - Returns the simplification rules in the order they were added.
+        TRITON_EXPORT std::vector<std::string> getSimplificationRules(void) const;
+
+        //! [**symbolic api**] - Adds rules to the equality saturation. See triton::engines::symbolic::EGraph.
+        TRITON_EXPORT void addSaturationRule(const std::string& rule);
+
+        //! [**symbolic api**] - Removes all rules of the equality saturation, including the default ones.
+        TRITON_EXPORT void clearSaturationRules(void);
+
+        //! [**symbolic api**] - Returns the rules of the equality saturation.
+        TRITON_EXPORT std::vector<std::string> getSaturationRules(void) const;
+
+        //! [**symbolic api**] - Simplifies a node by equality saturation within a budget of nodes and milliseconds (0 means unlimited, but not for both). Returns the cheapest equivalent node.
+        TRITON_EXPORT triton::ast::SharedAbstractNode processEqualitySaturation(const triton::ast::SharedAbstractNode& node,
+                                                                               triton::usize nodeLimit=triton::engines::symbolic::EGraph::DEFAULT_NODE_LIMIT,
+                                                                               triton::usize timeLimit=triton::engines::symbolic::EGraph::DEFAULT_TIME_LIMIT,
+                                                                               triton::engines::symbolic::cost_e cost=triton::engines::symbolic::SIZE_COST) const;
+
+        //! [**symbolic api**] - Simplifies the linear mixed boolean-arithmetic subexpressions of a node. Returns the simplified node.
+        TRITON_EXPORT triton::ast::SharedAbstractNode processMbaSimplification(const triton::ast::SharedAbstractNode& node) const;
+
         //! [**symbolic api**] - Processes all recorded simplifications. Returns the simplified node.
         TRITON_EXPORT triton::ast::SharedAbstractNode processSimplification(const triton::ast::SharedAbstractNode& node, bool z3=false) const;
 
@@ -474,15 +595,34 @@ namespace triton {
         //! [**symbolic api**] - Concretizes a specific symbolic memory reference.
         TRITON_EXPORT void concretizeMemory(triton::uint64 addr);
 
+        //! [**symbolic api**] - Concretizes the symbolic memory references of [baseAddr, baseAddr+size).
+        TRITON_EXPORT void concretizeMemory(triton::uint64 baseAddr, triton::usize size);
+
         //! [**symbolic api**] - Concretizes a specific symbolic register reference.
         TRITON_EXPORT void concretizeRegister(const triton::arch::Register& reg);
 
         //! [**symbolic api**] - Slices all expressions from a given one.
         TRITON_EXPORT std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicExpression> sliceExpressions(const triton::engines::symbolic::SharedSymbolicExpression& expr);
 
+        //! [**symbolic api**] - Slices all expressions from several ones, the union of their slices.
+        TRITON_EXPORT std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicExpression> sliceExpressions(const std::vector<triton::engines::symbolic::SharedSymbolicExpression>& exprs);
+
         //! [**symbolic api**] - Prints symbolic expression with used references and symbolic variables in AST representation mode. If `assert_` is true, then (assert <expr>).
         TRITON_EXPORT std::ostream& printSlicedExpressions(std::ostream& stream, const triton::engines::symbolic::SharedSymbolicExpression& expr, bool assert_=false);
 
+        //! [**symbolic api**] - Writes nodes, symbolic expressions and path constraints (with everything they depend on) in a compact binary format. See triton::engines::symbolic::SymbolicSerializer.
+        TRITON_EXPORT void serializeSymbolic(std::ostream& stream,
+                                             const std::vector<triton::ast::SharedAbstractNode>& nodes,
+                                             const std::vector<triton::engines::symbolic::SharedSymbolicExpression>& exprs={},
+                                             const std::vector<triton::engines::symbolic::PathConstraint>& pcs={});
+
+        //! [**symbolic api**] - Loads a stream written by serializeSymbolic(). Loaded items are appended to `nodes`, `exprs` and `pcs`. If `reuseVariables` is true, existing symbolic variables with the same name (or alias) and size are reused instead of created.
+        TRITON_EXPORT void deserializeSymbolic(std::istream& stream,
+                                               std::vector<triton::ast::SharedAbstractNode>& nodes,
+                                               std::vector<triton::engines::symbolic::SharedSymbolicExpression>& exprs,
+                                               std::vector<triton::engines::symbolic::PathConstraint>& pcs,
+                                               bool reuseVariables=false);
+
         //! [**symbolic api**] - Returns the list of the tainted symbolic expressions.
         TRITON_EXPORT std::vector<triton::engines::symbolic::SharedSymbolicExpression> getTaintedSymbolicExpressions(void) const;
 
@@ -492,6 +632,12 @@ namespace triton {
         //! [**symbolic api**] - Returns all symbolic variables as a map of <SymVarId : SymVar>
         TRITON_EXPORT std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicVariable> getSymbolicVariables(void) const;
 
+        //! [**symbolic api**] - Removes the expressions which do not exist anymore from the map of ids and returns their number.
+        TRITON_EXPORT triton::usize compactSymbolicExpressions(void);
+
+        //! [**symbolic api**] - Removes the expressions which are not reachable from the symbolic registers, memory and path constraints from the map of ids and returns their number.
+        TRITON_EXPORT triton::usize trimSymbolicExpressions(void);
+
         //! [**symbolic api**] - Gets the concrete value of a symbolic variable.
         TRITON_EXPORT triton::uint512 getConcreteVariableValue(const triton::engines::symbolic::SharedSymbolicVariable& symVar) const;
 
@@ -550,6 +696,49 @@ namespace triton {
         //! [**solver api**] - Defines a solver memory consumption limit (in megabytes).
         TRITON_EXPORT void setSolverMemoryLimit(triton::uint32 limit);
 
+        //! [**solver api**] - Replaces the subexpressions of at most three variables by smaller equivalent ones found from their I/O behavior. If `constant` is true, `x op c` is also tried.
+        TRITON_EXPORT triton::ast::SharedAbstractNode synthesize(const triton::ast::SharedAbstractNode& node, bool constant=true);
+
+        //! [**solver api**] - Loads the oracle table of the synthesis from a file.
+        TRITON_EXPORT void loadSynthesisOracles(const std::string& path);
+
+        //! [**solver api**] - Saves the oracle table of the synthesis to a file, it is built first if needed.
+        TRITON_EXPORT void saveSynthesisOracles(const std::string& path);
+
+
+
+        /* Snapshot engine API =========================================================================== */
+
+        //! [**snapshot api**] - Returns the instance of the snapshot engine.
+        TRITON_EXPORT triton::engines::snapshot::SnapshotEngine* getSnapshotEngine(void);
+
+        //! [**snapshot api**] - Takes a snapshot of the concrete, symbolic and taint states and returns its id.
+        TRITON_EXPORT triton::usize takeSnapshot(void);
+
+        //! [**snapshot api**] - Restores the state of a snapshot. The snapshot can be restored again later. Expressions changed in place since (e.g. with SymbolicExpression::setAst()) are not reverted.
+        TRITON_EXPORT void restoreSnapshot(triton::usize id);
+
+        //! [**snapshot api**] - Removes a snapshot.
+        TRITON_EXPORT void removeSnapshot(triton::usize id);
+
+        //! [**snapshot api**] - Returns true if the snapshot exists.
+        TRITON_EXPORT bool isSnapshot(triton::usize id) const;
+
+        //! [**snapshot api**] - Returns the number of snapshots.
+        TRITON_EXPORT triton::usize getNumberOfSnapshots(void) const;
+
+        //! [**snapshot api**] - Starts recording changes into the undo journal (if not already) and returns a checkpoint id.
+        TRITON_EXPORT triton::usize checkpoint(void);
+
+        //! [**snapshot api**] - Reverts all changes made since the checkpoint (including mapped areas and variable values, but not in-place changes of expressions). The checkpoint remains valid, the next ones are discarded.
+        TRITON_EXPORT void rollback(triton::usize checkpoint);
+
+        //! [**snapshot api**] - Discards all checkpoints and stops recording changes.
+        TRITON_EXPORT void clearCheckpoints(void);
+
+        //! [**snapshot api**] - Returns the number of checkpoints.
+        TRITON_EXPORT triton::usize getNumberOfCheckpoints(void) const;
+
 
 
         /* Taint engine API ============================================================================== */
@@ -557,8 +746,11 @@ namespace triton {
         //! [**taint api**] - Returns the instance of the taint engine.
         TRITON_EXPORT triton::engines::taint::TaintEngine* getTaintEngine(void);
 
-        //! [**taint api**] - Returns the tainted addresses.
-        TRITON_EXPORT const std::unordered_set<triton::uint64>& getTaintedMemory(void) const;
+        //! [**taint api**] - Returns the tainted addresses. The set is built on each call, prefer forEachTaintedMemory() to walk it.
+        TRITON_EXPORT std::unordered_set<triton::uint64> getTaintedMemory(void) const;
+
+        //! [**taint api**] - Calls `f(addr)` on each tainted address.
+        TRITON_EXPORT void forEachTaintedMemory(const std::function<void(triton::uint64)>& f) const;
 
         //! [**taint api**] - Returns the tainted registers.
         TRITON_EXPORT std::unordered_set<const triton::arch::Register*> getTaintedRegisters(void) const;
@@ -8,6 +8,7 @@
 #ifndef TRITON_ARCHITECTURE_H
 #define TRITON_ARCHITECTURE_H
 
+#include <map>
 #include <memory>
 #include <set>
 #include <string>
@@ -18,6 +19,7 @@
 #include <triton/cpuInterface.hpp>
 #include <triton/dllexport.hpp>
 #include <triton/instruction.hpp>
+#include <triton/journal.hpp>
 #include <triton/memoryAccess.hpp>
 #include <triton/register.hpp>
 #include <triton/tritonTypes.hpp>
@@ -46,6 +48,12 @@ namespace triton {
         //! Callbacks API
         triton::callbacks::Callbacks* callbacks;
 
+        //! Journal API
+        triton::engines::snapshot::Journal* journal;
+
+        //! Records the previous state of memory cells if the journal is enabled.
+        void journalMemory(triton::uint64 baseAddr, triton::usize size);
+
       protected:
         //! The kind of architecture used.
         triton::arch::architecture_e arch;
@@ -55,7 +63,7 @@ namespace triton {
 
       public:
         //! Constructor.
-        TRITON_EXPORT Architecture(triton::callbacks::Callbacks* callbacks=nullptr);
+        TRITON_EXPORT Architecture(triton::callbacks::Callbacks* callbacks=nullptr, triton::engines::snapshot::Journal* journal=nullptr);
 
         //! Returns true if the register ID is a flag.
         TRITON_EXPORT bool isFlag(triton::arch::register_e regId) const;
@@ -147,6 +155,9 @@ namespace triton {
         //! Returns the concrete value of a memory area.
         TRITON_EXPORT std::vector<triton::uint8> getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks=true) const;
 
+        //! Copies the concrete value of a memory area into `area` (`size` bytes).
+        TRITON_EXPORT void getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::uint8* area, triton::usize size, bool execCallbacks=true) const;
+
         //! Returns the concrete value of a register.
         TRITON_EXPORT triton::uint512 getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks=true) const;
 
@@ -201,6 +212,23 @@ namespace triton {
 
         //! Clears concrete values assigned to the memory cells
         TRITON_EXPORT void clearConcreteMemoryValue(triton::uint64 baseAddr, triton::usize size=1);
+
+        /*!
+         * \brief [**architecture api**] - Maps a read-only area as concrete memory without copying it.
+         *
+         * \details The area is read in place and writes go to a copy-on-write overlay. `area`
+         * must stay valid while it is mapped, `owner` may be used to tie its lifetime to the mapping.
+         */
+        TRITON_EXPORT void mapConcreteMemoryArea(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size, const std::shared_ptr<const void>& owner=nullptr);
+
+        //! Unmaps the area mapped at `baseAddr`. Its concrete values become undefined.
+        TRITON_EXPORT void unmapConcreteMemoryArea(triton::uint64 baseAddr);
+
+        //! Returns the mapped areas as (base address, size).
+        TRITON_EXPORT std::map<triton::uint64, triton::usize> getMappedConcreteMemoryAreas(void) const;
+
+        //! Reverts a concrete journal entry. The write is not journaled.
+        TRITON_EXPORT void undo(const triton::engines::snapshot::JournalEntry& entry);
     };
 
   /*! @} End of arch namespace */
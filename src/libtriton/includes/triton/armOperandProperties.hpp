@@ -64,9 +64,6 @@ namespace triton {
           //! Constructor.
           TRITON_EXPORT ArmOperandProperties();
 
-          //! Constructor by copy.
-          TRITON_EXPORT ArmOperandProperties(const ArmOperandProperties& other);
-
           //! Returns the type of the shift.
           TRITON_EXPORT triton::arch::arm::shift_e getShiftType(void) const;
 
@@ -102,9 +99,6 @@ namespace triton {
 
           //! Sets subtracted flag.
           TRITON_EXPORT void setSubtracted(bool value);
-
-          //! Copy an ArmOperandProperties.
-          TRITON_EXPORT ArmOperandProperties& operator=(const ArmOperandProperties& other);
       };
 
     /*! @} End of arm namespace */
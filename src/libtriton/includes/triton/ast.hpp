@@ -9,6 +9,7 @@
 #define TRITON_AST_H
 
 #include <deque>
+#include <functional>
 #include <memory>
 #include <ostream>
 #include <stdexcept>
@@ -810,7 +811,10 @@ namespace triton {
     //! AST C++ API - Duplicates the AST
     TRITON_EXPORT SharedAbstractNode newInstance(AbstractNode* node, bool unroll=false);
 
-    //! AST C++ API - Unrolls the SSA form of a given AST.
+    //! AST C++ API - Duplicates a node (not its subtree) with other children
+    TRITON_EXPORT SharedAbstractNode newInstance(AbstractNode* node, const std::vector<SharedAbstractNode>& children);
+
+    //! AST C++ API - Unrolls the SSA form of a given AST. The unrolled ASTs of the referenced expressions are cached in the AST context and shared between calls.
     TRITON_EXPORT SharedAbstractNode unroll(const SharedAbstractNode& node);
 
     //! Returns node and all its children of an AST sorted topologically. If `unroll` is true, references are unrolled. If `revert` is true, children are on top of list.
@@ -819,6 +823,17 @@ namespace triton {
     //! Returns node and all its parents of an AST sorted topologically. If `revert` is true, oldest parents are on top of list.
     TRITON_EXPORT std::vector<SharedAbstractNode> parentsExtraction(const SharedAbstractNode& node, bool revert);
 
+    /*!
+     * \brief Returns the nodes reached from `node` through `operands` sorted topologically, children first.
+     *
+     * \details
+     * Nodes with operands which are used more than once, or nested deeper than `depth` if not zero, are
+     * numbered in `names` in the order of the result. Such a node counts as a leaf for the depth of its
+     * parents. The root and assert nodes are never numbered. This is the DAG numbering used to print a
+     * shared sub-expression once.
+     */
+    TRITON_EXPORT std::vector<AbstractNode*> dagExtraction(AbstractNode* node, const std::function<std::vector<AbstractNode*>(AbstractNode*)>& operands, triton::usize depth, std::unordered_map<AbstractNode*, triton::usize>& names);
+
     //! Returns a deque of collected matched nodes via a depth-first pre order traversal.
     TRITON_EXPORT std::deque<SharedAbstractNode> search(const SharedAbstractNode& node, triton::ast::ast_e match=ANY_NODE);
 
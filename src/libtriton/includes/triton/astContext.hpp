@@ -64,6 +64,12 @@ namespace triton {
         //! The list of nodes
         std::deque<SharedAbstractNode> nodes;
 
+        //! Unrolled ASTs of symbolic expressions: expression id -> (AST of the expression, unrolled copy).
+        std::unordered_map<triton::usize, std::pair<WeakAbstractNode, SharedAbstractNode>> unrolledAsts;
+
+        //! Size of unrolledAsts above which expired entries are removed.
+        triton::usize unrolledAstsLimit;
+
         //! Returns simplified concatenation.
         SharedAbstractNode simplify_concat(std::vector<SharedAbstractNode> exprs);
 
@@ -74,6 +80,9 @@ namespace triton {
         //! Constructor
         TRITON_EXPORT AstContext(const triton::modes::SharedModes& modes);
 
+        //! Constructor by copy
+        TRITON_EXPORT AstContext(const AstContext& other);
+
         //! Destructor
         TRITON_EXPORT ~AstContext();
 
@@ -86,6 +95,15 @@ namespace triton {
         //! Garbage unused nodes.
         TRITON_EXPORT void garbage(void);
 
+        //! Returns the cached unrolled copy of `ast`, the AST of the symbolic expression `id`, or nullptr if there is none.
+        TRITON_EXPORT SharedAbstractNode getUnrolledAst(triton::usize id, const SharedAbstractNode& ast) const;
+
+        //! Caches the unrolled copy of `ast`, the AST of the symbolic expression `id`. Used by triton::ast::unroll().
+        TRITON_EXPORT void setUnrolledAst(triton::usize id, const SharedAbstractNode& ast, const SharedAbstractNode& unrolled);
+
+        //! Clears the cache of unrolled ASTs. Called when the AST of an expression is replaced and when the state is restored.
+        TRITON_EXPORT void clearUnrolledAsts(void);
+
         //! AST C++ API - assert node builder
         TRITON_EXPORT SharedAbstractNode assert_(const SharedAbstractNode& expr);
 
@@ -320,9 +338,18 @@ namespace triton {
         //! Updates a variable value in this context
         TRITON_EXPORT void updateVariable(const std::string& name, const triton::uint512& value);
 
+        //! Removes a variable and its value. Used when the creation of the symbolic variable is reverted.
+        TRITON_EXPORT void removeVariable(const std::string& name);
+
         //! Gets a variable node from its name.
         SharedAbstractNode getVariableNode(const std::string& name);
 
+        //! Returns the variables (nodes and values) by name.
+        TRITON_EXPORT const std::unordered_map<std::string, std::pair<triton::ast::WeakAbstractNode, triton::uint512>>& getVariables(void) const;
+
+        //! Replaces the variables (nodes and values). The variable nodes whose value changes are updated. Used to restore a snapshot.
+        TRITON_EXPORT void setVariables(const std::unordered_map<std::string, std::pair<triton::ast::WeakAbstractNode, triton::uint512>>& variables);
+
         //! Gets a variable value from its name.
         TRITON_EXPORT const triton::uint512& getVariableValue(const std::string& name) const;
 
@@ -334,6 +361,9 @@ namespace triton {
 
         //! Prints the given node with this context representation
         TRITON_EXPORT std::ostream& print(std::ostream& stream, AbstractNode* node);
+
+        //! Prints the given node with this context representation and its shared subterms hoisted into temporaries. Stops after `limit` characters if not zero.
+        TRITON_EXPORT std::ostream& printHoisted(std::ostream& stream, AbstractNode* node, triton::usize limit=0);
     };
 
     //! Shared AST context
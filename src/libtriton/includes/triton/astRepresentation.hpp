@@ -53,6 +53,9 @@ namespace triton {
           std::unique_ptr<triton::ast::representations::AstRepresentationInterface> representations[triton::ast::representations::LAST_REPRESENTATION];
 
         public:
+          //! Inline depth above which a node is hoisted into a temporary by printHoisted().
+          static const triton::usize HOIST_DEPTH = 64;
+
           //! Constructor.
           TRITON_EXPORT AstRepresentation();
 
@@ -70,6 +73,18 @@ namespace triton {
 
           //! Displays the node according to the representation mode.
           TRITON_EXPORT std::ostream& print(std::ostream& stream, AbstractNode* node);
+
+          /*!
+           * \brief Displays the node with its shared subterms hoisted into temporaries.
+           *
+           * \details
+           * Non-leaf subterms used more than once (or nested deeper than HOIST_DEPTH) are numbered
+           * by triton::ast::dagExtraction(), like the `node!N` of AstSmtRepresentation::printDag().
+           * They are written first as `tN = ...` (`(define-fun tN () ...)` in SMT mode) and referenced
+           * by name, then the node itself is written. The output is streamed definition by
+           * definition and, if `limit` is not zero, stops after `limit` characters with `...`.
+           */
+          TRITON_EXPORT std::ostream& printHoisted(std::ostream& stream, AbstractNode* node, triton::usize limit=0);
       };
 
     /*! @} End of representations namespace */
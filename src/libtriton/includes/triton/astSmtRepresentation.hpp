@@ -9,6 +9,8 @@
 #define TRITON_ASTSMTREPRESENTATION_HPP
 
 #include <iostream>
+#include <unordered_map>
+#include <vector>
 
 #include <triton/astRepresentationInterface.hpp>
 #include <triton/ast.hpp>
@@ -41,6 +43,16 @@ namespace triton {
 
       //! SMT representation.
       class AstSmtRepresentation : public AstRepresentationInterface {
+        private:
+          //! Returns the node bound by `node` if it is a reference, otherwise returns `node`.
+          triton::ast::AbstractNode* resolve(triton::ast::AbstractNode* node) const;
+
+          //! Returns the operands of `node` which are printed as sub-expressions by printDag.
+          std::vector<triton::ast::AbstractNode*> getOperands(triton::ast::AbstractNode* node) const;
+
+          //! Prints the body of `node`. Operands which are in `names` are printed by their name.
+          void printBody(std::ostream& stream, triton::ast::AbstractNode* node, const std::unordered_map<triton::ast::AbstractNode*, triton::usize>& names);
+
         public:
           //! Constructor.
           TRITON_EXPORT AstSmtRepresentation();
@@ -200,6 +212,17 @@ namespace triton {
 
           //! Displays the node according to the representation mode.
           TRITON_EXPORT std::ostream& print(std::ostream& stream, triton::ast::ZxNode* node);
+
+          /*!
+           * \brief Displays the node as a SMT2 script where each shared sub-expression is printed once.
+           *
+           * \details
+           * Symbolic variables are declared first, then every sub-expression used more than once
+           * is bound by a `(define-fun node!N () <sort> <expr>)` and referenced by its name. References
+           * are unrolled so that the script is self-contained. The output is written in linear time
+           * and memory in the size of the DAG. If `assert_` is true, the node is printed as `(assert <node>)`.
+           */
+          TRITON_EXPORT std::ostream& printDag(std::ostream& stream, const triton::ast::SharedAbstractNode& node, bool assert_=false);
       };
 
     /*! @} End of representations namespace */
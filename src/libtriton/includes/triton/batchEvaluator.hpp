@@ -0,0 +1,134 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_BATCHEVALUATOR_H
+#define TRITON_BATCHEVALUATOR_H
+
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/astEnums.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    /*! \class BatchEvaluator
+     *  \brief Evaluates an AST on many assignments of its variables at once.
+     *
+     *  \details
+     *  The AST is compiled once into a linear tape of instructions (references are inlined, subexpressions
+     *  without symbolic variable are folded into constants and registers are reused once their value is dead).
+     *  The tape is then executed by blocks of BLOCK_SIZE assignments, each instruction being a tight loop
+     *  over the lanes of a block. When all the values fit in 64 bits, the lanes are native integers and
+     *  the loops are vectorized by the compiler. Otherwise, the lanes are triton::uint512.
+     */
+    class BatchEvaluator {
+      friend class JitEvaluator;
+
+      private:
+        //! An instruction of the tape.
+        struct Instruction {
+          //! The kind of the node, BV_NODE for constants.
+          triton::ast::ast_e type;
+
+          //! The size of the result.
+          triton::uint32 size;
+
+          //! The size of the first operand.
+          triton::uint32 operandSize;
+
+          //! The register of the result.
+          triton::usize dst;
+
+          //! The registers of the operands.
+          std::vector<triton::usize> src;
+
+          //! The sizes of the operands of a concatenation.
+          std::vector<triton::uint32> sizes;
+
+          //! The value of a constant, the index of a variable, the low bit of an extraction or the rotation.
+          triton::uint512 immediate;
+        };
+
+        //! The tape.
+        std::vector<Instruction> tape;
+
+        //! The variables of the AST, sorted by id.
+        std::vector<triton::engines::symbolic::SharedSymbolicVariable> variables;
+
+        //! The number of registers.
+        triton::usize registers;
+
+        //! The register of the result.
+        triton::usize result;
+
+        //! The size of the result.
+        triton::uint32 size;
+
+        //! True if all the values fit in 64 bits.
+        bool vectorizable;
+
+        //! Compiles the AST into the tape.
+        void compile(const triton::ast::SharedAbstractNode& node);
+
+        //! Assigns the registers of the tape.
+        void allocate(void);
+
+        //! Executes the tape on `count` assignments, `inputs[i]` holds the values of the variable `i`.
+        template <typename T> void run(const std::vector<const T*>& inputs, triton::usize count, T* output) const;
+
+      public:
+        //! The number of assignments evaluated together.
+        static const triton::usize BLOCK_SIZE = 256;
+
+        //! Constructor. Throws triton::exceptions::Ast if the AST contains a node which cannot be evaluated.
+        TRITON_EXPORT BatchEvaluator(const triton::ast::SharedAbstractNode& node);
+
+        //! Returns the variables of the AST, sorted by id. They are the columns of the inputs of evaluate().
+        TRITON_EXPORT const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& getVariables(void) const;
+
+        //! Returns the number of instructions of the tape.
+        TRITON_EXPORT triton::usize getTapeSize(void) const;
+
+        //! Returns the number of registers used by the tape.
+        TRITON_EXPORT triton::usize getNumberOfRegisters(void) const;
+
+        //! Returns the size of the result.
+        TRITON_EXPORT triton::uint32 getBitvectorSize(void) const;
+
+        //! Returns true if all the values fit in 64 bits, the evaluation on triton::uint64 is then available.
+        TRITON_EXPORT bool isVectorizable(void) const;
+
+        //! Evaluates the AST on each assignment, `inputs[i][j]` is the value of the variable `i` in the assignment `j`. The AST must be vectorizable.
+        TRITON_EXPORT std::vector<triton::uint64> evaluate(const std::vector<std::vector<triton::uint64>>& inputs) const;
+
+        //! Evaluates the AST on each assignment, `inputs[i][j]` is the value of the variable `i` in the assignment `j`.
+        TRITON_EXPORT std::vector<triton::uint512> evaluate(const std::vector<std::vector<triton::uint512>>& inputs) const;
+    };
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_BATCHEVALUATOR_H */
@@ -48,12 +48,6 @@ namespace triton {
         //! Constructor.
         TRITON_EXPORT BitsVector(triton::uint32 high, triton::uint32 low);
 
-        //! Constructor by copy.
-        TRITON_EXPORT BitsVector(const triton::arch::BitsVector& other);
-
-        //! Copy a BitsVector.
-        TRITON_EXPORT BitsVector& operator=(const BitsVector& other);
-
         //! Returns the highest bit
         TRITON_EXPORT triton::uint32 getHigh(void) const;
 
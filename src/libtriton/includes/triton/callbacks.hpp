@@ -10,6 +10,7 @@
 
 #include <atomic>
 #include <list>
+#include <utility>
 
 #include <triton/ast.hpp>
 #include <triton/callbacksEnums.hpp>
@@ -45,6 +46,13 @@ namespace triton {
      */
     using getConcreteMemoryValueCallback = ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&)>;
 
+    /*! \brief The prototype of a GET_CONCRETE_MEMORY_AREA_VALUE callback.
+     *
+     * \details The callback takes an API context as first argument, a base address as second argument and a size at third.
+     * Callbacks will be called once for each LOAD of a concrete memory area (an access, a byte or a bulk read).
+     */
+    using getConcreteMemoryAreaValueCallback = ComparableFunctor<void(triton::API&, triton::uint64 baseAddr, triton::usize size)>;
+
     /*! \brief The prototype of a GET_CONCRETE_REGISTER_VALUE callback.
      *
      * \details The callback takes an API context as first argument and a register as second argument.
@@ -59,6 +67,13 @@ namespace triton {
      */
     using setConcreteMemoryValueCallback = ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&, const triton::uint512& value)>;
 
+    /*! \brief The prototype of a SET_CONCRETE_MEMORY_AREA_VALUE callback.
+     *
+     * \details The callback takes an API context as first argument, a base address as second argument, the new values at third
+     * and their size at fourth. Callbacks will be called once for each STORE of a concrete memory area (an access, a byte or a bulk write).
+     */
+    using setConcreteMemoryAreaValueCallback = ComparableFunctor<void(triton::API&, triton::uint64 baseAddr, const triton::uint8* area, triton::usize size)>;
+
     /*! \brief The prototype of a SET_CONCRETE_REGISTER_VALUE callback.
      *
      * \details The callback takes an API context as first argument, a register as second argument and the value at third.
@@ -74,6 +89,33 @@ namespace triton {
      */
     using symbolicSimplificationCallback = ComparableFunctor<triton::ast::SharedAbstractNode(triton::API&, const triton::ast::SharedAbstractNode&)>;
 
+    /*! \class WatchedCallback
+     *  \brief A memory callback and the range of addresses [first, last] it watches.
+     */
+    template <typename Functor>
+    struct WatchedCallback {
+      //! The callback.
+      Functor function;
+
+      //! The first watched address.
+      triton::uint64 first;
+
+      //! The last watched address.
+      triton::uint64 last;
+
+      //! Returns true if at least one byte of [addr, addr+size) is watched.
+      bool watches(triton::uint64 addr, triton::usize size) const {
+        if (size == 0)
+          return false;
+        triton::uint64 end = addr + size - 1;
+        /* The access wraps around the address space */
+        if (end < addr)
+          return this->last >= addr || this->first <= end;
+        return this->first <= end && addr <= this->last;
+      }
+    };
+
+
     //! \class Callbacks
     /*! \brief The callbacks class */
     class Callbacks {
@@ -93,18 +135,30 @@ namespace triton {
         //! Mutex for the setConcreteMemoryValue callback
         std::atomic<bool> mstore;
 
+        //! Mutex for the getConcreteMemoryAreaValue callback
+        std::atomic<bool> mloadArea;
+
+        //! Mutex for the setConcreteMemoryAreaValue callback
+        std::atomic<bool> mstoreArea;
+
         //! True if there is at least one callback defined.
         std::atomic<bool> defined;
 
       protected:
+        //! [c++] Callbacks for all concrete memory area needs (LOAD).
+        std::list<WatchedCallback<triton::callbacks::getConcreteMemoryAreaValueCallback>> getConcreteMemoryAreaValueCallbacks;
+
         //! [c++] Callbacks for all concrete memory needs (LOAD).
-        std::list<triton::callbacks::getConcreteMemoryValueCallback> getConcreteMemoryValueCallbacks;
+        std::list<WatchedCallback<triton::callbacks::getConcreteMemoryValueCallback>> getConcreteMemoryValueCallbacks;
 
         //! [c++] Callbacks for all concrete register needs (GET).
         std::list<triton::callbacks::getConcreteRegisterValueCallback> getConcreteRegisterValueCallbacks;
 
+        //! [c++] Callbacks for all concrete memory area needs (STORE).
+        std::list<WatchedCallback<triton::callbacks::setConcreteMemoryAreaValueCallback>> setConcreteMemoryAreaValueCallbacks;
+
         //! [c++] Callbacks for all concrete memory needs (STORE).
-        std::list<triton::callbacks::setConcreteMemoryValueCallback> setConcreteMemoryValueCallbacks;
+        std::list<WatchedCallback<triton::callbacks::setConcreteMemoryValueCallback>> setConcreteMemoryValueCallbacks;
 
         //! [c++] Callbacks for all concrete register needs (PUT).
         std::list<triton::callbacks::setConcreteRegisterValueCallback> setConcreteRegisterValueCallbacks;
@@ -115,18 +169,27 @@ namespace triton {
         //! Returns the number of callbacks recorded.
         triton::usize countCallbacks(void) const;
 
+        //! Returns the watched range [first, last] of [baseAddr, baseAddr+size). A size of 0 watches the whole address space.
+        static std::pair<triton::uint64, triton::uint64> getWatchedRange(triton::uint64 baseAddr, triton::usize size);
+
       public:
         //! Constructor.
         TRITON_EXPORT Callbacks(triton::API& api);
 
-        //! Adds a GET_CONCRETE_MEMORY_VALUE callback.
-        TRITON_EXPORT void addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&)> cb);
+        //! Adds a GET_CONCRETE_MEMORY_VALUE callback watching [baseAddr, baseAddr+size). A size of 0 watches the whole memory.
+        TRITON_EXPORT void addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&)> cb, triton::uint64 baseAddr=0, triton::usize size=0);
+
+        //! Adds a GET_CONCRETE_MEMORY_AREA_VALUE callback watching [baseAddr, baseAddr+size). A size of 0 watches the whole memory.
+        TRITON_EXPORT void addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, triton::uint64, triton::usize)> cb, triton::uint64 baseAddr=0, triton::usize size=0);
 
         //! Adds a GET_CONCRETE_REGISTER_VALUE callback.
         TRITON_EXPORT void addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::Register&)> cb);
 
-        //! Adds a SET_CONCRETE_MEMORY_VALUE callback.
-        TRITON_EXPORT void addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&, const triton::uint512& value)> cb);
+        //! Adds a SET_CONCRETE_MEMORY_VALUE callback watching [baseAddr, baseAddr+size). A size of 0 watches the whole memory.
+        TRITON_EXPORT void addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&, const triton::uint512& value)> cb, triton::uint64 baseAddr=0, triton::usize size=0);
+
+        //! Adds a SET_CONCRETE_MEMORY_AREA_VALUE callback watching [baseAddr, baseAddr+size). A size of 0 watches the whole memory.
+        TRITON_EXPORT void addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, triton::uint64, const triton::uint8*, triton::usize)> cb, triton::uint64 baseAddr=0, triton::usize size=0);
 
         //! Adds a SET_CONCRETE_REGISTER_VALUE callback.
         TRITON_EXPORT void addCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::Register&, const triton::uint512& value)> cb);
@@ -137,15 +200,21 @@ namespace triton {
         //! Clears recorded callbacks.
         TRITON_EXPORT void clearCallbacks(void);
 
-        //! Deletes a GET_CONCRETE_MEMORY_VALUE callback.
+        //! Deletes a GET_CONCRETE_MEMORY_VALUE callback (all its watched ranges).
         TRITON_EXPORT void removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&)> cb);
 
+        //! Deletes a GET_CONCRETE_MEMORY_AREA_VALUE callback (all its watched ranges).
+        TRITON_EXPORT void removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, triton::uint64, triton::usize)> cb);
+
         //! Deletes a GET_CONCRETE_REGISTER_VALUE callback.
         TRITON_EXPORT void removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::Register&)> cb);
 
-        //! Deletes a SET_CONCRETE_MEMORY_VALUE callback.
+        //! Deletes a SET_CONCRETE_MEMORY_VALUE callback (all its watched ranges).
         TRITON_EXPORT void removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::MemoryAccess&, const triton::uint512& value)> cb);
 
+        //! Deletes a SET_CONCRETE_MEMORY_AREA_VALUE callback (all its watched ranges).
+        TRITON_EXPORT void removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, triton::uint64, const triton::uint8*, triton::usize)> cb);
+
         //! Deletes a SET_CONCRETE_REGISTER_VALUE callback.
         TRITON_EXPORT void removeCallback(triton::callbacks::callback_e kind, ComparableFunctor<void(triton::API&, const triton::arch::Register&, const triton::uint512& value)> cb);
 
@@ -167,9 +236,18 @@ namespace triton {
         //! Processes callbacks according to the kind and the C++ polymorphism.
         TRITON_EXPORT void processCallbacks(triton::callbacks::callback_e kind, const triton::arch::Register& reg, const triton::uint512& value);
 
+        //! Processes callbacks according to the kind and the C++ polymorphism.
+        TRITON_EXPORT void processCallbacks(triton::callbacks::callback_e kind, triton::uint64 baseAddr, triton::usize size);
+
+        //! Processes callbacks according to the kind and the C++ polymorphism.
+        TRITON_EXPORT void processCallbacks(triton::callbacks::callback_e kind, triton::uint64 baseAddr, const triton::uint8* area, triton::usize size);
+
         //! Returns true if the callback is defined.
         TRITON_EXPORT bool isDefined(triton::callbacks::callback_e kind) const;
 
+        //! Returns true if a callback of this kind watches at least one byte of [baseAddr, baseAddr+size).
+        TRITON_EXPORT bool isDefined(triton::callbacks::callback_e kind, triton::uint64 baseAddr, triton::usize size) const;
+
         //! Returns true if at least one callback is defined.
         TRITON_EXPORT bool isDefined(void) const;
     };
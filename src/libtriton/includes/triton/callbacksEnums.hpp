@@ -32,6 +32,8 @@ namespace triton {
       SET_CONCRETE_MEMORY_VALUE,    /*!< STORE concrete memory value callback */
       SET_CONCRETE_REGISTER_VALUE,  /*!< PUT concrete register value callback */
       SYMBOLIC_SIMPLIFICATION,      /*!< Symbolic simplification callback */
+      GET_CONCRETE_MEMORY_AREA_VALUE, /*!< LOAD concrete memory area callback */
+      SET_CONCRETE_MEMORY_AREA_VALUE, /*!< STORE concrete memory area callback */
     };
 
   /*! @} End of callbacks namespace */
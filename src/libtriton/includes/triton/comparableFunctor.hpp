@@ -58,6 +58,12 @@ namespace triton {
         return F_(api, param1, param2);
       }
 
+      //! Forward call to real functor
+      template <class apiType, class paramType1, class paramType2, class paramType3>
+      auto operator()(apiType& api, paramType1& param1, paramType2& param2, paramType3& param3) const -> decltype(F_(api, param1, param2, param3)) {
+        return F_(api, param1, param2, param3);
+      }
+
       //! Comparison of functor based on id
       template <class T>
       bool operator==(const ComparableFunctor<T>& O) const {
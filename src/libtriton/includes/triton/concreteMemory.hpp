@@ -0,0 +1,128 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_CONCRETEMEMORY_HPP
+#define TRITON_CONCRETEMEMORY_HPP
+
+#include <map>
+#include <memory>
+
+#include <triton/dllexport.hpp>
+#include <triton/pagedMap.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    //! A read-only area of bytes mapped into the concrete memory.
+    struct MappedMemoryArea {
+      //! The bytes of the area (not owned).
+      const triton::uint8* data;
+
+      //! The size of the area.
+      triton::usize size;
+
+      //! Keeps `data` alive as long as the area is mapped (may be null if the caller owns it).
+      std::shared_ptr<const void> owner;
+    };
+
+
+    /*! \class ConcreteMemory
+     *  \brief The concrete memory of a CPU.
+     *
+     *  \details
+     *  Bytes are stored in copy-on-write pages. Caller-owned areas may also be
+     *  mapped without copy: they are read in place and a write to one of their
+     *  bytes goes to the pages (copy-on-write), the area itself is never modified.
+     *  Copying a memory is O(1) and copies share their mapped areas.
+     */
+    class ConcreteMemory {
+      private:
+        //! The mapped areas (base address -> area).
+        using MappedAreas = std::map<triton::uint64, MappedMemoryArea>;
+
+        //! Written bytes. They take precedence over mapped areas.
+        triton::utils::PagedMap<triton::uint8, 12> pages;
+
+        //! Cleared bytes of mapped areas.
+        triton::utils::PagedSet<12> holes;
+
+        //! The mapped areas, shared between copies until one of them maps or unmaps an area.
+        std::shared_ptr<const MappedAreas> areas;
+
+        //! Returns the mapped area which contains `addr` or nullptr.
+        const MappedMemoryArea* findArea(triton::uint64 addr, triton::uint64* base) const;
+
+      public:
+        //! Returns the value of a byte or nullptr if not defined.
+        TRITON_EXPORT const triton::uint8* get(triton::uint64 addr) const;
+
+        //! Returns true if the byte is defined.
+        TRITON_EXPORT bool has(triton::uint64 addr) const;
+
+        //! Sets the value of a byte.
+        TRITON_EXPORT void set(triton::uint64 addr, triton::uint8 value);
+
+        //! Undefines a byte.
+        TRITON_EXPORT void erase(triton::uint64 addr);
+
+        //! Copies [addr, addr+size) into `out`. Undefined bytes are read as zero.
+        TRITON_EXPORT void read(triton::uint64 addr, triton::uint8* out, triton::usize size) const;
+
+        //! Sets the values of [addr, addr+size).
+        TRITON_EXPORT void write(triton::uint64 addr, const triton::uint8* values, triton::usize size);
+
+        //! Returns true if all bytes of [addr, addr+size) are defined.
+        TRITON_EXPORT bool isDefined(triton::uint64 addr, triton::usize size) const;
+
+        //! Undefines [addr, addr+size).
+        TRITON_EXPORT void erase(triton::uint64 addr, triton::usize size);
+
+        /*!
+         * \brief Maps a read-only area at `base` without copying it.
+         *
+         * \details
+         * Previous values of [base, base+size) are discarded. `data` must stay valid
+         * while the area is mapped in this memory or in one of its copies, `owner` may
+         * be used to tie its lifetime to the mapping. Throws if the area overlaps
+         * another mapped area.
+         */
+        TRITON_EXPORT void map(triton::uint64 base, const triton::uint8* data, triton::usize size, const std::shared_ptr<const void>& owner=nullptr);
+
+        //! Unmaps the area mapped at `base`. Its bytes become undefined.
+        TRITON_EXPORT void unmap(triton::uint64 base);
+
+        //! Returns true if `addr` belongs to a mapped area.
+        TRITON_EXPORT bool isMapped(triton::uint64 addr) const;
+
+        //! Returns the mapped areas as (base address, size).
+        TRITON_EXPORT std::map<triton::uint64, triton::usize> getMappedAreas(void) const;
+
+        //! Clears the memory and unmaps all areas.
+        TRITON_EXPORT void clear(void);
+    };
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_CONCRETEMEMORY_HPP */
@@ -8,12 +8,15 @@
 #ifndef TRITON_CPUINTERFACE_HPP
 #define TRITON_CPUINTERFACE_HPP
 
+#include <map>
+#include <memory>
 #include <set>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 #include <triton/archEnums.hpp>
+#include <triton/concreteMemory.hpp>
 #include <triton/dllexport.hpp>
 #include <triton/instruction.hpp>
 #include <triton/memoryAccess.hpp>
@@ -110,6 +113,9 @@ namespace triton {
         //! Returns the concrete value of a memory area.
         TRITON_EXPORT virtual std::vector<triton::uint8> getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks=true) const = 0;
 
+        //! Copies the concrete value of a memory area into `area` (`size` bytes).
+        TRITON_EXPORT virtual void getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::uint8* area, triton::usize size, bool execCallbacks=true) const = 0;
+
         //! Returns the concrete value of a register.
         TRITON_EXPORT virtual triton::uint512 getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks=true) const = 0;
 
@@ -164,6 +170,26 @@ namespace triton {
 
         //! Clears concrete values assigned to the memory cells
         TRITON_EXPORT virtual void clearConcreteMemoryValue(triton::uint64 baseAddr, triton::usize size=1) = 0;
+
+        /*!
+         * \brief [**architecture api**] - Maps a read-only area as concrete memory without copying it.
+         *
+         * \details The area is read in place and writes go to a copy-on-write overlay. `area`
+         * must stay valid while it is mapped, `owner` may be used to tie its lifetime to the mapping.
+         */
+        TRITON_EXPORT virtual void mapConcreteMemoryArea(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size, const std::shared_ptr<const void>& owner=nullptr) = 0;
+
+        //! Unmaps the area mapped at `baseAddr`. Its concrete values become undefined.
+        TRITON_EXPORT virtual void unmapConcreteMemoryArea(triton::uint64 baseAddr) = 0;
+
+        //! Returns the mapped areas as (base address, size).
+        TRITON_EXPORT virtual std::map<triton::uint64, triton::usize> getMappedConcreteMemoryAreas(void) const = 0;
+
+        //! Returns the concrete memory (bytes and mapped areas).
+        TRITON_EXPORT virtual const triton::arch::ConcreteMemory& getConcreteMemory(void) const = 0;
+
+        //! Replaces the concrete memory. This is O(1), pages and mapped areas are shared copy-on-write.
+        TRITON_EXPORT virtual void setConcreteMemory(const triton::arch::ConcreteMemory& memory) = 0;
     };
 
   /*! @} End of arch namespace */
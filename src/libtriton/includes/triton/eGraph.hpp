@@ -0,0 +1,200 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_EGRAPH_H
+#define TRITON_EGRAPH_H
+
+#include <chrono>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/astEnums.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/rewriteEngine.hpp>
+#include <triton/symbolicEnums.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      /*! \class EGraph
+       *  \brief Simplifies ASTs by equality saturation.
+       *
+       *  \details
+       *  An e-graph holds equivalence classes (e-classes) of nodes whose children are e-classes, so it
+       *  represents many equivalent ASTs at once. The rules of a triton::engines::symbolic::RewriteEngine
+       *  are applied everywhere in the e-graph without removing anything, which avoids the local minima
+       *  of a rewriting applied in one direction. The cheapest AST of an e-class is then extracted. Nodes
+       *  which are not operators of the rules (variables, references, extract, concat...) are kept, their
+       *  operands are simplified too. The saturation stops when no rule adds anything or when the number
+       *  of nodes or the time is over its budget.
+       */
+      class EGraph {
+        private:
+          //! A node of the e-graph.
+          struct ENode {
+            //! The kind of the node, BV_NODE for constants.
+            triton::ast::ast_e op;
+
+            //! The e-classes of the children.
+            std::vector<triton::usize> children;
+
+            //! The value of a constant.
+            triton::uint512 value;
+
+            //! The size of the bitvector.
+            triton::uint32 size;
+
+            //! The original node of the nodes which are not operators of the rules.
+            triton::ast::SharedAbstractNode origin;
+
+            //! Returns true if both nodes are the same.
+            bool operator==(const ENode& other) const;
+          };
+
+          //! Hashes a node of the e-graph.
+          struct ENodeHash {
+            std::size_t operator()(const ENode& node) const;
+          };
+
+          //! An equivalence class.
+          struct EClass {
+            //! The nodes of the class.
+            std::vector<triton::usize> nodes;
+
+            //! The size of the bitvector.
+            triton::uint32 size;
+
+            //! True if the class is a constant.
+            bool constant;
+
+            //! The value of the constant.
+            triton::uint512 value;
+          };
+
+          //! A substitution of the variables of a rule by e-classes.
+          typedef std::vector<triton::usize> Substitution;
+
+          //! The rules.
+          const RewriteEngine& rules;
+
+          //! The maximum number of nodes (0 means unlimited).
+          triton::usize nodeLimit;
+
+          //! The time budget in milliseconds (0 means unlimited).
+          triton::usize timeLimit;
+
+          //! The start of the saturation.
+          std::chrono::steady_clock::time_point start;
+
+          //! The context of the added ASTs.
+          triton::ast::SharedAstContext ctxt;
+
+          //! The nodes.
+          std::vector<ENode> nodes;
+
+          //! The e-class of each node.
+          std::vector<triton::usize> owners;
+
+          //! The e-classes. Merged classes have no node.
+          std::vector<EClass> classes;
+
+          //! The union-find of the e-classes.
+          std::vector<triton::usize> parents;
+
+          //! The e-class of each canonical node.
+          std::unordered_map<ENode, triton::usize, ENodeHash> hashcons;
+
+          //! Returns the canonical e-class.
+          triton::usize find(triton::usize eclass);
+
+          //! Merges two e-classes. Returns true if they were different.
+          bool merge(triton::usize a, triton::usize b);
+
+          //! Adds a node and returns its e-class. Operators whose children are constants are folded.
+          triton::usize addNode(ENode node);
+
+          //! Folds an operator whose children are constants into its e-class. Returns true if the e-class changed.
+          bool fold(triton::usize node);
+
+          //! Adds a constant and returns its e-class.
+          triton::usize addConstant(const triton::uint512& value, triton::uint32 size);
+
+          //! Restores the congruence of the e-graph after merges.
+          void rebuild(void);
+
+          //! Returns true if a budget is exhausted.
+          bool isOverBudget(void) const;
+
+          //! Appends to `out` the extensions of `subst` matching all the pending (term, e-class) pairs, until `out` has `limit` elements.
+          void match(std::vector<std::pair<triton::usize, triton::usize>>& pending, Substitution& subst, std::vector<Substitution>& out, triton::usize limit);
+
+          //! Adds the right-hand side of a rule and returns its e-class.
+          triton::usize instantiate(triton::usize term, const Substitution& subst, triton::uint32 size);
+
+          //! Returns the cost of a node without its children.
+          triton::usize getCost(const ENode& node, triton::engines::symbolic::cost_e cost);
+
+        public:
+          //! The default maximum number of nodes.
+          static const triton::usize DEFAULT_NODE_LIMIT = 10000;
+
+          //! The default time budget in milliseconds.
+          static const triton::usize DEFAULT_TIME_LIMIT = 1000;
+
+          //! Constructor. The saturation uses the rules of `rules`. A limit of 0 is unlimited, but not both of them.
+          TRITON_EXPORT EGraph(const RewriteEngine& rules, triton::usize nodeLimit=DEFAULT_NODE_LIMIT, triton::usize timeLimit=DEFAULT_TIME_LIMIT);
+
+          //! Adds an AST and returns its e-class. References are not unrolled.
+          TRITON_EXPORT triton::usize add(const triton::ast::SharedAbstractNode& node);
+
+          //! Applies the rules until saturation or until a budget is exhausted. Returns true if the e-graph is saturated.
+          TRITON_EXPORT bool saturate(void);
+
+          //! Returns the cheapest AST of an e-class.
+          TRITON_EXPORT triton::ast::SharedAbstractNode extract(triton::usize eclass, triton::engines::symbolic::cost_e cost=SIZE_COST);
+
+          //! Returns the number of nodes.
+          TRITON_EXPORT triton::usize getNumberOfNodes(void) const;
+
+          //! Returns the rules used by default (boolean algebra, arithmetic and mixed boolean-arithmetic identities).
+          TRITON_EXPORT static std::string getDefaultRules(void);
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_EGRAPH_H */
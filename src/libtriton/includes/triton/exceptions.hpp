@@ -156,6 +156,18 @@ namespace triton {
     };
 
 
+    /*! \class SnapshotEngine
+     *  \brief The exception class used by the snapshot engine. */
+    class SnapshotEngine : public triton::exceptions::Engines {
+      public:
+        //! Constructor.
+        TRITON_EXPORT SnapshotEngine(const char* message) : triton::exceptions::Engines(message) {};
+
+        //! Constructor.
+        TRITON_EXPORT SnapshotEngine(const std::string& message) : triton::exceptions::Engines(message) {};
+    };
+
+
     /*! \class SolverEngine
      *  \brief The exception class used by the solver engine. */
     class SolverEngine : public triton::exceptions::Engines {
@@ -180,6 +192,18 @@ namespace triton {
     };
 
 
+    /*! \class SynthesisEngine
+     *  \brief The exception class used by the synthesis engine. */
+    class SynthesisEngine : public triton::exceptions::Engines {
+      public:
+        //! Constructor.
+        TRITON_EXPORT SynthesisEngine(const char* message) : triton::exceptions::Engines(message) {};
+
+        //! Constructor.
+        TRITON_EXPORT SynthesisEngine(const std::string& message) : triton::exceptions::Engines(message) {};
+    };
+
+
     /*! \class API
      *  \brief The exception class used by the Triton's API. */
     class API : public triton::exceptions::Exception {
@@ -407,6 +431,30 @@ namespace triton {
         TRITON_EXPORT Callbacks(const std::string& message) : triton::exceptions::Exception(message) {};
     };
 
+
+    /*! \class MappedFile
+     *  \brief The exception class used by mapped files. */
+    class MappedFile : public triton::exceptions::Exception {
+      public:
+        //! Constructor.
+        TRITON_EXPORT MappedFile(const char* message) : triton::exceptions::Exception(message) {};
+
+        //! Constructor.
+        TRITON_EXPORT MappedFile(const std::string& message) : triton::exceptions::Exception(message) {};
+    };
+
+
+    /*! \class ExecutionTrace
+     *  \brief The exception class used by execution traces. */
+    class ExecutionTrace : public triton::exceptions::Exception {
+      public:
+        //! Constructor.
+        TRITON_EXPORT ExecutionTrace(const char* message) : triton::exceptions::Exception(message) {};
+
+        //! Constructor.
+        TRITON_EXPORT ExecutionTrace(const std::string& message) : triton::exceptions::Exception(message) {};
+    };
+
     /*! \class Callbacks
      *  \brief The exception class used by python callbacks. */
     class PyCallbacks : public triton::exceptions::Exception {
@@ -0,0 +1,184 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_EXECUTIONTRACE_HPP
+#define TRITON_EXECUTIONTRACE_HPP
+
+#include <iostream>
+#include <utility>
+#include <vector>
+
+#include <triton/archEnums.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/register.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Utils namespace
+  namespace utils {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup utils
+   *  @{
+   */
+
+    //! The version of the execution trace format.
+    const triton::uint32 EXECUTION_TRACE_VERSION = 1;
+
+    //! Kinds of records of an execution trace.
+    enum trace_record_e {
+      TRACE_RECORD_INVALID = 0, //!< invalid record
+      TRACE_RECORD_SYNC,        //!< register snapshot
+      TRACE_RECORD_INSTRUCTION, //!< executed instruction with the memory it reads
+      TRACE_RECORD_WRITE,       //!< memory written by the previous instruction
+    };
+
+
+    //! A memory area of an execution trace.
+    struct TraceMemoryAccess {
+      //! The address of the area.
+      triton::uint64 address;
+
+      //! The bytes of the area.
+      std::vector<triton::uint8> data;
+    };
+
+
+    //! A record of an execution trace.
+    struct TraceRecord {
+      //! The kind of the record as triton::utils::trace_record_e.
+      triton::uint8 kind;
+
+      //! The thread id (sync and instruction records).
+      triton::uint32 tid;
+
+      //! The address of the instruction.
+      triton::uint64 pc;
+
+      //! The opcode of the instruction.
+      std::vector<triton::uint8> opcode;
+
+      //! The registers of a sync record as (register id, value).
+      std::vector<std::pair<triton::arch::register_e, triton::uint512>> registers;
+
+      //! The memory read by an instruction or written (a single access) by a write record.
+      std::vector<TraceMemoryAccess> memory;
+    };
+
+
+    /*! \class TraceWriter
+     *  \brief Writes an execution trace.
+     *
+     *  \details
+     *  The trace starts with a header (magic, version, architecture) followed by records. Each record
+     *  is its kind (one byte), the size of its payload (four bytes) and its payload, all integers are
+     *  little endian. A sync record holds the values of registers, an instruction record holds the
+     *  address, the thread id, the opcode and the bytes read by the instruction and a write record
+     *  holds the bytes written by the previous instruction. A tracer emits a sync record from time to
+     *  time so that the trace may be replayed from there without the previous records.
+     */
+    class TraceWriter {
+      private:
+        //! The output stream.
+        std::ostream& stream;
+
+        //! The payload of the current record.
+        std::vector<triton::uint8> payload;
+
+        //! Appends an integer of `size` bytes to the payload.
+        void put(triton::uint64 value, triton::uint32 size);
+
+        //! Appends a memory area to the payload.
+        void put(triton::uint64 address, const triton::uint8* data, triton::uint32 size);
+
+        //! Writes the current payload as a record of `kind`.
+        void flushRecord(triton::uint8 kind);
+
+      public:
+        //! Constructor. Writes the header of the trace.
+        TRITON_EXPORT TraceWriter(std::ostream& stream, triton::arch::architecture_e arch);
+
+        //! Writes a sync record with the values of `registers`.
+        TRITON_EXPORT void writeSync(triton::uint32 tid, const std::vector<std::pair<triton::arch::Register, triton::uint512>>& registers);
+
+        //! Writes an instruction record. `reads` are the memory areas read by the instruction with their values.
+        TRITON_EXPORT void writeInstruction(triton::uint64 pc, triton::uint32 tid, const triton::uint8* opcode, triton::uint32 size, const std::vector<TraceMemoryAccess>& reads);
+
+        //! Writes a write record: the values of a memory area after the previous instruction.
+        TRITON_EXPORT void writeMemory(triton::uint64 address, const triton::uint8* data, triton::uint32 size);
+    };
+
+
+    /*! \class TraceReader
+     *  \brief Reads an execution trace written by a TraceWriter.
+     */
+    class TraceReader {
+      private:
+        //! The input stream.
+        std::istream& stream;
+
+        //! The architecture of the trace.
+        triton::arch::architecture_e arch;
+
+        //! The offset of the first record.
+        triton::uint64 first;
+
+        //! The payload of the current record.
+        std::vector<triton::uint8> payload;
+
+        //! The read position in the payload.
+        triton::usize cursor;
+
+        //! Reads an integer of `size` bytes from the stream. Returns false at the end of the stream.
+        bool read(triton::uint64& value, triton::uint32 size);
+
+        //! Reads an integer of `size` bytes from the payload.
+        triton::uint64 get(triton::uint32 size);
+
+        //! Reads `size` bytes from the payload.
+        const triton::uint8* getBytes(triton::usize size);
+
+        //! Reads a memory area from the payload.
+        TraceMemoryAccess getMemory(void);
+
+      public:
+        //! Constructor. Reads the header of the trace and throws triton::exceptions::ExecutionTrace if it is invalid.
+        TRITON_EXPORT TraceReader(std::istream& stream);
+
+        //! Returns the architecture of the trace.
+        TRITON_EXPORT triton::arch::architecture_e getArchitecture(void) const;
+
+        //! Returns the offset of the first record.
+        TRITON_EXPORT triton::uint64 getFirstOffset(void) const;
+
+        //! Returns the offset of the next record.
+        TRITON_EXPORT triton::uint64 tell(void);
+
+        //! Moves to the record at `offset` (0 means the first record).
+        TRITON_EXPORT void seek(triton::uint64 offset);
+
+        //! Reads the next record. Returns false at the end of the trace.
+        TRITON_EXPORT bool next(TraceRecord& record);
+
+        //! Returns the offsets of the sync records. The trace may be replayed independently from each of them.
+        TRITON_EXPORT std::vector<triton::uint64> getSyncPoints(void);
+    };
+
+  /*! @} End of utils namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_EXECUTIONTRACE_HPP */
@@ -8,6 +8,8 @@
 #ifndef TRITON_EXTERNALLIBS_HPP
 #define TRITON_EXTERNALLIBS_HPP
 
+#include <mutex>
+
 
 
 //! The Triton namespace
@@ -37,6 +39,18 @@ namespace triton {
       #elif _WIN32
         #include <capstone.h>
       #endif
+
+      /*!
+       * \brief Returns the lock which serializes `cs_open()` and `cs_close()`.
+       *
+       * \details
+       * Capstone lazily initializes global tables when a handle is opened. A handle
+       * is then owned by one CPU and may be used without locking.
+       */
+      inline std::mutex& getHandleMutex(void) {
+        static std::mutex m;
+        return m;
+      }
     /*! @} End of capstone namespace */
     };
 
@@ -0,0 +1,100 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_JITEVALUATOR_H
+#define TRITON_JITEVALUATOR_H
+
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/batchEvaluator.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    /*! \class JitEvaluator
+     *  \brief Compiles an AST to native x86-64 code.
+     *
+     *  \details
+     *  The tape of a triton::ast::BatchEvaluator is lowered to a function `uint64 f(const uint64* inputs)`,
+     *  where `inputs[i]` is the value of the variable `i` of getVariables(). Each register of the tape is a
+     *  slot of the stack frame and each instruction is a short sequence of machine instructions, signed
+     *  divisions are calls to helpers. The code is emitted in memory which is made executable, it is
+     *  released by the destructor. Only available on x86-64 and for ASTs whose values fit in 64 bits.
+     */
+    class JitEvaluator {
+      public:
+        //! The type of the compiled function.
+        typedef triton::uint64 (*function_t)(const triton::uint64* inputs);
+
+      private:
+        //! The tape which is compiled.
+        triton::ast::BatchEvaluator tape;
+
+        //! The machine code.
+        std::vector<triton::uint8> code;
+
+        //! The executable memory.
+        void* memory;
+
+        //! The compiled function.
+        function_t function;
+
+        //! Emits the machine code of the tape.
+        void emit(void);
+
+        //! Copies the machine code into executable memory.
+        void load(void);
+
+      public:
+        //! Constructor. Throws triton::exceptions::Ast if the AST cannot be compiled.
+        TRITON_EXPORT JitEvaluator(const triton::ast::SharedAbstractNode& node);
+
+        //! Destructor.
+        TRITON_EXPORT ~JitEvaluator();
+
+        JitEvaluator(const JitEvaluator&) = delete;
+        JitEvaluator& operator=(const JitEvaluator&) = delete;
+
+        //! Returns true if native code can be generated on this platform.
+        TRITON_EXPORT static bool isSupported(void);
+
+        //! Returns the variables of the AST, sorted by id. They are the inputs of the function.
+        TRITON_EXPORT const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& getVariables(void) const;
+
+        //! Returns the size of the machine code.
+        TRITON_EXPORT triton::usize getCodeSize(void) const;
+
+        //! Returns the compiled function.
+        TRITON_EXPORT function_t getFunction(void) const;
+
+        //! Evaluates the AST, `inputs[i]` is the value of the variable `i`.
+        TRITON_EXPORT triton::uint64 evaluate(const std::vector<triton::uint64>& inputs) const;
+    };
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_JITEVALUATOR_H */
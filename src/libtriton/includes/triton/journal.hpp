@@ -0,0 +1,203 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_JOURNAL_H
+#define TRITON_JOURNAL_H
+
+#include <memory>
+#include <vector>
+
+#include <triton/archEnums.hpp>
+#include <triton/concreteMemory.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/symbolicExpression.hpp>
+#include <triton/symbolicVariable.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Snapshot namespace
+    namespace snapshot {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup snapshot
+     *  @{
+     */
+
+      //! The kinds of journal entries.
+      enum journal_e {
+        JOURNAL_CONCRETE_MEMORY = 0,          //!< A memory range has been written. Saves the previous state of its cells.
+        JOURNAL_CONCRETE_MEMORY_STATE,        //!< An area has been mapped or unmapped. Saves the previous memory (copy-on-write).
+        JOURNAL_CONCRETE_REGISTER,            //!< A register has been written. Saves its previous value.
+        JOURNAL_SYMBOLIC_EXPRESSION,          //!< A symbolic expression id has been allocated.
+        JOURNAL_SYMBOLIC_EXPRESSION_REMOVED,  //!< A symbolic expression has been removed. Saves the expression.
+        JOURNAL_SYMBOLIC_MEMORY,              //!< A memory reference has been changed. Saves its previous expression.
+        JOURNAL_SYMBOLIC_REGISTER,            //!< A register reference has been changed. Saves its previous expression.
+        JOURNAL_SYMBOLIC_VARIABLE,            //!< A symbolic variable id has been allocated.
+        JOURNAL_TAINTED_MEMORY,               //!< The taint of a memory cell has been changed. Saves its previous state.
+        JOURNAL_TAINTED_REGISTER,             //!< The taint of a register has been changed. Saves its previous state.
+        JOURNAL_VARIABLE_VALUE,               //!< The value of a symbolic variable has been changed. Saves its previous value.
+      };
+
+
+      //! A view of the most recent entry of the journal, valid until Journal::pop().
+      struct JournalEntry {
+        //! The kind of entry.
+        journal_e kind;
+
+        //! The address, the register id or the expression/variable id.
+        triton::uint64 key;
+
+        //! The previous taint (JOURNAL_TAINTED_*).
+        bool flag;
+
+        //! The number of memory cells from `key` (JOURNAL_CONCRETE_MEMORY).
+        triton::usize size;
+
+        //! The previous concrete value (JOURNAL_CONCRETE_REGISTER, JOURNAL_VARIABLE_VALUE).
+        const triton::uint512* value;
+
+        //! The previous symbolic expression, nullptr inside if none (JOURNAL_SYMBOLIC_*).
+        const triton::engines::symbolic::SharedSymbolicExpression* expr;
+
+        //! The previous values of the memory cells (JOURNAL_CONCRETE_MEMORY).
+        const triton::uint8* values;
+
+        //! Whether the memory cells were defined, nullptr if they all were (JOURNAL_CONCRETE_MEMORY).
+        const triton::uint8* defined;
+
+        //! The previous concrete memory (JOURNAL_CONCRETE_MEMORY_STATE).
+        const triton::arch::ConcreteMemory* state;
+      };
+
+
+      /*! \class Journal
+       *  \brief An undo log of the changes applied on the concrete, symbolic and taint states.
+       *
+       *  \details
+       *  When enabled, every write records the previous state of what it modifies, thus
+       *  rolling back N writes costs N entries whatever the size of the state. An entry is
+       *  a 16 bytes record, its payload (if any) is pushed on a stack of its own type.
+       */
+      class Journal {
+        private:
+          //! A compact undo record. `flag` is the previous taint, whether the memory cells were all defined, or whether there was an expression.
+          struct Record {
+            triton::uint64 key;
+            triton::uint32 size;
+            triton::uint8 kind;
+            bool flag;
+          };
+
+          //! True if writes are recorded.
+          bool enabled;
+
+          //! The undo records, the most recent at the end.
+          std::vector<Record> records;
+
+          //! The previous concrete values of registers and symbolic variables.
+          std::vector<triton::uint512> values;
+
+          //! The previous symbolic expressions.
+          std::vector<triton::engines::symbolic::SharedSymbolicExpression> exprs;
+
+          //! The previous values of memory cells.
+          std::vector<triton::uint8> bytes;
+
+          //! Whether memory cells were defined, only for ranges which were partially defined.
+          std::vector<triton::uint8> defined;
+
+          //! The previous concrete memories.
+          std::vector<std::shared_ptr<const triton::arch::ConcreteMemory>> states;
+
+          //! The expression seen by entries which had none.
+          triton::engines::symbolic::SharedSymbolicExpression none;
+
+          //! Pushes a record.
+          void push(journal_e kind, triton::uint64 key, bool flag, triton::uint32 size=0);
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT Journal();
+
+          //! Returns true if writes are recorded.
+          inline bool isEnabled(void) const {
+            return this->enabled;
+          }
+
+          //! Enables or disables the recording.
+          TRITON_EXPORT void enable(bool flag);
+
+          //! Returns the number of entries.
+          TRITON_EXPORT triton::usize size(void) const;
+
+          //! Returns a view of the most recent entry.
+          TRITON_EXPORT JournalEntry back(void) const;
+
+          //! Removes the most recent entry.
+          TRITON_EXPORT void pop(void);
+
+          //! Removes all entries.
+          TRITON_EXPORT void clear(void);
+
+          //! Records the previous values of `size` memory cells from `baseAddr`. `defined` is nullptr if all cells were defined.
+          TRITON_EXPORT void recordConcreteMemory(triton::uint64 baseAddr, const triton::uint8* values, const triton::uint8* defined, triton::usize size);
+
+          //! Records the previous concrete memory, before a mapping change. The copy is O(1).
+          TRITON_EXPORT void recordConcreteMemoryState(const triton::arch::ConcreteMemory& memory);
+
+          //! Records the previous value of a register.
+          TRITON_EXPORT void recordConcreteRegister(triton::arch::register_e regId, const triton::uint512& value);
+
+          //! Records the allocation of a symbolic expression id.
+          TRITON_EXPORT void recordSymbolicExpression(triton::usize id);
+
+          //! Records the removal of a symbolic expression.
+          TRITON_EXPORT void recordSymbolicExpressionRemoved(const triton::engines::symbolic::SharedSymbolicExpression& expr);
+
+          //! Records the previous reference of a memory cell (nullptr if none).
+          TRITON_EXPORT void recordSymbolicMemory(triton::uint64 addr, const triton::engines::symbolic::SharedSymbolicExpression& expr);
+
+          //! Records the previous reference of a register (nullptr if none).
+          TRITON_EXPORT void recordSymbolicRegister(triton::arch::register_e regId, const triton::engines::symbolic::SharedSymbolicExpression& expr);
+
+          //! Records the allocation of a symbolic variable id.
+          TRITON_EXPORT void recordSymbolicVariable(triton::usize id);
+
+          //! Records the previous taint of a memory cell.
+          TRITON_EXPORT void recordTaintedMemory(triton::uint64 addr, bool tainted);
+
+          //! Records the previous taint of a register.
+          TRITON_EXPORT void recordTaintedRegister(triton::arch::register_e regId, bool tainted);
+
+          //! Records the previous value of a symbolic variable.
+          TRITON_EXPORT void recordVariableValue(triton::usize id, const triton::uint512& value);
+      };
+
+    /*! @} End of snapshot namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_JOURNAL_H */
@@ -0,0 +1,77 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_MAPPEDFILE_HPP
+#define TRITON_MAPPEDFILE_HPP
+
+#include <string>
+
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Utils namespace
+  namespace utils {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup utils
+   *  @{
+   */
+
+    /*! \class MappedFile
+     *  \brief A read-only private mapping of a file (`mmap`). The file is unmapped by the destructor.
+     */
+    class MappedFile {
+      private:
+        //! The start of the mapping (page aligned).
+        void* mapping;
+
+        //! The size of the mapping.
+        triton::usize mappingSize;
+
+        //! The mapped bytes of the file.
+        const triton::uint8* data;
+
+        //! The number of mapped bytes of the file.
+        triton::usize size;
+
+      public:
+        /*!
+         * \brief Maps `size` bytes of the file `path` from `offset`.
+         *
+         * \details If `size` is 0, the file is mapped up to its end. Throws triton::exceptions::MappedFile
+         * if the file cannot be mapped, if the range is outside the file or if the platform has no file mapping.
+         */
+        TRITON_EXPORT MappedFile(const std::string& path, triton::uint64 offset=0, triton::usize size=0);
+
+        //! Destructor.
+        TRITON_EXPORT ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        //! Returns the mapped bytes.
+        TRITON_EXPORT const triton::uint8* getData(void) const;
+
+        //! Returns the number of mapped bytes.
+        TRITON_EXPORT triton::usize getSize(void) const;
+    };
+
+  /*! @} End of utils namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_MAPPEDFILE_HPP */
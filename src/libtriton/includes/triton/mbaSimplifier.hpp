@@ -0,0 +1,170 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_MBASIMPLIFIER_H
+#define TRITON_MBASIMPLIFIER_H
+
+#include <unordered_map>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      /*! \class MbaSimplifier
+       *  \brief Simplifies linear mixed boolean-arithmetic (MBA) expressions.
+       *
+       *  \details
+       *  A linear MBA expression is a sum of bitwise expressions multiplied by constants, for example
+       *  `(x ^ y) + 2 * (x & y)`. Such an expression over `t` atoms is fully determined by its values when each
+       *  atom is 0 or 1, because every bit is computed by the same boolean function. The simplifier finds the
+       *  maximal linear MBA subexpressions of an AST over at most MAX_VARIABLES atoms (any subexpression which
+       *  is not linear, like a variable, a product or an extract, is an atom), evaluates each one on the
+       *  `2^t` points at once and rewrites it to the smallest of several normal forms (a constant plus a multiple
+       *  of one boolean function, a sum of boolean functions or a sum of conjunctions). The boolean functions
+       *  are synthesized by an enumeration of the smallest bitwise expressions. A subexpression is rewritten
+       *  only if its normal form is smaller.
+       */
+      class MbaSimplifier {
+        private:
+          //! Kinds of nodes.
+          enum kind_e {
+            KIND_ARITHMETIC, //!< bvadd, bvsub, bvneg, and bvmul or bvshl by a constant
+            KIND_BITWISE,    //!< bvand, bvor, bvxor, bvnot, bvnand, bvnor, bvxnor
+            KIND_CONSTANT,   //!< subexpression without symbolic variable
+            KIND_OTHER,      //!< anything else, always an atom
+          };
+
+          //! Roles of a child in the linear subexpression of its parent.
+          enum role_e {
+            ROLE_REGION,   //!< part of the subexpression
+            ROLE_ATOM,     //!< atom of the subexpression
+            ROLE_CONSTANT, //!< constant of the subexpression
+          };
+
+          //! Information about a node.
+          struct Info {
+            kind_e kind;
+            //! The atoms of the linear subexpression rooted at this node, by order of appearance.
+            std::vector<triton::ast::AbstractNode*> atoms;
+            //! True if the subexpression has more than MAX_VARIABLES atoms.
+            bool overflow;
+          };
+
+          //! A bitwise expression synthesized from a truth table.
+          struct Bitwise {
+            triton::ast::ast_e op;  //!< BVAND_NODE, BVOR_NODE, BVXOR_NODE, BVNOT_NODE, or VARIABLE_NODE for an atom
+            triton::uint32 left;    //!< truth table of the first operand, or index of the atom
+            triton::uint32 right;   //!< truth table of the second operand
+            triton::uint32 cost;    //!< number of nodes
+          };
+
+          //! The enumeration of the bitwise expressions over a number of atoms.
+          struct Synthesis {
+            //! The smallest expression of each truth table found so far.
+            std::unordered_map<triton::uint32, Bitwise> found;
+            //! The truth tables found by cost.
+            std::vector<std::vector<triton::uint32>> levels;
+            //! The number of combinations tried.
+            triton::usize work;
+          };
+
+          //! The enumerations, indexed by number of atoms.
+          std::vector<Synthesis> syntheses;
+
+          //! The information of the visited nodes.
+          std::unordered_map<triton::ast::AbstractNode*, Info> infos;
+
+          //! The atoms of the same hash.
+          std::unordered_map<triton::uint64, std::vector<triton::ast::AbstractNode*>> hashes;
+
+          //! The representative of each atom among the equal ones.
+          std::unordered_map<triton::ast::AbstractNode*, triton::ast::AbstractNode*> canonicals;
+
+          //! The rank of each node from left to right, so that the order of the atoms does not depend on addresses.
+          std::unordered_map<triton::ast::AbstractNode*, triton::usize> ranks;
+
+          //! The simplified nodes.
+          std::unordered_map<triton::ast::AbstractNode*, triton::ast::SharedAbstractNode> results;
+
+          //! Returns the representative of an atom, so that equal atoms are the same variable.
+          triton::ast::AbstractNode* getCanonical(triton::ast::AbstractNode* atom);
+
+          //! Computes the information of a node whose children are already visited.
+          void visit(triton::ast::AbstractNode* node);
+
+          //! Returns the role of a child in the subexpression of its parent of kind `kind`.
+          role_e getRole(triton::ast::AbstractNode* child, kind_e kind) const;
+
+          //! Returns the nodes of the subexpression rooted at `node`, children first.
+          std::vector<triton::ast::AbstractNode*> getRegion(triton::ast::AbstractNode* node) const;
+
+          //! Evaluates the subexpression on all points, the atom `i` is the bit `i` of the point.
+          std::vector<triton::uint512> evaluate(const std::vector<triton::ast::AbstractNode*>& region, const std::vector<triton::ast::AbstractNode*>& atoms) const;
+
+          //! Enumerates the bitwise expressions of the next cost. Returns false if the enumeration is over its budget.
+          bool expand(Synthesis& synthesis, triton::uint32 count);
+
+          //! Returns the smallest bitwise expression of a truth table over the atoms, the bit `p` of the table is its value on the point `p`.
+          triton::ast::SharedAbstractNode synthesize(triton::uint32 table, const std::vector<triton::ast::SharedAbstractNode>& atoms);
+
+          //! Builds an enumerated bitwise expression.
+          triton::ast::SharedAbstractNode build(triton::uint32 table, const Synthesis& synthesis, const std::vector<triton::ast::SharedAbstractNode>& atoms) const;
+
+          //! Returns the normal form of a linear subexpression, or null if it is not smaller.
+          triton::ast::SharedAbstractNode normalize(triton::ast::AbstractNode* node);
+
+          //! Returns the subexpression with its atoms replaced by their simplified form.
+          triton::ast::SharedAbstractNode rebuild(triton::ast::AbstractNode* node);
+
+        public:
+          //! The maximum number of atoms of a linear subexpression.
+          static const triton::uint32 MAX_VARIABLES = 4;
+
+          //! The maximum size of a synthesized bitwise expression.
+          static const triton::uint32 MAX_BITWISE_SIZE = 9;
+
+          //! Constructor.
+          TRITON_EXPORT MbaSimplifier();
+
+          //! Returns the node with its linear MBA subexpressions simplified. The AST is not modified and references are not unrolled.
+          TRITON_EXPORT triton::ast::SharedAbstractNode simplify(const triton::ast::SharedAbstractNode& node);
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_MBASIMPLIFIER_H */
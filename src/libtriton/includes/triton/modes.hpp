@@ -8,8 +8,8 @@
 #ifndef TRITON_MODES_H
 #define TRITON_MODES_H
 
+#include <bitset>
 #include <memory>
-#include <unordered_set>
 
 #include <triton/dllexport.hpp>
 #include <triton/modesEnums.hpp>
@@ -34,26 +34,18 @@ namespace triton {
     //! \class Modes
     /*! \brief The modes class */
     class Modes {
-      private:
-        //! Copies a Modes.
-        void copy(const Modes& other);
-
       protected:
-        //! The set of enabled modes
-        std::unordered_set<triton::modes::mode_e> enabledModes;
+        //! The set of enabled modes. One bit per mode.
+        std::bitset<triton::modes::MODE_LAST_ITEM> enabledModes;
 
       public:
         //! Constructor.
         TRITON_EXPORT Modes();
 
-        //! Constructor.
-        TRITON_EXPORT Modes(const Modes& other);
-
-        //! Copies a Modes.
-        TRITON_EXPORT Modes& operator=(const Modes& other);
-
-        //! Returns true if the mode is enabled.
-        TRITON_EXPORT bool isModeEnabled(triton::modes::mode_e mode) const;
+        //! Returns true if the mode is enabled. `mode` must be lower than triton::modes::MODE_LAST_ITEM.
+        inline bool isModeEnabled(triton::modes::mode_e mode) const {
+          return this->enabledModes[mode];
+        }
 
         //! Enables or disables a specific mode.
         TRITON_EXPORT void setMode(triton::modes::mode_e mode, bool flag);
@@ -36,6 +36,10 @@ namespace triton {
       PC_TRACKING_SYMBOLIC,           //!< [symbolic] Track path constraints only if they are symbolized.
       SYMBOLIZE_INDEX_ROTATION,       //!< [symbolic] Symbolize index rotation for bvrol and bvror (see #751). This mode increases the complexity of solving.
       TAINT_THROUGH_POINTERS,         //!< [taint] Spread the taint if an index pointer is already tainted (see #725).
+      TRIM_SYMBOLIC_EXPRESSIONS,      //!< [symbolic] Regularly forget the ids of the expressions not reachable from the symbolic registers, memory and path constraints.
+
+      /* Must be the last item */
+      MODE_LAST_ITEM                  //!< must be the last item
     };
 
   /*! @} End of modes namespace */
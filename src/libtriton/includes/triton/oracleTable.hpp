@@ -0,0 +1,153 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_ORACLETABLE_H
+#define TRITON_ORACLETABLE_H
+
+#include <array>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Synthesis namespace
+    namespace synthesis {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup synthesis
+     *  @{
+     */
+
+      /*! \class OracleTable
+       *  \brief A table of the smallest expressions over up to three variables, indexed by their I/O behavior.
+       *
+       *  \details
+       *  The expressions are enumerated by increasing size from the variables `x`, `y` and `z` with
+       *  `bvnot`, `bvneg`, `bvadd`, `bvsub`, `bvmul`, `bvand`, `bvor` and `bvxor`, up to a number of
+       *  operations. Only the smallest expression of each behavior on a fixed set of sample points is
+       *  kept. All these operators commute with the truncation, so the outputs are computed once on 64 bits
+       *  and masked to look up an expression of any size. The table can be saved to a file and loaded
+       *  again, which avoids the enumeration.
+       */
+      class OracleTable {
+        public:
+          //! The tokens of the expressions, in postfix order.
+          enum token_e {
+            TOKEN_X = 0,  //!< the first variable
+            TOKEN_Y,      //!< the second variable
+            TOKEN_Z,      //!< the third variable
+            TOKEN_NOT,    //!< bvnot
+            TOKEN_NEG,    //!< bvneg
+            TOKEN_ADD,    //!< bvadd
+            TOKEN_SUB,    //!< bvsub
+            TOKEN_MUL,    //!< bvmul
+            TOKEN_AND,    //!< bvand
+            TOKEN_OR,     //!< bvor
+            TOKEN_XOR,    //!< bvxor
+            TOKEN_LAST,
+          };
+
+          //! An expression of the table.
+          struct Oracle {
+            //! The expression in postfix order.
+            std::vector<token_e> program;
+
+            //! The number of operations.
+            triton::uint32 operations;
+
+            //! The outputs on the sample points, on 64 bits.
+            std::vector<triton::uint64> outputs;
+          };
+
+          //! The number of variables.
+          static const triton::uint32 VARIABLES = 3;
+
+          //! The number of sample points.
+          static const triton::usize SAMPLES = 16;
+
+          //! The default maximum number of operations.
+          static const triton::uint32 DEFAULT_OPERATIONS = 3;
+
+        private:
+          //! The sample points, `samples[i][v]` is the value of the variable `v` on the point `i`.
+          std::vector<std::array<triton::uint64, VARIABLES>> samples;
+
+          //! The expressions, by increasing size.
+          std::vector<Oracle> oracles;
+
+          //! The maximum number of operations.
+          triton::uint32 operations;
+
+          //! The expressions of each behavior by size of bitvector, built on demand.
+          mutable std::unordered_map<triton::uint32, std::unordered_map<triton::uint64, std::vector<triton::usize>>> signatures;
+
+          //! Returns the outputs of an expression on the sample points.
+          std::vector<triton::uint64> run(const std::vector<token_e>& program) const;
+
+          //! Adds an expression and clears the signatures.
+          void add(const std::vector<token_e>& program, triton::uint32 operations, const std::vector<triton::uint64>& outputs);
+
+        public:
+          //! Constructor. The table is empty.
+          TRITON_EXPORT OracleTable();
+
+          //! Enumerates the expressions up to a number of operations.
+          TRITON_EXPORT void build(triton::uint32 operations=DEFAULT_OPERATIONS);
+
+          //! Loads the expressions from a file written by save().
+          TRITON_EXPORT void load(const std::string& path);
+
+          //! Saves the expressions to a file.
+          TRITON_EXPORT void save(const std::string& path) const;
+
+          //! Returns true if the table is empty.
+          TRITON_EXPORT bool isEmpty(void) const;
+
+          //! Returns the number of expressions.
+          TRITON_EXPORT triton::usize getSize(void) const;
+
+          //! Returns the maximum number of operations of the expressions.
+          TRITON_EXPORT triton::uint32 getOperations(void) const;
+
+          //! Returns the sample points.
+          TRITON_EXPORT const std::vector<std::array<triton::uint64, VARIABLES>>& getSamples(void) const;
+
+          //! Returns the expressions whose outputs masked to `size` bits are `outputs`, by increasing size.
+          TRITON_EXPORT std::vector<const Oracle*> lookup(const std::vector<triton::uint64>& outputs, triton::uint32 size) const;
+
+          //! Returns the AST of an expression, `variables` are the nodes of `x`, `y` and `z`.
+          TRITON_EXPORT triton::ast::SharedAbstractNode getAst(const Oracle& oracle, const std::vector<triton::ast::SharedAbstractNode>& variables) const;
+      };
+
+    /*! @} End of synthesis namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_ORACLETABLE_H */
@@ -0,0 +1,498 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_PAGEDMAP_HPP
+#define TRITON_PAGEDMAP_HPP
+
+#include <algorithm>
+#include <bitset>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Utils namespace
+  namespace utils {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup utils
+   *  @{
+   */
+
+    /*! \class CowPageTable
+     *  \brief A copy-on-write table of pages indexed by `key >> PAGE_BITS`.
+     *
+     *  \details
+     *  Copying a table is O(1): both copies share the same pages until one of them
+     *  writes. A write first detaches the page table (if shared) and then the touched
+     *  page (if shared), so only modified pages are duplicated. A table instance must
+     *  not be used concurrently from several threads.
+     */
+    template <typename Page, triton::uint32 PAGE_BITS>
+    class CowPageTable {
+      public:
+        //! The number of entries per page.
+        static const triton::uint64 pageSize = (static_cast<triton::uint64>(1) << PAGE_BITS);
+
+        //! The mask of an entry inside a page.
+        static const triton::uint64 pageMask = pageSize - 1;
+
+      protected:
+        //! Shared page.
+        using SharedPage = std::shared_ptr<Page>;
+
+        //! The page table.
+        using Table = std::unordered_map<triton::uint64, SharedPage>;
+
+        //! The shared page table.
+        std::shared_ptr<Table> table;
+
+        //! Returns the page (read only) or nullptr if not allocated.
+        const Page* getPage(triton::uint64 index) const {
+          if (this->table == nullptr)
+            return nullptr;
+          auto it = this->table->find(index);
+          if (it == this->table->end())
+            return nullptr;
+          return it->second.get();
+        }
+
+        //! Returns a page owned by this instance. The page is allocated if `create` is true, otherwise returns nullptr if not allocated.
+        Page* getWritablePage(triton::uint64 index, bool create) {
+          if (this->table == nullptr) {
+            if (!create)
+              return nullptr;
+            this->table = std::make_shared<Table>();
+          }
+          else if (this->table.use_count() > 1) {
+            if (!create && this->table->find(index) == this->table->end())
+              return nullptr;
+            this->table = std::make_shared<Table>(*this->table);
+          }
+
+          auto it = this->table->find(index);
+          if (it == this->table->end()) {
+            if (!create)
+              return nullptr;
+            it = this->table->emplace(index, std::make_shared<Page>()).first;
+          }
+          else if (it->second.use_count() > 1) {
+            it->second = std::make_shared<Page>(*it->second);
+          }
+
+          return it->second.get();
+        }
+
+        //! Releases a page.
+        void removePage(triton::uint64 index) {
+          if (this->table == nullptr)
+            return;
+          if (this->table.use_count() > 1)
+            this->table = std::make_shared<Table>(*this->table);
+          this->table->erase(index);
+        }
+
+      public:
+        //! Returns the number of allocated pages.
+        triton::usize getNumberOfPages(void) const {
+          return (this->table == nullptr) ? 0 : this->table->size();
+        }
+
+        //! Returns the indexes of allocated pages (`key >> PAGE_BITS`).
+        std::vector<triton::uint64> getPages(void) const {
+          std::vector<triton::uint64> ret;
+          if (this->table != nullptr) {
+            ret.reserve(this->table->size());
+            for (const auto& kv : *this->table)
+              ret.push_back(kv.first);
+          }
+          return ret;
+        }
+
+        //! Clears the table. Shared pages are only released by this instance.
+        void clear(void) {
+          this->table = nullptr;
+        }
+    };
+
+
+    //! A page of a PagedMap.
+    template <typename T, triton::uint32 PAGE_BITS>
+    struct PagedMapPage {
+      //! Defined entries.
+      std::bitset<(1 << PAGE_BITS)> defined;
+
+      //! Values.
+      T values[1 << PAGE_BITS];
+    };
+
+
+    /*! \class PagedMap
+     *  \brief A copy-on-write map from an integer key to a value, stored by pages.
+     *
+     *  \details
+     *  Used for dense keys such as memory addresses or expression ids.
+     */
+    template <typename T, triton::uint32 PAGE_BITS>
+    class PagedMap : public CowPageTable<PagedMapPage<T, PAGE_BITS>, PAGE_BITS> {
+      private:
+        //! The page type.
+        using Page = PagedMapPage<T, PAGE_BITS>;
+
+        //! The base class.
+        using Base = CowPageTable<Page, PAGE_BITS>;
+
+        //! Number of defined entries.
+        triton::usize entries = 0;
+
+      public:
+        //! Returns the value of `key` or nullptr if not defined.
+        const T* get(triton::uint64 key) const {
+          const Page* page = this->getPage(key >> PAGE_BITS);
+          if (page == nullptr || !page->defined[key & Base::pageMask])
+            return nullptr;
+          return &page->values[key & Base::pageMask];
+        }
+
+        //! Returns true if `key` is defined.
+        bool has(triton::uint64 key) const {
+          const Page* page = this->getPage(key >> PAGE_BITS);
+          return page != nullptr && page->defined[key & Base::pageMask];
+        }
+
+        //! Sets the value of `key`.
+        void set(triton::uint64 key, const T& value) {
+          Page* page = this->getWritablePage(key >> PAGE_BITS, true);
+          triton::uint64 offset = key & Base::pageMask;
+          if (!page->defined[offset]) {
+            page->defined[offset] = true;
+            this->entries++;
+          }
+          page->values[offset] = value;
+        }
+
+        //! Undefines `key`.
+        void erase(triton::uint64 key) {
+          if (!this->has(key))
+            return;
+
+          triton::uint64 index = key >> PAGE_BITS;
+          Page* page = this->getWritablePage(index, false);
+          page->defined[key & Base::pageMask] = false;
+          page->values[key & Base::pageMask] = T();
+          this->entries--;
+
+          if (page->defined.none())
+            this->removePage(index);
+        }
+
+        //! Copies the values of the defined entries of [key, key+size) into `out`. Undefined entries are left untouched.
+        void getRange(triton::uint64 key, T* out, triton::usize size) const {
+          while (size) {
+            triton::uint64 offset = key & Base::pageMask;
+            triton::usize  count  = std::min<triton::uint64>(size, Base::pageSize - offset);
+            const Page*    page   = this->getPage(key >> PAGE_BITS);
+
+            if (page != nullptr) {
+              for (triton::usize i = 0; i < count; i++) {
+                if (page->defined[offset + i])
+                  out[i] = page->values[offset + i];
+              }
+            }
+
+            key  += count;
+            out  += count;
+            size -= count;
+          }
+        }
+
+        //! Sets the values of [key, key+size).
+        void setRange(triton::uint64 key, const T* values, triton::usize size) {
+          while (size) {
+            triton::uint64 offset = key & Base::pageMask;
+            triton::usize  count  = std::min<triton::uint64>(size, Base::pageSize - offset);
+            Page*          page   = this->getWritablePage(key >> PAGE_BITS, true);
+
+            for (triton::usize i = 0; i < count; i++) {
+              if (!page->defined[offset + i]) {
+                page->defined[offset + i] = true;
+                this->entries++;
+              }
+              page->values[offset + i] = values[i];
+            }
+
+            key    += count;
+            values += count;
+            size   -= count;
+          }
+        }
+
+        //! Undefines [key, key+size). The pages without defined entries in the range are left untouched.
+        void eraseRange(triton::uint64 key, triton::usize size) {
+          /* A range wider than the allocated pages is erased through the allocated pages */
+          if (size / Base::pageSize > this->getNumberOfPages()) {
+            for (triton::uint64 index : this->getPages()) {
+              triton::uint64 base  = index << PAGE_BITS;
+              const Page*    page  = this->getPage(index);
+              bool           found = false;
+
+              for (triton::uint64 i = 0; !found && i < Base::pageSize; i++)
+                found = page->defined[i] && (base + i - key) < size;
+
+              if (found) {
+                Page* writable = this->getWritablePage(index, false);
+                for (triton::uint64 i = 0; i < Base::pageSize; i++) {
+                  if (writable->defined[i] && (base + i - key) < size) {
+                    writable->defined[i] = false;
+                    writable->values[i] = T();
+                    this->entries--;
+                  }
+                }
+                if (writable->defined.none())
+                  this->removePage(index);
+              }
+            }
+            return;
+          }
+
+          while (size) {
+            triton::uint64 offset = key & Base::pageMask;
+            triton::usize  count  = std::min<triton::uint64>(size, Base::pageSize - offset);
+            triton::uint64 index  = key >> PAGE_BITS;
+            const Page*    shared = this->getPage(index);
+            bool           found  = false;
+
+            /* A shared page is only copied if one of the entries is defined */
+            for (triton::usize i = 0; shared != nullptr && !found && i < count; i++)
+              found = shared->defined[offset + i];
+
+            if (found) {
+              Page* page = this->getWritablePage(index, false);
+              for (triton::usize i = 0; i < count; i++) {
+                if (page->defined[offset + i]) {
+                  page->defined[offset + i] = false;
+                  page->values[offset + i] = T();
+                  this->entries--;
+                }
+              }
+              if (page->defined.none())
+                this->removePage(index);
+            }
+
+            key  += count;
+            size -= count;
+          }
+        }
+
+        //! Undefines the entries for which `f(key, value)` is true and returns their number. Only the pages with such entries are copied.
+        template <typename F>
+        triton::usize eraseIf(F f) {
+          triton::usize count = 0;
+
+          for (triton::uint64 index : this->getPages()) {
+            const Page* page = this->getPage(index);
+            std::bitset<(1 << PAGE_BITS)> matches;
+
+            for (triton::uint64 i = 0; i < Base::pageSize; i++) {
+              if (page->defined[i] && f((index << PAGE_BITS) | i, page->values[i]))
+                matches[i] = true;
+            }
+
+            if (matches.none())
+              continue;
+
+            Page* writable = this->getWritablePage(index, false);
+            for (triton::uint64 i = 0; i < Base::pageSize; i++) {
+              if (matches[i]) {
+                writable->defined[i] = false;
+                writable->values[i] = T();
+              }
+            }
+
+            count += matches.count();
+            this->entries -= matches.count();
+            if (writable->defined.none())
+              this->removePage(index);
+          }
+
+          return count;
+        }
+
+        //! Clears the map.
+        void clear(void) {
+          Base::clear();
+          this->entries = 0;
+        }
+
+        //! Returns the number of defined entries.
+        triton::usize size(void) const {
+          return this->entries;
+        }
+
+        //! Returns true if the map is empty.
+        bool empty(void) const {
+          return this->entries == 0;
+        }
+
+        //! Calls `f(key, value)` on each defined entry. The map must not be modified during the iteration.
+        template <typename F>
+        void forEach(F f) const {
+          if (this->table == nullptr)
+            return;
+          for (const auto& kv : *this->table) {
+            const Page& page = *kv.second;
+            for (triton::uint64 i = 0; i < Base::pageSize; i++) {
+              if (page.defined[i])
+                f((kv.first << PAGE_BITS) | i, page.values[i]);
+            }
+          }
+        }
+    };
+
+
+    //! A page of a PagedSet.
+    template <triton::uint32 PAGE_BITS>
+    struct PagedSetPage {
+      //! Members.
+      std::bitset<(1 << PAGE_BITS)> members;
+    };
+
+
+    /*! \class PagedSet
+     *  \brief A copy-on-write set of integers, stored by pages of bits.
+     */
+    template <triton::uint32 PAGE_BITS>
+    class PagedSet : public CowPageTable<PagedSetPage<PAGE_BITS>, PAGE_BITS> {
+      private:
+        //! The page type.
+        using Page = PagedSetPage<PAGE_BITS>;
+
+        //! The base class.
+        using Base = CowPageTable<Page, PAGE_BITS>;
+
+        //! Number of members.
+        triton::usize entries = 0;
+
+      public:
+        //! Returns true if `key` is a member of the set.
+        bool has(triton::uint64 key) const {
+          const Page* page = this->getPage(key >> PAGE_BITS);
+          return page != nullptr && page->members[key & Base::pageMask];
+        }
+
+        //! Inserts `key`.
+        void insert(triton::uint64 key) {
+          if (this->has(key))
+            return;
+          Page* page = this->getWritablePage(key >> PAGE_BITS, true);
+          page->members[key & Base::pageMask] = true;
+          this->entries++;
+        }
+
+        //! Removes `key`.
+        void erase(triton::uint64 key) {
+          if (!this->has(key))
+            return;
+
+          triton::uint64 index = key >> PAGE_BITS;
+          Page* page = this->getWritablePage(index, false);
+          page->members[key & Base::pageMask] = false;
+          this->entries--;
+
+          if (page->members.none())
+            this->removePage(index);
+        }
+
+        //! Inserts [key, key+size).
+        void insertRange(triton::uint64 key, triton::usize size) {
+          while (size) {
+            triton::uint64 offset = key & Base::pageMask;
+            triton::usize  count  = std::min<triton::uint64>(size, Base::pageSize - offset);
+            Page*          page   = this->getWritablePage(key >> PAGE_BITS, true);
+
+            for (triton::usize i = 0; i < count; i++) {
+              if (!page->members[offset + i]) {
+                page->members[offset + i] = true;
+                this->entries++;
+              }
+            }
+
+            key  += count;
+            size -= count;
+          }
+        }
+
+        //! Removes [key, key+size).
+        void eraseRange(triton::uint64 key, triton::usize size) {
+          while (size) {
+            triton::uint64 offset = key & Base::pageMask;
+            triton::usize  count  = std::min<triton::uint64>(size, Base::pageSize - offset);
+            triton::uint64 index  = key >> PAGE_BITS;
+
+            if (this->getPage(index) != nullptr) {
+              Page* page = this->getWritablePage(index, false);
+              for (triton::usize i = 0; i < count; i++) {
+                if (page->members[offset + i]) {
+                  page->members[offset + i] = false;
+                  this->entries--;
+                }
+              }
+              if (page->members.none())
+                this->removePage(index);
+            }
+
+            key  += count;
+            size -= count;
+          }
+        }
+
+        //! Clears the set.
+        void clear(void) {
+          Base::clear();
+          this->entries = 0;
+        }
+
+        //! Returns the number of members.
+        triton::usize size(void) const {
+          return this->entries;
+        }
+
+        //! Returns true if the set is empty.
+        bool empty(void) const {
+          return this->entries == 0;
+        }
+
+        //! Calls `f(key)` on each member. The set must not be modified during the iteration.
+        template <typename F>
+        void forEach(F f) const {
+          if (this->table == nullptr)
+            return;
+          for (const auto& kv : *this->table) {
+            for (triton::uint64 i = 0; i < Base::pageSize; i++) {
+              if (kv.second->members[i])
+                f((kv.first << PAGE_BITS) | i);
+            }
+          }
+        }
+    };
+
+  /*! @} End of utils namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_PAGEDMAP_HPP */
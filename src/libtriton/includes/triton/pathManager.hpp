@@ -8,6 +8,7 @@
 #ifndef TRITON_PATHMANAGER_H
 #define TRITON_PATHMANAGER_H
 
+#include <memory>
 #include <vector>
 
 #include <triton/dllexport.hpp>
@@ -53,8 +54,11 @@ namespace triton {
           triton::ast::SharedAstContext astCtxt;
 
         protected:
-          //! \brief The logical conjunction vector of path constraints.
-          std::vector<triton::engines::symbolic::PathConstraint> pathConstraints;
+          //! \brief The logical conjunction vector of path constraints. Shared between copies until one of them is modified.
+          std::shared_ptr<std::vector<triton::engines::symbolic::PathConstraint>> pathConstraints;
+
+          //! Returns the path constraints owned by this instance (copy-on-write).
+          std::vector<triton::engines::symbolic::PathConstraint>& getWritablePathConstraints(void);
 
         public:
           //! Constructor.
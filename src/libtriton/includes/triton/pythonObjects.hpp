@@ -16,6 +16,7 @@
 #include <triton/bitsVector.hpp>
 #include <triton/immediate.hpp>
 #include <triton/instruction.hpp>
+#include <triton/jitEvaluator.hpp>
 #include <triton/memoryAccess.hpp>
 #include <triton/pathConstraint.hpp>
 #include <triton/register.hpp>
@@ -71,6 +72,9 @@ namespace triton {
       //! Creates the Instruction python class.
       PyObject* PyInstruction(triton::uint64 addr, const triton::uint8* opcodes, triton::uint32 opSize);
 
+      //! Creates the JitFunction python class.
+      PyObject* PyJitFunction(const triton::ast::SharedAbstractNode& node);
+
       //! Creates the Memory python class.
       PyObject* PyMemoryAccess(const triton::arch::MemoryAccess& mem);
 
@@ -145,6 +149,17 @@ namespace triton {
       //! pyInstruction type.
       extern PyTypeObject Instruction_Type;
 
+      /* JitFunction ==================================================== */
+
+      //! pyJitFunction object.
+      typedef struct {
+        PyObject_HEAD
+        triton::ast::JitEvaluator* jit; //! Pointer to the cpp jit evaluator
+      } JitFunction_Object;
+
+      //! pyJitFunction type.
+      extern PyTypeObject JitFunction_Type;
+
       /* MemoryAccess =================================================== */
 
       //! pyMemory object.
@@ -264,6 +279,12 @@ namespace triton {
 /*! Returns the triton::arch::Instruction. */
 #define PyInstruction_AsInstruction(v) (((triton::bindings::python::Instruction_Object*)(v))->inst)
 
+/*! Checks if the pyObject is a triton::ast::JitEvaluator. */
+#define PyJitFunction_Check(v) ((v)->ob_type == &triton::bindings::python::JitFunction_Type)
+
+/*! Returns the triton::ast::JitEvaluator. */
+#define PyJitFunction_AsJitEvaluator(v) (((triton::bindings::python::JitFunction_Object*)(v))->jit)
+
 /*! Checks if the pyObject is a triton::arch::MemoryAccess. */
 #define PyMemoryAccess_Check(v) ((v)->ob_type == &triton::bindings::python::MemoryAccess_Type)
 
@@ -81,6 +81,53 @@ namespace triton {
       //! Returns a pyObject from a triton::uint512.
       PyObject* PyLong_FromUint512(triton::uint512 value);
 
+      /*! \class PyAllowThreads
+       *  \brief Releases the GIL for the lifetime of the object (RAII).
+       *
+       *  \details
+       *  Used around long-running native calls (solver queries, simplifications,
+       *  instruction processing). No Python object may be touched while the GIL
+       *  is released, except through a PyGilEnsure (e.g. in callbacks).
+       */
+      class PyAllowThreads {
+        private:
+          //! The saved thread state.
+          PyThreadState* state;
+
+        public:
+          //! Constructor. Releases the GIL.
+          PyAllowThreads() : state(PyEval_SaveThread()) {}
+
+          //! Destructor. Re-acquires the GIL.
+          ~PyAllowThreads() { PyEval_RestoreThread(this->state); }
+
+          PyAllowThreads(const PyAllowThreads&) = delete;
+          PyAllowThreads& operator=(const PyAllowThreads&) = delete;
+      };
+
+      /*! \class PyGilEnsure
+       *  \brief Acquires the GIL for the lifetime of the object (RAII).
+       *
+       *  \details
+       *  Used by Python callbacks which may be fired from a native call running
+       *  without the GIL. Works whether or not the GIL is already held.
+       */
+      class PyGilEnsure {
+        private:
+          //! The previous GIL state.
+          PyGILState_STATE state;
+
+        public:
+          //! Constructor. Acquires the GIL.
+          PyGilEnsure() : state(PyGILState_Ensure()) {}
+
+          //! Destructor. Restores the previous GIL state.
+          ~PyGilEnsure() { PyGILState_Release(this->state); }
+
+          PyGilEnsure(const PyGilEnsure&) = delete;
+          PyGilEnsure& operator=(const PyGilEnsure&) = delete;
+      };
+
     /*! @} End of python namespace */
     };
   /*! @} End of bindings namespace */
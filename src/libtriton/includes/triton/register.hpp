@@ -40,12 +40,13 @@ namespace triton {
 
     /*! \class Register
      *  \brief This class is used when an instruction has a register operand.
+     *
+     *  \details
+     *  A Register is a lightweight and trivially copyable handle. Its name is not stored
+     *  but looked up from a static table generated from the CPU specifications (`*.spec`).
      */
     class Register : public BitsVector, public arm::ArmOperandProperties {
       protected:
-        //! The name of the register.
-        std::string name;
-
         //! The id of the register.
         triton::arch::register_e id;
 
@@ -55,23 +56,16 @@ namespace triton {
         //! True if the register is mutable. For example XZR in AArch64 is immutable.
         bool vmutable;
 
-      private:
-        //! Copy a Register.
-        void copy(const Register& other);
-
       public:
         //! Constructor.
         TRITON_EXPORT Register();
 
         //! Constructor.
-        TRITON_EXPORT Register(triton::arch::register_e regId, std::string name, triton::arch::register_e parent, triton::uint32 high, triton::uint32 low, bool vmutable);
+        TRITON_EXPORT Register(triton::arch::register_e regId, triton::arch::register_e parent, triton::uint32 high, triton::uint32 low, bool vmutable);
 
         //! Constructor.
         TRITON_EXPORT Register(const triton::arch::CpuInterface&, triton::arch::register_e regId);
 
-        //! Constructor.
-        TRITON_EXPORT Register(const Register& other);
-
         //! Returns the parent id of the register.
         TRITON_EXPORT triton::arch::register_e getParent(void) const;
 
@@ -101,9 +95,6 @@ namespace triton {
 
         //! Compare two registers specifications
         TRITON_EXPORT bool operator!=(const Register& other) const;
-
-        //! Copies a Register.
-        TRITON_EXPORT Register& operator=(const Register& other);
     };
 
     //! Displays a Register.
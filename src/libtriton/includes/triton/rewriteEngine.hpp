@@ -0,0 +1,194 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_REWRITEENGINE_H
+#define TRITON_REWRITEENGINE_H
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/astEnums.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      class EGraph;
+
+      /*! \class RewriteEngine
+       *  \brief Rewrites ASTs with declarative rules.
+       *
+       *  \details
+       *  A rule is written `lhs -> rhs` where both sides are SMT-like terms, for example `(bvxor x x) -> 0`.
+       *  A term is an operator applied to terms, a variable (an identifier) or an integer literal. Literals
+       *  are decimal or hexadecimal, possibly negative, and take the size of the node they are compared to
+       *  (`-1` is a bitvector of ones). A variable appearing several times in the left-hand side matches
+       *  equal subtrees. Supported operators are the bitvector operators whose operands have the size of the
+       *  node (bvadd, bvand, bvashr, bvlshr, bvmul, bvnand, bvneg, bvnor, bvnot, bvor, bvsdiv, bvshl, bvsmod,
+       *  bvsrem, bvsub, bvudiv, bvurem, bvxnor and bvxor). Text after `;` is a comment.
+       *
+       *  The left-hand sides are compiled into a discrimination tree walked in preorder, so a node is matched
+       *  against all the rules at once. The tree is built by the first rewrite() following new rules, the
+       *  equality saturation (triton::engines::symbolic::EGraph) only uses the parsed rules. The variants of commutative operators are compiled as well. When
+       *  several rules match, the first added one is applied. ASTs are rewritten bottom-up, once per node of
+       *  the DAG, and the nodes built by a rule are rewritten again until no rule applies.
+       */
+      class RewriteEngine {
+        friend class EGraph;
+
+        private:
+          //! Kinds of terms.
+          enum term_e {
+            TERM_OPERATOR, //!< operator applied to terms
+            TERM_VARIABLE, //!< pattern variable
+            TERM_LITERAL,  //!< integer literal
+          };
+
+          //! A term of a rule. Children are indexes in `terms`.
+          struct Term {
+            term_e kind;
+            triton::ast::ast_e op;
+            triton::usize index; //!< variable id or literal index
+            std::vector<triton::usize> children;
+          };
+
+          //! A symbol of the preorder form of a left-hand side.
+          struct Symbol {
+            term_e kind;
+            triton::ast::ast_e op;
+            triton::usize index;
+          };
+
+          //! A rule.
+          struct Rule {
+            std::string text;
+            triton::usize lhs;
+            triton::usize rhs;
+            triton::usize variables;
+          };
+
+          //! A state of the discrimination tree. Edges are indexes in `states`, 0 means none.
+          struct State {
+            State() : wildcard(0) {}
+            std::map<triton::ast::ast_e, triton::usize> operators;
+            std::vector<std::pair<triton::usize, triton::usize>> literals;
+            triton::usize wildcard;
+            //! Accepted rules with the variable bound by each wildcard of the path.
+            std::vector<std::pair<triton::usize, std::vector<triton::usize>>> accept;
+          };
+
+          //! The best match found so far.
+          struct Match {
+            triton::usize rule;
+            std::vector<triton::ast::SharedAbstractNode> bindings;
+          };
+
+          //! The terms of all rules.
+          std::vector<Term> terms;
+
+          //! The literals as (magnitude, negative).
+          std::vector<std::pair<triton::uint512, bool>> literals;
+
+          //! The rules in the order they were added.
+          std::vector<Rule> rules;
+
+          //! The discrimination tree. The state 0 is the root.
+          mutable std::vector<State> states;
+
+          //! The number of rules compiled into the discrimination tree.
+          mutable triton::usize compiled;
+
+          //! Returns true if the kind of node is an operator of the rules.
+          static bool isOperator(triton::ast::ast_e kind);
+
+          //! Returns true if the operator is commutative.
+          static bool isCommutative(triton::ast::ast_e kind);
+
+          //! Builds a node of an operator of the rules.
+          static triton::ast::SharedAbstractNode buildNode(const triton::ast::SharedAstContext& ctxt, triton::ast::ast_e op, const std::vector<triton::ast::SharedAbstractNode>& children);
+
+          //! Parses a term from the tokens. Variables are numbered in `names`.
+          triton::usize parseTerm(const std::vector<std::string>& tokens, triton::usize& pos, std::vector<std::string>& names, bool lhs);
+
+          //! Returns the preorder forms of a term, with the variants of commutative operators.
+          std::vector<std::vector<Symbol>> expand(triton::usize term) const;
+
+          //! Adds a preorder form to the discrimination tree.
+          void compile(const std::vector<Symbol>& symbols, triton::usize rule) const;
+
+          //! Adds the rules which are not compiled yet to the discrimination tree.
+          void prepare(void) const;
+
+          //! Returns the value of a literal for a size.
+          triton::uint512 getLiteral(triton::usize index, triton::uint32 size) const;
+
+          //! Walks the discrimination tree and keeps the first rule matching.
+          void match(triton::usize state, std::vector<triton::ast::AbstractNode*>& pending, std::vector<triton::ast::AbstractNode*>& wildcards, Match& best) const;
+
+          //! Builds the right-hand side of a rule.
+          triton::ast::SharedAbstractNode instantiate(triton::usize term, const Match& match, triton::uint32 size, const triton::ast::SharedAstContext& ctxt, triton::usize& budget) const;
+
+          //! Applies the rules on a node whose children are already rewritten.
+          triton::ast::SharedAbstractNode rewriteNode(const triton::ast::SharedAbstractNode& node, triton::usize& budget) const;
+
+        public:
+          //! The maximum number of rules applied per node of an AST.
+          static const triton::usize REWRITE_LIMIT = 64;
+
+          //! Constructor.
+          TRITON_EXPORT RewriteEngine();
+
+          //! Parses and adds rules. Throws triton::exceptions::SymbolicSimplification if the text is invalid.
+          TRITON_EXPORT void addRules(const std::string& text);
+
+          //! Removes all rules.
+          TRITON_EXPORT void clearRules(void);
+
+          //! Returns the rules in the order they were added.
+          TRITON_EXPORT std::vector<std::string> getRules(void) const;
+
+          //! Returns true if there is no rule.
+          TRITON_EXPORT bool isEmpty(void) const;
+
+          //! Returns the node rewritten with the rules. The AST is not modified.
+          TRITON_EXPORT triton::ast::SharedAbstractNode rewrite(const triton::ast::SharedAbstractNode& node) const;
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_REWRITEENGINE_H */
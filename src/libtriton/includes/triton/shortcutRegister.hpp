@@ -77,7 +77,6 @@ namespace triton {
             case triton::arch::ARCH_AARCH64: {
               #define REG_SPEC(UPPER_NAME, LOWER_NAME, AARCH64_UPPER, AARCH64_LOWER, AARCH64_PARENT, MUTABLE)    \
               this->aarch64_##LOWER_NAME = triton::arch::Register(triton::arch::ID_REG_AARCH64_##UPPER_NAME,     \
-                                                                  #LOWER_NAME,                                   \
                                                                   triton::arch::ID_REG_AARCH64_##AARCH64_PARENT, \
                                                                   AARCH64_UPPER,                                 \
                                                                   AARCH64_LOWER,                                 \
@@ -90,7 +89,6 @@ namespace triton {
             case triton::arch::ARCH_ARM32: {
               #define REG_SPEC(UPPER_NAME, LOWER_NAME, ARM32_UPPER, ARM32_LOWER, ARM32_PARENT, MUTABLE)    \
               this->arm32_##LOWER_NAME = triton::arch::Register(triton::arch::ID_REG_ARM32_##UPPER_NAME,   \
-                                                                #LOWER_NAME,                               \
                                                                 triton::arch::ID_REG_ARM32_##ARM32_PARENT, \
                                                                 ARM32_UPPER,                               \
                                                                 ARM32_LOWER,                               \
@@ -104,7 +102,6 @@ namespace triton {
               #define REG_SPEC(UPPER_NAME, LOWER_NAME, _1, _2, _3, X86_UPPER, X86_LOWER, X86_PARENT, X86_AVAIL) \
               if (X86_AVAIL)                                                                                    \
                 this->x86_##LOWER_NAME = triton::arch::Register(triton::arch::ID_REG_X86_##UPPER_NAME,          \
-                                                                #LOWER_NAME,                                    \
                                                                 triton::arch::ID_REG_X86_##X86_PARENT,          \
                                                                 X86_UPPER,                                      \
                                                                 X86_LOWER,                                      \
@@ -117,7 +114,6 @@ namespace triton {
             case triton::arch::ARCH_X86_64: {
               #define REG_SPEC(UPPER_NAME, LOWER_NAME, X86_64_UPPER, X86_64_LOWER, X86_64_PARENT, X86_UPPER, X86_LOWER, X86_PARENT, X86_AVAIL)  \
               this->x86_##LOWER_NAME = triton::arch::Register(triton::arch::ID_REG_X86_##UPPER_NAME,                                            \
-                                                              #LOWER_NAME,                                                                      \
                                                               triton::arch::ID_REG_X86_##X86_64_PARENT,                                         \
                                                               X86_64_UPPER,                                                                     \
                                                               X86_64_LOWER,                                                                     \
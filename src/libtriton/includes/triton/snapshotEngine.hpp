@@ -0,0 +1,174 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_SNAPSHOTENGINE_H
+#define TRITON_SNAPSHOTENGINE_H
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <triton/architecture.hpp>
+#include <triton/astContext.hpp>
+#include <triton/cpuInterface.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/journal.hpp>
+#include <triton/pathManager.hpp>
+#include <triton/symbolicEngine.hpp>
+#include <triton/taintEngine.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Snapshot namespace
+    namespace snapshot {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup snapshot
+     *  @{
+     */
+
+      /*! \class Snapshot
+       *  \brief The state of the CPU, the symbolic engine, the taint engine and the AST context at a given time.
+       *
+       *  \details
+       *  Memories, expressions and taint are copy-on-write, thus taking or restoring
+       *  a snapshot only copies the registers state, the page tables and the values
+       *  of the variables. The AST nodes and the symbolic expressions are shared with
+       *  the current state: a change made in place to an existing expression (e.g.
+       *  SymbolicExpression::setAst() or setComment()) is not reverted by a restore.
+       */
+      class Snapshot {
+        private:
+          //! The architecture of the CPU state.
+          triton::arch::architecture_e arch;
+
+          //! The CPU state.
+          std::unique_ptr<triton::arch::CpuInterface> cpu;
+
+          //! The symbolic engine state.
+          triton::engines::symbolic::SymbolicEngine symbolic;
+
+          //! The taint engine state.
+          triton::engines::taint::TaintEngine taint;
+
+          //! The variables of the AST context and their values.
+          std::unordered_map<std::string, std::pair<triton::ast::WeakAbstractNode, triton::uint512>> variables;
+
+        public:
+          //! Constructor. Saves the current state.
+          TRITON_EXPORT Snapshot(triton::arch::Architecture& arch,
+                                 const triton::engines::symbolic::SymbolicEngine& symbolic,
+                                 const triton::engines::taint::TaintEngine& taint,
+                                 const triton::ast::AstContext& astCtxt);
+
+          //! Restores the saved state. The snapshot remains valid.
+          TRITON_EXPORT void restore(triton::arch::Architecture& arch,
+                                     triton::engines::symbolic::SymbolicEngine& symbolic,
+                                     triton::engines::taint::TaintEngine& taint,
+                                     triton::ast::AstContext& astCtxt) const;
+      };
+
+
+      /*! \class SnapshotEngine
+       *  \brief The snapshot engine class.
+       *
+       *  \details
+       *  Snapshots are full (copy-on-write) copies of the state identified by a unique id. Checkpoints
+       *  are lighter: while at least one checkpoint exists, changes are recorded into an undo journal
+       *  and a rollback reverts the entries recorded since the checkpoint.
+       */
+      class SnapshotEngine {
+        private:
+          //! Architecture API
+          triton::arch::Architecture* architecture;
+
+          //! Symbolic Engine API
+          triton::engines::symbolic::SymbolicEngine* symbolicEngine;
+
+          //! Taint Engine API
+          triton::engines::taint::TaintEngine* taintEngine;
+
+          //! Journal API
+          triton::engines::snapshot::Journal* journal;
+
+          //! AST Context API
+          triton::ast::SharedAstContext astCtxt;
+
+          //! The next snapshot id.
+          triton::usize uniqueSnapshotId;
+
+          //! Snapshots by id.
+          std::unordered_map<triton::usize, std::unique_ptr<Snapshot>> snapshots;
+
+          //! Checkpoints, indexed by id: the journal size and the path constraints (copy-on-write) at the checkpoint.
+          std::vector<std::pair<triton::usize, triton::engines::symbolic::PathManager>> checkpoints;
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT SnapshotEngine(triton::arch::Architecture* architecture,
+                                       triton::engines::symbolic::SymbolicEngine* symbolicEngine,
+                                       triton::engines::taint::TaintEngine* taintEngine,
+                                       const triton::ast::SharedAstContext& astCtxt,
+                                       triton::engines::snapshot::Journal* journal);
+
+          //! Takes a snapshot of the current state and returns its id.
+          TRITON_EXPORT triton::usize takeSnapshot(void);
+
+          //! Restores the state of a snapshot. The snapshot can be restored again later. Checkpoints are discarded.
+          TRITON_EXPORT void restoreSnapshot(triton::usize id);
+
+          //! Removes a snapshot.
+          TRITON_EXPORT void removeSnapshot(triton::usize id);
+
+          //! Returns true if the snapshot exists.
+          TRITON_EXPORT bool isSnapshot(triton::usize id) const;
+
+          //! Returns the number of snapshots.
+          TRITON_EXPORT triton::usize getNumberOfSnapshots(void) const;
+
+          //! Starts recording changes (if not already) and returns a checkpoint id.
+          TRITON_EXPORT triton::usize checkpoint(void);
+
+          //! Reverts all changes made since the checkpoint. The checkpoint remains valid, the next ones are discarded.
+          TRITON_EXPORT void rollback(triton::usize id);
+
+          //! Discards all checkpoints and stops recording changes.
+          TRITON_EXPORT void clearCheckpoints(void);
+
+          //! Returns the number of checkpoints.
+          TRITON_EXPORT triton::usize getNumberOfCheckpoints(void) const;
+
+          //! Removes all snapshots and checkpoints.
+          TRITON_EXPORT void clear(void);
+      };
+
+    /*! @} End of snapshot namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SNAPSHOTENGINE_H */
@@ -8,7 +8,8 @@
 #ifndef TRITON_SYMBOLICENGINE_H
 #define TRITON_SYMBOLICENGINE_H
 
-#include <map>
+#include <array>
+#include <functional>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -19,8 +20,10 @@
 #include <triton/ast.hpp>
 #include <triton/callbacks.hpp>
 #include <triton/dllexport.hpp>
+#include <triton/journal.hpp>
 #include <triton/memoryAccess.hpp>
 #include <triton/modes.hpp>
+#include <triton/pagedMap.hpp>
 #include <triton/pathManager.hpp>
 #include <triton/register.hpp>
 #include <triton/symbolicEnums.hpp>
@@ -73,37 +76,43 @@ namespace triton {
           //! Symbolic variables id.
           triton::usize uniqueSymVarId;
 
-          /*! \brief The map of symbolic variables
+          //! Size of symbolicExpressions above which expired (or unreachable with TRIM_SYMBOLIC_EXPRESSIONS) entries are removed.
+          triton::usize symbolicExpressionsLimit;
+
+          /*! \brief The copy-on-write map of symbolic variables
            *
            * \details
            * **item1**: variable id<br>
            * **item2**: symbolic variable
            */
-          mutable std::unordered_map<triton::usize, WeakSymbolicVariable> symbolicVariables;
+          mutable triton::utils::PagedMap<WeakSymbolicVariable, 6> symbolicVariables;
 
-          /*! \brief The map of symbolic expressions
+          /*! \brief The copy-on-write map of symbolic expressions
            *
            * \details
            * **item1**: symbolic reference id<br>
            * **item2**: symbolic expression
            */
-          mutable std::unordered_map<triton::usize, WeakSymbolicExpression> symbolicExpressions;
+          mutable triton::utils::PagedMap<WeakSymbolicExpression, 8> symbolicExpressions;
 
-          /*! \brief map of <address:size> -> symbolic expression.
+          /*! \brief copy-on-write maps of address -> aligned symbolic expression, one per size.
            *
            * \details
-           * **item1**: <addr:size><br>
+           * The map `i` holds the entries of `1 << i` bytes (byte to dqqword) indexed by their first
+           * address. Thus, the entries overlapping a write are in a range of each map.
+           *
+           * **item1**: memory address<br>
            * **item2**: shared symbolic expression
            */
-          std::map<std::pair<triton::uint64, triton::uint32>, SharedSymbolicExpression> alignedMemoryReference;
+          std::array<triton::utils::PagedMap<SharedSymbolicExpression, 6>, 7> alignedMemoryReference;
 
-          /*! \brief map of address -> symbolic expression
+          /*! \brief copy-on-write map of address -> symbolic expression
            *
            * \details
            * **item1**: memory address<br>
            * **item2**: shared symbolic expression
            */
-          std::unordered_map<triton::uint64, SharedSymbolicExpression> memoryReference;
+          triton::utils::PagedMap<SharedSymbolicExpression, 6> memoryReference;
 
           //! Symbolic register state.
           std::vector<SharedSymbolicExpression> symbolicReg;
@@ -118,26 +127,40 @@ namespace triton {
           //! Callbacks API
           triton::callbacks::Callbacks* callbacks;
 
+          //! Journal API
+          triton::engines::snapshot::Journal* journal;
+
           //! Modes API.
           triton::modes::SharedModes modes;
 
+          //! Returns true if the changes must be recorded into the journal.
+          inline bool isJournaling(void) const {
+            return (this->journal != nullptr && this->journal->isEnabled());
+          }
+
           //! Returns an unique symbolic expression id.
           triton::usize getUniqueSymExprId(void);
 
           //! Returns an unique symbolic variable id.
           triton::usize getUniqueSymVarId(void);
 
-          //! Gets an aligned entry.
-          const SharedSymbolicExpression& getAlignedMemory(triton::uint64 address, triton::uint32 size);
+          //! Returns the index of `size` in alignedMemoryReference or alignedMemoryReference.size() if it is not a supported size.
+          triton::uint32 getAlignedIndex(triton::uint32 size) const;
+
+          //! Gets an aligned entry or nullptr if not recorded.
+          const SharedSymbolicExpression* getAlignedMemory(triton::uint64 address, triton::uint32 size) const;
 
           //! Adds an aligned entry.
           void addAlignedMemory(triton::uint64 address, triton::uint32 size, const SharedSymbolicExpression& expr);
 
           //! Checks if the aligned memory is recored.
-          bool isAlignedMemory(triton::uint64 address, triton::uint32 size);
+          bool isAlignedMemory(triton::uint64 address, triton::uint32 size) const;
+
+          //! Removes the aligned entries which overlap [address, address+size).
+          void removeAlignedMemory(triton::uint64 address, triton::usize size);
 
-          //! Removes an aligned entry.
-          void removeAlignedMemory(triton::uint64 address, triton::uint32 size);
+          //! Returns true if no memory cell has a symbolic reference.
+          bool isMemoryConcrete(void) const;
 
           //! Adds a symbolic memory reference.
           inline void addMemoryReference(triton::uint64 mem, const SharedSymbolicExpression& expr);
@@ -156,7 +179,8 @@ namespace triton {
           TRITON_EXPORT SymbolicEngine(triton::arch::Architecture* architecture,
                                        const triton::modes::SharedModes& modes,
                                        const triton::ast::SharedAstContext& astCtxt,
-                                       triton::callbacks::Callbacks* callbacks=nullptr);
+                                       triton::callbacks::Callbacks* callbacks=nullptr,
+                                       triton::engines::snapshot::Journal* journal=nullptr);
 
           //! Constructor by copy.
           TRITON_EXPORT SymbolicEngine(const SymbolicEngine& other);
@@ -188,8 +212,11 @@ namespace triton {
           //! Returns the shared symbolic expression corresponding to the memory address.
           TRITON_EXPORT SharedSymbolicExpression getSymbolicMemory(triton::uint64 addr) const;
 
-          //! Returns the map (addr:expr) of all symbolic memory defined.
-          TRITON_EXPORT const std::unordered_map<triton::uint64, SharedSymbolicExpression>& getSymbolicMemory(void) const;
+          //! Returns the map (addr:expr) of all symbolic memory defined. The map is built on each call, see forEachSymbolicMemory().
+          TRITON_EXPORT std::unordered_map<triton::uint64, SharedSymbolicExpression> getSymbolicMemory(void) const;
+
+          //! Calls `f(addr, expr)` on each symbolic memory byte defined, without building a map.
+          TRITON_EXPORT void forEachSymbolicMemory(const std::function<void(triton::uint64, const SharedSymbolicExpression&)>& f) const;
 
           //! Returns the shared symbolic expression corresponding to the parent register.
           TRITON_EXPORT const SharedSymbolicExpression& getSymbolicRegister(const triton::arch::Register& reg) const;
@@ -257,6 +284,9 @@ namespace triton {
           //! Slices all expressions from a given one.
           TRITON_EXPORT std::unordered_map<triton::usize, SharedSymbolicExpression> sliceExpressions(const SharedSymbolicExpression& expr);
 
+          //! Slices all expressions from several ones, the union of their slices.
+          TRITON_EXPORT std::unordered_map<triton::usize, SharedSymbolicExpression> sliceExpressions(const std::vector<SharedSymbolicExpression>& exprs);
+
           //! Prints symbolic expression with used references and symbolic variables in AST representation mode. If `assert_` is true, then (assert <expr>).
           TRITON_EXPORT std::ostream& printSlicedExpressions(std::ostream& stream, const SharedSymbolicExpression& expr, bool assert_=false);
 
@@ -269,6 +299,12 @@ namespace triton {
           //! Returns all symbolic variables.
           TRITON_EXPORT std::unordered_map<triton::usize, SharedSymbolicVariable> getSymbolicVariables(void) const;
 
+          //! Removes the expressions which do not exist anymore from the map of ids and returns their number. If `force` is false, only when the map has grown enough since the last compaction.
+          TRITON_EXPORT triton::usize compactSymbolicExpressions(bool force=true);
+
+          //! Removes the expressions which are not reachable from the symbolic registers, memory and path constraints from the map of ids and returns their number. If `force` is false, only when the map has grown enough since the last compaction.
+          TRITON_EXPORT triton::usize trimSymbolicExpressions(bool force=true);
+
           //! Converts a symbolic expression to a symbolic variable. `symVarSize` must be in bits.
           TRITON_EXPORT SharedSymbolicVariable symbolizeExpression(triton::usize exprId, triton::uint32 symVarSize, const std::string& symVarAlias="");
 
@@ -290,6 +326,9 @@ namespace triton {
           //! Concretizes a specific symbolic memory reference.
           TRITON_EXPORT void concretizeMemory(triton::uint64 addr);
 
+          //! Concretizes the symbolic memory references of [baseAddr, baseAddr+size).
+          TRITON_EXPORT void concretizeMemory(triton::uint64 baseAddr, triton::usize size);
+
           //! Concretizes a specific symbolic register reference.
           TRITON_EXPORT void concretizeRegister(const triton::arch::Register& reg);
 
@@ -319,6 +358,9 @@ namespace triton {
 
           //! Sets the concrete value of a symbolic variable.
           TRITON_EXPORT void setConcreteVariableValue(const SharedSymbolicVariable& symVar, const triton::uint512& value);
+
+          //! Reverts a symbolic journal entry. The change is not journaled.
+          TRITON_EXPORT void undo(const triton::engines::snapshot::JournalEntry& entry);
       };
 
     /*! @} End of symbolic namespace */
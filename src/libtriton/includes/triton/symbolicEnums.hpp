@@ -36,6 +36,12 @@ namespace triton {
      *  @{
      */
 
+      //! Cost functions used to extract an AST from an e-graph.
+      enum cost_e {
+        SIZE_COST,             //!< Number of nodes.
+        SOLVER_COST,           //!< Number of nodes weighted by their cost for a solver (non-linear operators are expensive).
+      };
+
       //! Type of symbolic expressions.
       enum expression_e {
         MEMORY_EXPRESSION,     //!< Assigned to a memory expression.
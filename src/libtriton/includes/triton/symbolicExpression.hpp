@@ -10,6 +10,7 @@
 
 #include <string>
 #include <memory>
+#include <vector>
 
 #include <triton/ast.hpp>
 #include <triton/dllexport.hpp>
@@ -66,6 +67,12 @@ namespace triton {
           //! The origin register if `kind` is equal to `triton::engines::symbolic::REG`, `REG_INVALID` otherwise.
           triton::arch::Register originRegister;
 
+          //! The expressions referenced by the AST, sorted by id. Computed on demand and cleared by setAst().
+          mutable std::vector<std::shared_ptr<SymbolicExpression>> dependencies;
+
+          //! True if `dependencies` is computed.
+          mutable bool dependenciesComputed;
+
         public:
           //! True if the symbolic expression is tainted.
           bool isTainted;
@@ -106,6 +113,9 @@ namespace triton {
           //! Returns the comment of the symbolic expression.
           TRITON_EXPORT const std::string& getComment(void) const;
 
+          //! Returns the symbolic expressions directly referenced by the AST, sorted by id.
+          TRITON_EXPORT const std::vector<std::shared_ptr<SymbolicExpression>>& getDependencies(void) const;
+
           //! Returns the id as string of the symbolic expression according the mode of the AST representation.
           TRITON_EXPORT std::string getFormattedId(void) const;
 
@@ -0,0 +1,108 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_SYMBOLICSERIALIZER_H
+#define TRITON_SYMBOLICSERIALIZER_H
+
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/architecture.hpp>
+#include <triton/ast.hpp>
+#include <triton/astContext.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/pathConstraint.hpp>
+#include <triton/symbolicEngine.hpp>
+#include <triton/symbolicExpression.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      /*! \class SymbolicSerializer
+       *  \brief Saves and loads ASTs, symbolic expressions and path constraints in a binary format.
+       *
+       *  \details
+       *  The stream starts with a header (magic, version, architecture), then the table of the
+       *  symbolic variables (with their current values) and a table of records sorted topologically.
+       *  A record is either an AST node (its kind followed by the delta-encoded indexes of its children)
+       *  or a symbolic expression (its type, comment, origin and AST). Each node and expression is
+       *  written once, so the size of the stream is linear in the size of the DAG. All integers are
+       *  LEB128 varints. Loading creates new symbolic expressions and new symbolic variables with their
+       *  saved values. Variable ids are not stable across contexts, thus existing symbolic variables
+       *  are reused only on request, when their name (or alias if any) and size match the saved ones.
+       */
+      class SymbolicSerializer {
+        private:
+          //! Architecture API
+          const triton::arch::Architecture* architecture;
+
+          //! Symbolic engine API
+          triton::engines::symbolic::SymbolicEngine* symbolic;
+
+          //! Reference to the context managing ast nodes.
+          triton::ast::SharedAstContext astCtxt;
+
+          //! Reads a saved symbolic variable and returns its node. The variable is taken from `existing` (keyed by name or alias) if it matches, otherwise it is created.
+          triton::ast::SharedAbstractNode loadVariable(std::istream& stream, const std::unordered_map<std::string, SharedSymbolicVariable>& existing);
+
+          //! Reads a node record of the given kind and builds it.
+          triton::ast::SharedAbstractNode loadNode(triton::uint32 kind, std::istream& stream, const std::vector<triton::ast::SharedAbstractNode>& nodes, const std::vector<triton::ast::SharedAbstractNode>& vars, const std::vector<SharedSymbolicExpression>& exprs);
+
+          //! Reads a symbolic expression record and registers it in the symbolic engine.
+          SharedSymbolicExpression loadExpression(std::istream& stream, const std::vector<triton::ast::SharedAbstractNode>& nodes);
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT SymbolicSerializer(const triton::arch::Architecture* architecture, triton::engines::symbolic::SymbolicEngine* symbolic, const triton::ast::SharedAstContext& astCtxt);
+
+          //! Writes nodes, symbolic expressions and path constraints (with everything they depend on) into `stream`.
+          TRITON_EXPORT void serialize(std::ostream& stream,
+                                       const std::vector<triton::ast::SharedAbstractNode>& nodes,
+                                       const std::vector<SharedSymbolicExpression>& exprs,
+                                       const std::vector<triton::engines::symbolic::PathConstraint>& pcs) const;
+
+          //! Reads a stream written by serialize(). Loaded items are appended to `nodes`, `exprs` and `pcs`. If `reuseVariables` is true, existing symbolic variables with the same name (or alias) and size are reused.
+          TRITON_EXPORT void deserialize(std::istream& stream,
+                                         std::vector<triton::ast::SharedAbstractNode>& nodes,
+                                         std::vector<SharedSymbolicExpression>& exprs,
+                                         std::vector<triton::engines::symbolic::PathConstraint>& pcs,
+                                         bool reuseVariables=false);
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SYMBOLICSERIALIZER_H */
@@ -8,9 +8,15 @@
 #ifndef TRITON_SYMBOLICSIMPLIFICATION_H
 #define TRITON_SYMBOLICSIMPLIFICATION_H
 
+#include <memory>
+#include <string>
+#include <vector>
+
 #include <triton/ast.hpp>
 #include <triton/callbacks.hpp>
 #include <triton/dllexport.hpp>
+#include <triton/rewriteEngine.hpp>
+#include <triton/symbolicEnums.hpp>
 
 
 
@@ -44,6 +50,12 @@ namespace triton {
           //! Callbacks API
           triton::callbacks::Callbacks* callbacks;
 
+          //! The simplification rules, applied before the callbacks.
+          triton::engines::symbolic::RewriteEngine rewriteEngine;
+
+          //! The rules of the equality saturation. They are shared between copies until modified, the default ones by all instances.
+          std::shared_ptr<const triton::engines::symbolic::RewriteEngine> saturationRules;
+
           //! Copies a SymbolicSimplification.
           void copy(const SymbolicSimplification& other);
 
@@ -54,6 +66,30 @@ namespace triton {
           //! Constructor.
           TRITON_EXPORT SymbolicSimplification(const SymbolicSimplification& other);
 
+          //! Adds simplification rules (see triton::engines::symbolic::RewriteEngine).
+          TRITON_EXPORT void addSimplificationRule(const std::string& rule);
+
+          //! Removes all simplification rules.
+          TRITON_EXPORT void clearSimplificationRules(void);
+
+          //! Returns the simplification rules.
+          TRITON_EXPORT std::vector<std::string> getSimplificationRules(void) const;
+
+          //! Adds rules to the equality saturation. The default rules are triton::engines::symbolic::EGraph::getDefaultRules().
+          TRITON_EXPORT void addSaturationRule(const std::string& rule);
+
+          //! Removes all rules of the equality saturation.
+          TRITON_EXPORT void clearSaturationRules(void);
+
+          //! Returns the rules of the equality saturation.
+          TRITON_EXPORT std::vector<std::string> getSaturationRules(void) const;
+
+          //! Simplifies a node by equality saturation (see triton::engines::symbolic::EGraph). Returns the cheapest equivalent node according to `cost`.
+          TRITON_EXPORT triton::ast::SharedAbstractNode processEqualitySaturation(const triton::ast::SharedAbstractNode& node, triton::usize nodeLimit, triton::usize timeLimit, triton::engines::symbolic::cost_e cost) const;
+
+          //! Simplifies the linear mixed boolean-arithmetic subexpressions of a node (see triton::engines::symbolic::MbaSimplifier).
+          TRITON_EXPORT triton::ast::SharedAbstractNode processMbaSimplification(const triton::ast::SharedAbstractNode& node) const;
+
           //! Processes all recorded simplifications. Returns the simplified node.
           TRITON_EXPORT triton::ast::SharedAbstractNode processSimplification(const triton::ast::SharedAbstractNode& node) const;
 
@@ -0,0 +1,97 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_SYNTHESIZER_H
+#define TRITON_SYNTHESIZER_H
+
+#include <unordered_map>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/oracleTable.hpp>
+#include <triton/solverEngine.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Synthesis namespace
+    namespace synthesis {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup synthesis
+     *  @{
+     */
+
+      /*! \class Synthesizer
+       *  \brief Replaces subexpressions by smaller equivalent ones found from their I/O behavior.
+       *
+       *  \details
+       *  The subexpressions of at most three variables are tried from the root, a subexpression is not
+       *  visited if one of its ancestors is replaced. Each one is evaluated on the sample points of the
+       *  oracle table and the smaller expressions of the same outputs are candidates: a constant, the
+       *  expressions of the table and, with constants enabled, `x op c` for one variable. The first
+       *  candidate proven equivalent by the solver replaces the subexpression. The references are not
+       *  unrolled.
+       */
+      class Synthesizer {
+        private:
+          //! The oracle table.
+          const OracleTable& oracles;
+
+          //! The solver proving the candidates.
+          const triton::engines::solver::SolverEngine& solver;
+
+          //! True if `x op c` candidates are tried.
+          bool constant;
+
+          //! The sorted ids of the variables of each node, one more than OracleTable::VARIABLES means too many.
+          std::unordered_map<triton::ast::AbstractNode*, std::vector<triton::usize>> variables;
+
+          //! Computes the variables of the nodes of an AST.
+          void collect(const triton::ast::SharedAbstractNode& node);
+
+          //! Returns the candidates of a node from the smallest one, or nothing if it is not a candidate itself.
+          std::vector<triton::ast::SharedAbstractNode> getCandidates(const triton::ast::SharedAbstractNode& node) const;
+
+          //! Returns an equivalent smaller node, or null.
+          triton::ast::SharedAbstractNode replace(const triton::ast::SharedAbstractNode& node) const;
+
+        public:
+          //! The maximum number of candidates proven for a node.
+          static const triton::usize MAX_CANDIDATES = 8;
+
+          //! Constructor.
+          TRITON_EXPORT Synthesizer(const OracleTable& oracles, const triton::engines::solver::SolverEngine& solver, bool constant=true);
+
+          //! Returns the AST with its subexpressions replaced by the synthesized ones.
+          TRITON_EXPORT triton::ast::SharedAbstractNode synthesize(const triton::ast::SharedAbstractNode& node);
+      };
+
+    /*! @} End of synthesis namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SYNTHESIZER_H */
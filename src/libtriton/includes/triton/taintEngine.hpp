@@ -8,11 +8,14 @@
 #ifndef TRITON_TAINTENGINE_H
 #define TRITON_TAINTENGINE_H
 
+#include <functional>
 #include <unordered_set>
 
 #include <triton/dllexport.hpp>
+#include <triton/journal.hpp>
 #include <triton/memoryAccess.hpp>
 #include <triton/modes.hpp>
+#include <triton/pagedMap.hpp>
 #include <triton/register.hpp>
 #include <triton/symbolicEngine.hpp>
 #include <triton/tritonTypes.hpp>
@@ -61,19 +64,28 @@ namespace triton {
           //! Cpu API
           triton::arch::CpuInterface& cpu;
 
+          //! Journal API
+          triton::engines::snapshot::Journal* journal;
+
+          //! Taints or untaints a memory cell and records its previous state into the journal.
+          void updateTaintedMemory(triton::uint64 addr, bool flag);
+
+          //! Taints or untaints a parent register and records its previous state into the journal.
+          void updateTaintedRegister(triton::arch::register_e parentId, bool flag);
+
         protected:
           //! Defines if the taint engine is enabled or disabled.
           bool enableFlag;
 
-          //! The set of tainted addresses.
-          std::unordered_set<triton::uint64> taintedMemory;
+          //! The copy-on-write set of tainted addresses.
+          triton::utils::PagedSet<12> taintedMemory;
 
           //! The set of tainted registers. Currently it is an over approximation of the taint.
           std::unordered_set<triton::arch::register_e> taintedRegisters;
 
         public:
           //! Constructor.
-          TRITON_EXPORT TaintEngine(const triton::modes::SharedModes& modes, triton::engines::symbolic::SymbolicEngine* symbolicEngine, triton::arch::CpuInterface& cpu);
+          TRITON_EXPORT TaintEngine(const triton::modes::SharedModes& modes, triton::engines::symbolic::SymbolicEngine* symbolicEngine, triton::arch::CpuInterface& cpu, triton::engines::snapshot::Journal* journal=nullptr);
 
           //! Constructor by copy.
           TRITON_EXPORT TaintEngine(const TaintEngine& other);
@@ -84,8 +96,11 @@ namespace triton {
           //! Enables or disables the taint engine.
           TRITON_EXPORT void enable(bool flag);
 
-          //! Returns the tainted addresses.
-          TRITON_EXPORT const std::unordered_set<triton::uint64>& getTaintedMemory(void) const;
+          //! Returns the tainted addresses. The set is built on each call, see forEachTaintedMemory().
+          TRITON_EXPORT std::unordered_set<triton::uint64> getTaintedMemory(void) const;
+
+          //! Calls `f(addr)` on each tainted address, without building a set.
+          TRITON_EXPORT void forEachTaintedMemory(const std::function<void(triton::uint64)>& f) const;
 
           //! Returns the tainted registers.
           TRITON_EXPORT std::unordered_set<const triton::arch::Register*> getTaintedRegisters(void) const;
@@ -174,6 +189,9 @@ namespace triton {
           //! Taints RegisterRegister with assignment. Returns true if the regDst is tainted.
           TRITON_EXPORT bool taintAssignment(const triton::arch::Register& regDst, const triton::arch::Register& regSrc);
 
+          //! Reverts a taint journal entry. The change is not journaled.
+          TRITON_EXPORT void undo(const triton::engines::snapshot::JournalEntry& entry);
+
         private:
           //! Spreads MemoryImmediate with union.
           bool unionMemoryImmediate(const triton::arch::MemoryAccess& memDst);
@@ -8,6 +8,8 @@
 #ifndef TRITON_X86CPU_HPP
 #define TRITON_X86CPU_HPP
 
+#include <map>
+#include <memory>
 #include <set>
 #include <string>
 #include <unordered_map>
@@ -15,6 +17,7 @@
 
 #include <triton/archEnums.hpp>
 #include <triton/callbacks.hpp>
+#include <triton/concreteMemory.hpp>
 #include <triton/cpuInterface.hpp>
 #include <triton/dllexport.hpp>
 #include <triton/externalLibs.hpp>
@@ -61,22 +64,17 @@ namespace triton {
           triton::callbacks::Callbacks* callbacks;
 
           //! Capstone context
-          triton::extlibs::capstone::csh handle;
+          mutable triton::extlibs::capstone::csh handle;
 
           //! Copies a x86Cpu class.
           void copy(const x86Cpu& other);
 
           //! Initializes the disassembler
-          void disassInit(void);
+          void disassInit(void) const;
 
         protected:
-          /*! \brief map of address -> concrete value
-           *
-           * \details
-           * **item1**: memory address<br>
-           * **item2**: concrete value
-           */
-          std::unordered_map<triton::uint64, triton::uint8> memory;
+          //! The concrete memory (copy-on-write pages and mapped areas)
+          triton::arch::ConcreteMemory memory;
 
           //! Concrete value of eax
           triton::uint8 eax[triton::size::dword];
@@ -237,6 +235,8 @@ namespace triton {
           TRITON_EXPORT const triton::arch::Register& getStackPointer(void) const;
           TRITON_EXPORT std::set<const triton::arch::Register*> getParentRegisters(void) const;
           TRITON_EXPORT std::vector<triton::uint8> getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks=true) const;
+          TRITON_EXPORT std::map<triton::uint64, triton::usize> getMappedConcreteMemoryAreas(void) const;
+          TRITON_EXPORT const triton::arch::ConcreteMemory& getConcreteMemory(void) const;
           TRITON_EXPORT triton::arch::endianness_e getEndianness(void) const;
           TRITON_EXPORT triton::uint32 numberOfRegisters(void) const;
           TRITON_EXPORT triton::uint32 gprBitSize(void) const;
@@ -256,6 +256,10 @@ namespace triton {
           TRITON_EXPORT bool isConcreteMemoryValueDefined(triton::uint64 baseAddr, triton::usize size=1) const;
           TRITON_EXPORT void clearConcreteMemoryValue(const triton::arch::MemoryAccess& mem);
           TRITON_EXPORT void clearConcreteMemoryValue(triton::uint64 baseAddr, triton::usize size=1);
+          TRITON_EXPORT void getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::uint8* area, triton::usize size, bool execCallbacks=true) const;
+          TRITON_EXPORT void mapConcreteMemoryArea(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size, const std::shared_ptr<const void>& owner=nullptr);
+          TRITON_EXPORT void unmapConcreteMemoryArea(triton::uint64 baseAddr);
+          TRITON_EXPORT void setConcreteMemory(const triton::arch::ConcreteMemory& memory);
           /* End of virtual pure inheritance ========================================== */
       };
 
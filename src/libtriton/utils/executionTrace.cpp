@@ -0,0 +1,275 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <cstring>
+
+#include <triton/coreUtils.hpp>
+#include <triton/cpuSize.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/executionTrace.hpp>
+
+
+
+namespace triton {
+  namespace utils {
+
+    /* The magic of an execution trace */
+    static const char traceMagic[4] = {'T', 'R', 'T', 'C'};
+
+
+    TraceWriter::TraceWriter(std::ostream& stream, triton::arch::architecture_e arch)
+      : stream(stream) {
+      this->stream.write(traceMagic, sizeof(traceMagic));
+      this->put(triton::utils::EXECUTION_TRACE_VERSION, 4);
+      this->put(arch, 4);
+      this->stream.write(reinterpret_cast<const char*>(this->payload.data()), this->payload.size());
+      this->payload.clear();
+    }
+
+
+    void TraceWriter::put(triton::uint64 value, triton::uint32 size) {
+      for (triton::uint32 index = 0; index < size; index++)
+        this->payload.push_back(static_cast<triton::uint8>(value >> (index * 8)));
+    }
+
+
+    void TraceWriter::put(triton::uint64 address, const triton::uint8* data, triton::uint32 size) {
+      this->put(address, 8);
+      this->put(size, 4);
+      this->payload.insert(this->payload.end(), data, data + size);
+    }
+
+
+    void TraceWriter::flushRecord(triton::uint8 kind) {
+      triton::uint8 head[5];
+
+      head[0] = kind;
+      for (triton::uint32 index = 0; index < 4; index++)
+        head[index + 1] = static_cast<triton::uint8>(this->payload.size() >> (index * 8));
+
+      this->stream.write(reinterpret_cast<const char*>(head), sizeof(head));
+      this->stream.write(reinterpret_cast<const char*>(this->payload.data()), this->payload.size());
+      this->payload.clear();
+
+      if (!this->stream.good())
+        throw triton::exceptions::ExecutionTrace("TraceWriter::flushRecord(): Cannot write the trace.");
+    }
+
+
+    void TraceWriter::writeSync(triton::uint32 tid, const std::vector<std::pair<triton::arch::Register, triton::uint512>>& registers) {
+      triton::uint8 buffer[triton::size::dqqword];
+
+      this->put(tid, 4);
+      this->put(registers.size(), 4);
+      for (const auto& reg : registers) {
+        triton::utils::fromUintToBuffer(reg.second, buffer);
+        this->put(reg.first.getId(), 4);
+        this->put(reg.first.getSize(), 1);
+        this->payload.insert(this->payload.end(), buffer, buffer + reg.first.getSize());
+      }
+
+      this->flushRecord(triton::utils::TRACE_RECORD_SYNC);
+    }
+
+
+    void TraceWriter::writeInstruction(triton::uint64 pc, triton::uint32 tid, const triton::uint8* opcode, triton::uint32 size, const std::vector<TraceMemoryAccess>& reads) {
+      this->put(pc, 8);
+      this->put(tid, 4);
+      this->put(size, 1);
+      this->payload.insert(this->payload.end(), opcode, opcode + size);
+      this->put(reads.size(), 4);
+      for (const auto& read : reads)
+        this->put(read.address, read.data.data(), static_cast<triton::uint32>(read.data.size()));
+
+      this->flushRecord(triton::utils::TRACE_RECORD_INSTRUCTION);
+    }
+
+
+    void TraceWriter::writeMemory(triton::uint64 address, const triton::uint8* data, triton::uint32 size) {
+      this->put(address, data, size);
+      this->flushRecord(triton::utils::TRACE_RECORD_WRITE);
+    }
+
+
+
+    TraceReader::TraceReader(std::istream& stream)
+      : stream(stream) {
+      char magic[sizeof(traceMagic)];
+      triton::uint64 version = 0;
+      triton::uint64 arch = 0;
+
+      this->cursor = 0;
+
+      if (!this->stream.read(magic, sizeof(magic)) || std::memcmp(magic, traceMagic, sizeof(magic)) != 0)
+        throw triton::exceptions::ExecutionTrace("TraceReader::TraceReader(): Not an execution trace.");
+
+      if (!this->read(version, 4) || version != triton::utils::EXECUTION_TRACE_VERSION)
+        throw triton::exceptions::ExecutionTrace("TraceReader::TraceReader(): Unsupported version of the trace format.");
+
+      if (!this->read(arch, 4))
+        throw triton::exceptions::ExecutionTrace("TraceReader::TraceReader(): Truncated header.");
+
+      this->arch  = static_cast<triton::arch::architecture_e>(arch);
+      this->first = static_cast<triton::uint64>(this->stream.tellg());
+    }
+
+
+    bool TraceReader::read(triton::uint64& value, triton::uint32 size) {
+      triton::uint8 buffer[8];
+
+      if (!this->stream.read(reinterpret_cast<char*>(buffer), size))
+        return false;
+
+      value = 0;
+      for (triton::uint32 index = 0; index < size; index++)
+        value |= static_cast<triton::uint64>(buffer[index]) << (index * 8);
+
+      return true;
+    }
+
+
+    const triton::uint8* TraceReader::getBytes(triton::usize size) {
+      if (size > this->payload.size() - this->cursor)
+        throw triton::exceptions::ExecutionTrace("TraceReader::getBytes(): Truncated record.");
+
+      const triton::uint8* ret = this->payload.data() + this->cursor;
+      this->cursor += size;
+      return ret;
+    }
+
+
+    triton::uint64 TraceReader::get(triton::uint32 size) {
+      const triton::uint8* bytes = this->getBytes(size);
+      triton::uint64 value = 0;
+
+      for (triton::uint32 index = 0; index < size; index++)
+        value |= static_cast<triton::uint64>(bytes[index]) << (index * 8);
+
+      return value;
+    }
+
+
+    TraceMemoryAccess TraceReader::getMemory(void) {
+      TraceMemoryAccess access;
+
+      access.address = this->get(8);
+      triton::usize size = static_cast<triton::usize>(this->get(4));
+      const triton::uint8* bytes = this->getBytes(size);
+      access.data.assign(bytes, bytes + size);
+
+      return access;
+    }
+
+
+    triton::arch::architecture_e TraceReader::getArchitecture(void) const {
+      return this->arch;
+    }
+
+
+    triton::uint64 TraceReader::getFirstOffset(void) const {
+      return this->first;
+    }
+
+
+    triton::uint64 TraceReader::tell(void) {
+      /* The offset is still valid at the end of the stream */
+      this->stream.clear();
+      return static_cast<triton::uint64>(this->stream.tellg());
+    }
+
+
+    void TraceReader::seek(triton::uint64 offset) {
+      this->stream.clear();
+      this->stream.seekg(static_cast<std::streamoff>(offset ? offset : this->first));
+    }
+
+
+    bool TraceReader::next(TraceRecord& record) {
+      triton::uint64 kind = 0;
+      triton::uint64 size = 0;
+
+      if (!this->read(kind, 1))
+        return false;
+
+      if (!this->read(size, 4))
+        throw triton::exceptions::ExecutionTrace("TraceReader::next(): Truncated record.");
+
+      this->payload.resize(static_cast<triton::usize>(size));
+      this->cursor = 0;
+      if (size && !this->stream.read(reinterpret_cast<char*>(this->payload.data()), static_cast<std::streamsize>(size)))
+        throw triton::exceptions::ExecutionTrace("TraceReader::next(): Truncated record.");
+
+      record.kind = static_cast<triton::uint8>(kind);
+      record.tid  = 0;
+      record.pc   = 0;
+      record.opcode.clear();
+      record.registers.clear();
+      record.memory.clear();
+
+      switch (record.kind) {
+        case triton::utils::TRACE_RECORD_SYNC: {
+          record.tid = static_cast<triton::uint32>(this->get(4));
+          triton::uint64 count = this->get(4);
+          for (triton::uint64 index = 0; index < count; index++) {
+            triton::uint8 buffer[triton::size::dqqword] = {0};
+            auto id = static_cast<triton::arch::register_e>(this->get(4));
+            triton::uint32 regSize = static_cast<triton::uint32>(this->get(1));
+            if (regSize > sizeof(buffer))
+              throw triton::exceptions::ExecutionTrace("TraceReader::next(): Invalid register size.");
+            std::memcpy(buffer, this->getBytes(regSize), regSize);
+            record.registers.push_back(std::make_pair(id, triton::utils::fromBufferToUint<triton::uint512>(buffer)));
+          }
+          break;
+        }
+
+        case triton::utils::TRACE_RECORD_INSTRUCTION: {
+          record.pc  = this->get(8);
+          record.tid = static_cast<triton::uint32>(this->get(4));
+          triton::usize opSize = static_cast<triton::usize>(this->get(1));
+          const triton::uint8* opcode = this->getBytes(opSize);
+          record.opcode.assign(opcode, opcode + opSize);
+          triton::uint64 count = this->get(4);
+          for (triton::uint64 index = 0; index < count; index++)
+            record.memory.push_back(this->getMemory());
+          break;
+        }
+
+        case triton::utils::TRACE_RECORD_WRITE:
+          record.memory.push_back(this->getMemory());
+          break;
+
+        /* Unknown records are returned without their payload */
+        default:
+          break;
+      }
+
+      return true;
+    }
+
+
+    std::vector<triton::uint64> TraceReader::getSyncPoints(void) {
+      std::vector<triton::uint64> ret;
+      triton::uint64 position = this->tell();
+      triton::uint64 kind = 0;
+      triton::uint64 size = 0;
+
+      this->seek(this->first);
+      while (true) {
+        triton::uint64 offset = this->tell();
+        if (!this->read(kind, 1) || !this->read(size, 4))
+          break;
+        if (kind == triton::utils::TRACE_RECORD_SYNC)
+          ret.push_back(offset);
+        this->stream.seekg(static_cast<std::streamoff>(size), std::ios::cur);
+      }
+
+      this->seek(position);
+      return ret;
+    }
+
+  }; /* utils namespace */
+}; /* triton namespace */
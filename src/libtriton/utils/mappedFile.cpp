@@ -0,0 +1,146 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#if defined(__unix__) || defined(__APPLE__)
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#elif _WIN32
+  #include <windows.h>
+#endif
+
+#include <limits>
+
+#include <triton/exceptions.hpp>
+#include <triton/mappedFile.hpp>
+
+
+
+namespace triton {
+  namespace utils {
+
+    #if defined(__unix__) || defined(__APPLE__)
+
+    MappedFile::MappedFile(const std::string& path, triton::uint64 offset, triton::usize size) {
+      struct stat st;
+
+      int fd = open(path.c_str(), O_RDONLY);
+      if (fd < 0)
+        throw triton::exceptions::MappedFile("MappedFile::MappedFile(): Cannot open the file.");
+
+      if (fstat(fd, &st) != 0 || offset > static_cast<triton::uint64>(st.st_size)) {
+        close(fd);
+        throw triton::exceptions::MappedFile("MappedFile::MappedFile(): Invalid offset.");
+      }
+
+      /* The bytes available from offset, compared without computing offset + size which may overflow */
+      triton::uint64 available = static_cast<triton::uint64>(st.st_size) - offset;
+
+      if (size == 0 && available <= std::numeric_limits<triton::usize>::max())
+        size = static_cast<triton::usize>(available);
+
+      if (size == 0 || size > available) {
+        close(fd);
+        throw triton::exceptions::MappedFile("MappedFile::MappedFile(): Invalid size.");
+      }
+
+      /* mmap() needs an offset aligned on a page */
+      triton::uint64 pageSize = static_cast<triton::uint64>(sysconf(_SC_PAGESIZE));
+      triton::uint64 aligned  = offset & ~(pageSize - 1);
+
+      this->mappingSize = static_cast<triton::usize>(size + (offset - aligned));
+      this->mapping     = mmap(nullptr, this->mappingSize, PROT_READ, MAP_PRIVATE, fd, static_cast<off_t>(aligned));
+      close(fd);
+
+      if (this->mapping == MAP_FAILED)
+        throw triton::exceptions::MappedFile("MappedFile::MappedFile(): Cannot map the file.");
+
+      this->data = reinterpret_cast<const triton::uint8*>(this->mapping) + (offset - aligned);
+      this->size = size;
+    }
+
+
+    MappedFile::~MappedFile() {
+      munmap(this->mapping, this->mappingSize);
+    }
+
+    #elif _WIN32
+
+    MappedFile::MappedFile(const std::string& path, triton::uint64 offset, triton::usize size) {
+      LARGE_INTEGER fileSize;
+
+      HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+      if (file == INVALID_HANDLE_VALUE)
+        throw triton::exceptions::MappedFile("MappedFile::MappedFile(): Cannot open the file.");
+
+      if (!GetFileSizeEx(file, &fileSize) || offset > static_cast<triton::uint64>(fileSize.QuadPart)) {
+        CloseHandle(file);
+        throw triton::exceptions::MappedFile("MappedFile::MappedFile(): Invalid offset.");
+      }
+
+      /* The bytes available from offset, compared without computing offset + size which may overflow */
+      triton::uint64 available = static_cast<triton::uint64>(fileSize.QuadPart) - offset;
+
+      if (size == 0 && available <= std::numeric_limits<triton::usize>::max())
+        size = static_cast<triton::usize>(available);
+
+      if (size == 0 || size > available) {
+        CloseHandle(file);
+        throw triton::exceptions::MappedFile("MappedFile::MappedFile(): Invalid size.");
+      }
+
+      HANDLE section = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+      CloseHandle(file);
+      if (section == nullptr)
+        throw triton::exceptions::MappedFile("MappedFile::MappedFile(): Cannot map the file.");
+
+      /* MapViewOfFile() needs an offset aligned on the allocation granularity */
+      SYSTEM_INFO info;
+      GetSystemInfo(&info);
+      triton::uint64 aligned = offset & ~(static_cast<triton::uint64>(info.dwAllocationGranularity) - 1);
+
+      this->mappingSize = static_cast<triton::usize>(size + (offset - aligned));
+      this->mapping     = MapViewOfFile(section, FILE_MAP_READ, static_cast<DWORD>(aligned >> 32), static_cast<DWORD>(aligned), this->mappingSize);
+      CloseHandle(section);
+
+      if (this->mapping == nullptr)
+        throw triton::exceptions::MappedFile("MappedFile::MappedFile(): Cannot map the file.");
+
+      this->data = reinterpret_cast<const triton::uint8*>(this->mapping) + (offset - aligned);
+      this->size = size;
+    }
+
+
+    MappedFile::~MappedFile() {
+      UnmapViewOfFile(this->mapping);
+    }
+
+    #else
+
+    MappedFile::MappedFile(const std::string& path, triton::uint64 offset, triton::usize size) {
+      throw triton::exceptions::MappedFile("MappedFile::MappedFile(): Not supported on this platform.");
+    }
+
+
+    MappedFile::~MappedFile() {
+    }
+
+    #endif
+
+
+    const triton::uint8* MappedFile::getData(void) const {
+      return this->data;
+    }
+
+
+    triton::usize MappedFile::getSize(void) const {
+      return this->size;
+    }
+
+  }; /* utils namespace */
+}; /* triton namespace */
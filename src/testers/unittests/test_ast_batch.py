@@ -0,0 +1,117 @@
+#!/usr/bin/env python
+# coding: utf-8
+"""Testing the batch evaluation of ASTs."""
+
+import random
+import unittest
+
+from triton import ARCH, TritonContext
+
+
+class TestAstBatch(unittest.TestCase):
+
+    """Testing the batch evaluation of ASTs."""
+
+    def setUp(self):
+        """Define the arch."""
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ast = self.ctx.getAstContext()
+        random.seed(0x1234)
+
+    def values(self, size, count):
+        """Returns interesting and random values of a size."""
+        mask = (1 << size) - 1
+        sign = 1 << (size - 1)
+        edges = [0, 1, 2, mask, mask - 1, sign, sign - 1, sign + 1]
+        ret = [v & mask for v in edges]
+        while len(ret) < count:
+            ret.append(random.getrandbits(size))
+        return ret[:count]
+
+    def check(self, node, variables, count=40):
+        """Compares the batch evaluation with the evaluation of each assignment."""
+        inputs = dict()
+        for var in variables:
+            inputs[var] = self.values(var.getBitSize(), count)
+            random.shuffle(inputs[var])
+
+        results = node.evaluateBatch(inputs)
+        self.assertEqual(len(results), count)
+
+        for i in range(count):
+            for var in variables:
+                self.ctx.setConcreteVariableValue(var, inputs[var][i])
+            self.assertEqual(results[i], node.evaluate())
+
+    def operators(self, x, y):
+        """Returns a node of each binary operator."""
+        a = self.ast
+        return [
+            a.bvadd(x, y), a.bvand(x, y), a.bvashr(x, y), a.bvlshr(x, y), a.bvmul(x, y), a.bvnand(x, y),
+            a.bvnor(x, y), a.bvor(x, y), a.bvsdiv(x, y), a.bvshl(x, y), a.bvsmod(x, y), a.bvsrem(x, y),
+            a.bvsub(x, y), a.bvudiv(x, y), a.bvurem(x, y), a.bvxnor(x, y), a.bvxor(x, y),
+            a.bvneg(x), a.bvnot(y), a.bvrol(x, a.bv(3, 8)), a.bvror(y, a.bv(5, 8)), a.bvrol(x, a.bv(0, 8)),
+            a.ite(a.bvsge(x, y), x, y), a.ite(a.bvsgt(x, y), x, y), a.ite(a.bvsle(x, y), x, y),
+            a.ite(a.bvslt(x, y), x, y), a.ite(a.bvuge(x, y), x, y), a.ite(a.bvugt(x, y), x, y),
+            a.ite(a.bvule(x, y), x, y), a.ite(a.bvult(x, y), x, y), a.ite(a.distinct(x, y), x, y),
+            a.ite(a.lor([a.equal(x, y), a.land([a.bvult(x, y), a.lnot(a.equal(y, a.bv(0, y.getBitvectorSize())))])]), x, y),
+            a.ite(a.lxor([a.bvult(x, y), a.bvslt(x, y)]), x, y), a.ite(a.iff(a.bvult(x, y), a.bvslt(x, y)), x, y),
+            a.concat([x, y]), a.extract(x.getBitvectorSize() - 1, x.getBitvectorSize() // 2, x), a.sx(7, y), a.zx(9, x),
+        ]
+
+    def test_operators(self):
+        """Check each operator on several sizes, including sizes larger than 64 bits."""
+        for size in [1, 8, 13, 32, 64, 128]:
+            x = self.ctx.newSymbolicVariable(size)
+            y = self.ctx.newSymbolicVariable(size)
+            for node in self.operators(self.ast.variable(x), self.ast.variable(y)):
+                self.check(node, [x, y])
+
+    def test_shift_amounts(self):
+        """Check shifts by amounts larger than the size."""
+        x = self.ctx.newSymbolicVariable(64)
+        y = self.ctx.newSymbolicVariable(64)
+        vx = self.ast.variable(x)
+        vy = self.ast.variable(y)
+        for node in [self.ast.bvashr(vx, vy), self.ast.bvlshr(vx, vy), self.ast.bvshl(vx, vy)]:
+            results = node.evaluateBatch({x: [0x8000000000000123] * 3, y: [63, 64, (1 << 32) + 1]})
+            for i, shift in enumerate([63, 64, (1 << 32) + 1]):
+                self.ctx.setConcreteVariableValue(x, 0x8000000000000123)
+                self.ctx.setConcreteVariableValue(y, shift)
+                self.assertEqual(results[i], node.evaluate())
+
+    def test_dag(self):
+        """Check a deep DAG with references and shared subexpressions."""
+        x = self.ctx.newSymbolicVariable(32)
+        y = self.ctx.newSymbolicVariable(32)
+        node = self.ast.bvxor(self.ast.variable(x), self.ast.variable(y))
+        for i in range(200):
+            expr = self.ctx.newSymbolicExpression(node)
+            ref = self.ast.reference(expr)
+            node = self.ast.bvadd(self.ast.bvmul(ref, ref), self.ast.bvor(ref, self.ast.bv(i, 32)))
+        self.check(node, [x, y], count=600)
+
+    def test_missing_variables(self):
+        """Check that the missing variables keep their current value."""
+        x = self.ctx.newSymbolicVariable(8)
+        y = self.ctx.newSymbolicVariable(8)
+        node = self.ast.bvsub(self.ast.variable(x), self.ast.variable(y))
+        self.ctx.setConcreteVariableValue(y, 5)
+        self.assertEqual(node.evaluateBatch({x: [5, 6, 0]}), [0, 1, 0xfb])
+        self.assertEqual(node.evaluateBatch({x.getId(): [7]}), [2])
+        self.assertEqual(node.evaluateBatch({}), [node.evaluate()])
+        self.assertEqual(self.ast.bv(3, 8).evaluateBatch({x: [1, 2]}), [3, 3])
+
+    def test_errors(self):
+        """Check the wrong arguments."""
+        x = self.ctx.newSymbolicVariable(8)
+        y = self.ctx.newSymbolicVariable(8)
+        node = self.ast.bvadd(self.ast.variable(x), self.ast.variable(y))
+        with self.assertRaises(TypeError):
+            node.evaluateBatch([1, 2])
+        with self.assertRaises(TypeError):
+            node.evaluateBatch({x: [1, 2], y: [1]})
+        with self.assertRaises(TypeError):
+            node.evaluateBatch({x: 1})
+        with self.assertRaises(TypeError):
+            self.ast.let("a", self.ast.variable(x), self.ast.string("a")).evaluateBatch({x: [1]})
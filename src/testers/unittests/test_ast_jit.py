@@ -0,0 +1,105 @@
+#!/usr/bin/env python
+# coding: utf-8
+"""Testing the compilation of ASTs to native code."""
+
+import platform
+import random
+import unittest
+
+from triton import ARCH, TritonContext
+
+
+@unittest.skipUnless(platform.machine().lower() in ('x86_64', 'amd64'), "requires x86-64")
+class TestAstJit(unittest.TestCase):
+
+    """Testing the compilation of ASTs to native code."""
+
+    def setUp(self):
+        """Define the arch."""
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ast = self.ctx.getAstContext()
+        random.seed(0x4321)
+
+    def values(self, size, count):
+        """Returns interesting and random values of a size."""
+        mask = (1 << size) - 1
+        sign = 1 << (size - 1)
+        ret = [v & mask for v in [0, 1, 2, mask, mask - 1, sign, sign - 1, sign + 1]]
+        while len(ret) < count:
+            ret.append(random.getrandbits(size))
+        return ret[:count]
+
+    def check(self, node, variables, count=40):
+        """Compares the compiled function with the evaluation of each assignment."""
+        f = node.compile()
+        ids = [v.getId() for v in f.getVariables()]
+        self.assertEqual(ids, sorted(ids))
+
+        inputs = dict()
+        for var in variables:
+            inputs[var.getId()] = self.values(var.getBitSize(), count)
+            random.shuffle(inputs[var.getId()])
+
+        for i in range(count):
+            for var in variables:
+                self.ctx.setConcreteVariableValue(var, inputs[var.getId()][i])
+            self.assertEqual(f(*[inputs[v][i] for v in ids]), node.evaluate())
+
+    def operators(self, x, y):
+        """Returns a node of each operator."""
+        a = self.ast
+        size = x.getBitvectorSize()
+        nodes = [
+            a.bvadd(x, y), a.bvand(x, y), a.bvashr(x, y), a.bvlshr(x, y), a.bvmul(x, y), a.bvnand(x, y),
+            a.bvnor(x, y), a.bvor(x, y), a.bvsdiv(x, y), a.bvshl(x, y), a.bvsmod(x, y), a.bvsrem(x, y),
+            a.bvsub(x, y), a.bvudiv(x, y), a.bvurem(x, y), a.bvxnor(x, y), a.bvxor(x, y),
+            a.bvneg(x), a.bvnot(y), a.bvrol(x, a.bv(3, 8)), a.bvror(y, a.bv(5, 8)), a.bvrol(x, a.bv(0, 8)),
+            a.ite(a.bvsge(x, y), x, y), a.ite(a.bvsgt(x, y), x, y), a.ite(a.bvsle(x, y), x, y),
+            a.ite(a.bvslt(x, y), x, y), a.ite(a.bvuge(x, y), x, y), a.ite(a.bvugt(x, y), x, y),
+            a.ite(a.bvule(x, y), x, y), a.ite(a.bvult(x, y), x, y), a.ite(a.distinct(x, y), x, y),
+            a.ite(a.lor([a.equal(x, y), a.land([a.bvult(x, y), a.lnot(a.equal(y, a.bv(0, size)))])]), x, y),
+            a.ite(a.lxor([a.bvult(x, y), a.bvslt(x, y)]), x, y), a.ite(a.iff(a.bvult(x, y), a.bvslt(x, y)), x, y),
+            a.extract(size - 1, size // 2, x),
+        ]
+        if size * 2 + 1 <= 64:
+            nodes += [a.concat([x, y]), a.concat([y, a.extract(size - 1, size - 1, x), x])]
+        if size + 9 <= 64:
+            nodes += [a.sx(7, y), a.zx(9, x)]
+        return nodes
+
+    def test_operators(self):
+        """Check each operator on several sizes."""
+        for size in [1, 8, 13, 32, 33, 63, 64]:
+            x = self.ctx.newSymbolicVariable(size)
+            y = self.ctx.newSymbolicVariable(size)
+            for node in self.operators(self.ast.variable(x), self.ast.variable(y)):
+                self.check(node, [x, y])
+
+    def test_dag(self):
+        """Check a deep DAG with references and shared subexpressions."""
+        x = self.ctx.newSymbolicVariable(64)
+        y = self.ctx.newSymbolicVariable(16)
+        node = self.ast.bvxor(self.ast.variable(x), self.ast.zx(48, self.ast.variable(y)))
+        for i in range(300):
+            ref = self.ast.reference(self.ctx.newSymbolicExpression(node))
+            node = self.ast.bvadd(self.ast.bvmul(ref, ref), self.ast.bvor(ref, self.ast.bv(i, 64)))
+        self.check(node, [x, y], count=100)
+
+    def test_errors(self):
+        """Check the ASTs which cannot be compiled and the wrong arguments."""
+        x = self.ctx.newSymbolicVariable(64)
+        node = self.ast.bvadd(self.ast.variable(x), self.ast.bv(1, 64))
+        with self.assertRaises(TypeError):
+            self.ast.zx(64, node).compile()
+        f = node.compile()
+        self.assertGreater(f.getCodeSize(), 0)
+        self.assertEqual(f(0xffffffffffffffff), 0)
+        with self.assertRaises(TypeError):
+            f()
+        with self.assertRaises(TypeError):
+            f(1, 2)
+        with self.assertRaises(TypeError):
+            f("a")
+        with self.assertRaises(TypeError):
+            f(1 << 600)
+        self.assertEqual(self.ast.bv(3, 8).compile()(), 3)
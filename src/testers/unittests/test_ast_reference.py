@@ -53,3 +53,23 @@ class TestAstReference(unittest.TestCase):
         exp1 = self.Triton.newSymbolicExpression(self.astCtxt.reference(self.Triton.getSymbolicExpression(0)), "exp1")
         exp2 = self.Triton.newSymbolicExpression(self.astCtxt.reference(self.Triton.getSymbolicExpression(1)), "exp2")
         self.assertEqual(str(self.astCtxt.unroll(exp2.getAst())), "SymVar_0")
+
+    def test_unroll_inner_change(self):
+        e1 = self.Triton.newSymbolicExpression(self.astCtxt.bv(5, 8))
+        e2 = self.Triton.newSymbolicExpression(self.astCtxt.reference(e1) + self.astCtxt.bv(1, 8))
+        self.assertEqual(str(self.astCtxt.unroll(self.astCtxt.reference(e2))), "(bvadd (_ bv5 8) (_ bv1 8))")
+
+        # The unrolled copy of e2 follows the new AST of e1
+        self.Triton.symbolizeExpression(e1.getId(), 8)
+        self.assertEqual(str(self.astCtxt.unroll(self.astCtxt.reference(e2))), "(bvadd SymVar_0 (_ bv1 8))")
+        e1.setAst(self.astCtxt.bv(7, 8))
+        self.assertEqual(str(self.astCtxt.unroll(self.astCtxt.reference(e2))), "(bvadd (_ bv7 8) (_ bv1 8))")
+
+        # A rollback or a restore of the state drops the cached copies
+        snap = self.Triton.takeSnapshot()
+        cp = self.Triton.checkpoint()
+        e3 = self.Triton.newSymbolicExpression(self.astCtxt.reference(e2))
+        self.assertEqual(self.astCtxt.unroll(self.astCtxt.reference(e3)).evaluate(), 8)
+        self.Triton.rollback(cp)
+        self.Triton.restoreSnapshot(snap)
+        self.assertEqual(self.astCtxt.unroll(self.astCtxt.reference(e2)).evaluate(), 8)
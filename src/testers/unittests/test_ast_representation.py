@@ -2,6 +2,8 @@
 # coding: utf-8
 """Test AST representation."""
 
+import os
+import tempfile
 import unittest
 
 from triton import TritonContext, ARCH, AST_REPRESENTATION
@@ -92,6 +94,75 @@ class TestAstRepresentation(unittest.TestCase):
         for n in self.node:
             self.assertEqual(str(n[0]), n[1])
 
+    def test_smt_dag(self):
+        # Without sharing, the last line is the SMT representation
+        for n in self.node:
+            if 'ref!' not in n[1] and '\n' not in n[1]:
+                self.assertEqual(self.Triton.printSmtDag(n[0]).splitlines()[-1], n[1])
+
+        # Each shared node is printed once
+        x = self.v1
+        for i in range(30):
+            x = x + x
+        lines = self.Triton.printSmtDag(x).splitlines()
+        self.assertEqual(len(lines), 31)
+        self.assertEqual(lines[0], "(declare-fun SymVar_0 () (_ BitVec 8))")
+        self.assertEqual(lines[1], "(define-fun node!0 () (_ BitVec 8) (bvadd SymVar_0 SymVar_0))")
+        self.assertEqual(lines[-1], "(bvadd node!28 node!28)")
+
+        # References are unrolled
+        e = self.astCtxt.reference(self.ref)
+        c = self.astCtxt.equal(self.astCtxt.bvmul(e, e), self.astCtxt.bv(1, 8))
+        lines = self.Triton.printSmtDag(c, True).splitlines()
+        self.assertEqual(lines[2], "(define-fun node!0 () (_ BitVec 8) (bvadd SymVar_0 SymVar_1))")
+        self.assertEqual(lines[3], "(assert (= (bvmul node!0 node!0) (_ bv1 8)))")
+
+        # Streaming into a file
+        path = os.path.join(tempfile.mkdtemp(), "dag.smt2")
+        self.assertIsNone(self.Triton.printSmtDag(c, True, path))
+        with open(path) as f:
+            self.assertEqual(f.read().splitlines(), lines)
+        os.remove(path)
+
+    def test_hoisted(self):
+        self.Triton.setAstRepresentationMode(AST_REPRESENTATION.PYTHON)
+
+        # Each shared node is printed once
+        x = self.v1
+        for i in range(30):
+            x = x + x
+        lines = self.astCtxt.printHoisted(x).splitlines()
+        self.assertEqual(len(lines), 30)
+        self.assertEqual(lines[0], "t0 = ((SymVar_0 + SymVar_0) & 0xff)")
+        self.assertEqual(lines[1], "t1 = ((t0 + t0) & 0xff)")
+        self.assertEqual(lines[-1], "((t28 + t28) & 0xff)")
+
+        # Nodes are printed normally afterwards
+        self.assertEqual(str(self.astCtxt.bvadd(self.v1, self.v1)), "((SymVar_0 + SymVar_0) & 0xff)")
+
+        # Deep trees are split
+        y = self.v1
+        for i in range(1000):
+            y = y + self.v2
+        lines = self.astCtxt.printHoisted(y).splitlines()
+        self.assertTrue(len(lines) > 1)
+        self.assertTrue(all(len(l) < 3000 for l in lines))
+
+        # Bounded output
+        out = self.astCtxt.printHoisted(x, 50)
+        self.assertEqual(len(out), 53)
+        self.assertTrue(out.endswith("..."))
+
+        # SMT mode
+        self.Triton.setAstRepresentationMode(AST_REPRESENTATION.SMT)
+        lines = self.astCtxt.printHoisted(x).splitlines()
+        self.assertEqual(lines[0], "(define-fun t0 () (_ BitVec 8) (bvadd SymVar_0 SymVar_0))")
+        self.assertEqual(lines[-1], "(bvadd t28 t28)")
+
+        # Same numbering as printSmtDag
+        dag = self.Triton.printSmtDag(x).splitlines()[1:]
+        self.assertEqual([l.replace("node!", "t") for l in dag], lines)
+
     def test_python_representation(self):
         self.Triton.setAstRepresentationMode(AST_REPRESENTATION.PYTHON)
         self.assertEqual(self.Triton.getAstRepresentationMode(), AST_REPRESENTATION.PYTHON)
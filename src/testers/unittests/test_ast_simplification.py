@@ -677,3 +677,232 @@ class TestAstSimplification5(unittest.TestCase):
         a = self.ast.variable(self.ctx.newSymbolicVariable(32))
         n = self.ast.concat([self.ast.extract(15, 0, a), self.ast.extract(31, 16, a)])
         self.assertEqual(str(n), "(concat ((_ extract 15 0) SymVar_0) ((_ extract 31 16) SymVar_0))")
+
+
+class TestAstSimplification6(unittest.TestCase):
+
+    """Testing AST simplification via rewrite rules"""
+
+    def setUp(self):
+        self.ctx = TritonContext()
+        self.ctx.setArchitecture(ARCH.X86_64)
+        self.ast = self.ctx.getAstContext()
+        self.ctx.addSimplificationRule("""
+            (bvxor x x) -> 0                                        ; A ^ A = 0
+            (bvor (bvand x (bvnot y)) (bvand (bvnot x) y)) -> (bvxor x y)
+            (bvand x -1) -> x
+            (bvsub x y) -> (bvadd x (bvneg y))
+            (bvadd x (bvneg x)) -> 0
+        """)
+
+    def test_xor(self):
+        a = self.ast.bv(1, 8)
+        b = self.ast.bv(2, 8)
+        self.assertEqual(str(self.ctx.simplify(a ^ a)), "(_ bv0 8)")
+        self.assertEqual(str(self.ctx.simplify(a ^ b)), "(bvxor (_ bv1 8) (_ bv2 8))")
+        self.assertEqual(str(self.ctx.simplify((a & ~b) | (~a & b))), "(bvxor (_ bv1 8) (_ bv2 8))")
+        self.assertEqual(str(self.ctx.simplify((~b & a) | (~a & b))), "(bvxor (_ bv1 8) (_ bv2 8))")
+        self.assertEqual(str(self.ctx.simplify((~b & a) | (b & ~a))), "(bvxor (_ bv1 8) (_ bv2 8))")
+        self.assertEqual(str(self.ctx.simplify((b & ~a) | (~b & a))), "(bvxor (_ bv2 8) (_ bv1 8))")
+
+    def test_literals(self):
+        a = self.ast.variable(self.ctx.newSymbolicVariable(16))
+        self.assertEqual(str(self.ctx.simplify(a & 0xffff)), "SymVar_0")
+        self.assertEqual(str(self.ctx.simplify(a & 0xfffe)), "(bvand SymVar_0 (_ bv65534 16))")
+        self.ctx.addSimplificationRule("(bvor x 0xff00) -> (bvor 0xff00 x)")
+        self.assertEqual(str(self.ctx.simplify(a | 0xff00)), "(bvor (_ bv65280 16) SymVar_0)")
+
+    def test_chained(self):
+        # The nodes built by a rule are rewritten too
+        a = self.ast.variable(self.ctx.newSymbolicVariable(32))
+        b = self.ast.variable(self.ctx.newSymbolicVariable(32))
+        self.assertEqual(str(self.ctx.simplify(a - a)), "(_ bv0 32)")
+        self.assertEqual(str(self.ctx.simplify((a ^ a) | ((a + b) - (a + b)))), "(bvor (_ bv0 32) (_ bv0 32))")
+        self.assertEqual(str(self.ctx.simplify(a - b)), "(bvadd SymVar_0 (bvneg SymVar_1))")
+
+    def test_unmodified(self):
+        a = self.ast.variable(self.ctx.newSymbolicVariable(32))
+        n = (a ^ a) + a
+        s = self.ctx.simplify(n)
+        self.assertEqual(str(s), "(bvadd (_ bv0 32) SymVar_0)")
+        self.assertEqual(str(n), "(bvadd (bvxor SymVar_0 SymVar_0) SymVar_0)")
+
+    def test_dag(self):
+        # Each node of the DAG is rewritten once
+        a = self.ast.variable(self.ctx.newSymbolicVariable(32))
+        n = a
+        for i in range(2000):
+            n = (n ^ n) + n
+        s = self.ctx.simplify(n)
+        self.assertEqual(s.evaluate(), n.evaluate())
+        self.assertEqual(s.getType(), AST_NODE.BVADD)
+        self.assertEqual(str(s.getChildren()[0]), "(_ bv0 32)")
+
+    def test_expressions(self):
+        # Rules are applied on new symbolic expressions
+        a = self.ast.variable(self.ctx.newSymbolicVariable(32))
+        e = self.ctx.newSymbolicExpression(a ^ a)
+        self.assertEqual(str(e.getAst()), "(_ bv0 32)")
+
+    def test_rules(self):
+        self.assertEqual(len(self.ctx.getSimplificationRules()), 5)
+        self.assertEqual(self.ctx.getSimplificationRules()[0], "(bvxor x x) -> 0")
+        for rule in ["(bvxor x x)", "x -> 0", "(bvxor x y) -> z", "(foo x) -> x", "(bvnot x y) -> x", "(bvnot x -> x"]:
+            with self.assertRaises(TypeError):
+                self.ctx.addSimplificationRule(rule)
+        self.assertEqual(len(self.ctx.getSimplificationRules()), 5)
+        self.ctx.clearSimplificationRules()
+        self.assertEqual(len(self.ctx.getSimplificationRules()), 0)
+        a = self.ast.bv(1, 8)
+        self.assertEqual(str(self.ctx.simplify(a ^ a)), "(bvxor (_ bv1 8) (_ bv1 8))")
+
+
+class TestAstSimplification7(unittest.TestCase):
+
+    """Testing AST simplification via equality saturation"""
+
+    def setUp(self):
+        self.ctx = TritonContext()
+        self.ctx.setArchitecture(ARCH.X86_64)
+        self.ast = self.ctx.getAstContext()
+        self.x = self.ast.variable(self.ctx.newSymbolicVariable(8))
+        self.y = self.ast.variable(self.ctx.newSymbolicVariable(8))
+
+    def assertEquivalent(self, a, b):
+        # Exhaustive over 8-bit inputs
+        vx = self.x.getSymbolicVariable()
+        vy = self.y.getSymbolicVariable()
+        for i in range(0, 256, 7):
+            for j in range(0, 256, 5):
+                self.ctx.setConcreteVariableValue(vx, i)
+                self.ctx.setConcreteVariableValue(vy, j)
+                self.assertEqual(a.evaluate(), b.evaluate())
+
+    def test_mba(self):
+        x, y = self.x, self.y
+        self.assertEqual(str(self.ctx.saturate(((x ^ y) + 2 * (x & y)) - y)), "SymVar_0")
+        self.assertEqual(str(self.ctx.saturate((x | y) - (x & y))), "(bvxor SymVar_0 SymVar_1)")
+        self.assertEqual(str(self.ctx.saturate(~(~x & ~y))), "(bvor SymVar_0 SymVar_1)")
+        self.assertEqual(str(self.ctx.saturate((x ^ y) ^ y)), "SymVar_0")
+
+    def test_equivalence(self):
+        x, y = self.x, self.y
+        for n in [(x + y) - 2 * (x & y), (x & ~y) + (x & y), ((x | y) << 1) - (x ^ y), -(~x) - 1, (x * 3) - x - x]:
+            s = self.ctx.saturate(n, nodeLimit=2000)
+            self.assertLessEqual(len(str(s)), len(str(n)))
+            self.assertEquivalent(n, s)
+            self.assertEquivalent(n, self.ctx.saturate(n, nodeLimit=2000, cost=SYMBOLIC.SOLVER_COST))
+
+    def test_opaque(self):
+        # Nodes which are not operators of the rules are kept, their operands are simplified
+        x, y = self.x, self.y
+        n = self.ast.concat([self.ast.extract(3, 0, (x ^ y) ^ y), x])
+        s = self.ctx.saturate(n)
+        self.assertEqual(str(s), "(concat ((_ extract 3 0) SymVar_0) SymVar_0)")
+        self.assertEquivalent(n, s)
+
+    def test_unmodified(self):
+        x = self.x
+        n = (x ^ x) + x
+        self.assertEqual(str(self.ctx.saturate(n)), "SymVar_0")
+        self.assertEqual(str(n), "(bvadd (bvxor SymVar_0 SymVar_0) SymVar_0)")
+
+    def test_budget(self):
+        x, y = self.x, self.y
+        n = ((x ^ y) + 2 * (x & y)) - y
+        s = self.ctx.saturate(n, nodeLimit=10, timeLimit=0)
+        self.assertEquivalent(n, s)
+        s = self.ctx.saturate(node=n, nodeLimit=0, timeLimit=1)
+        self.assertEquivalent(n, s)
+        with self.assertRaises(TypeError):
+            self.ctx.saturate(n, nodeLimit=0, timeLimit=0)
+
+    def test_rules(self):
+        self.assertGreater(len(self.ctx.getSaturationRules()), 0)
+        with self.assertRaises(TypeError):
+            self.ctx.addSaturationRule("(bvxor x y) -> z")
+        with self.assertRaises(TypeError):
+            self.ctx.saturate(1)
+        count = len(self.ctx.getSaturationRules())
+        self.ctx.clearSaturationRules()
+        self.assertEqual(len(self.ctx.getSaturationRules()), 0)
+        # The default rules are shared with the other contexts
+        self.assertEqual(len(TritonContext(ARCH.X86_64).getSaturationRules()), count)
+        x = self.x
+        # Constants are still folded
+        self.assertEqual(str(self.ctx.saturate(x ^ x)), "(bvxor SymVar_0 SymVar_0)")
+        self.assertEqual(str(self.ctx.saturate(self.ast.bv(1, 8) + self.ast.bv(2, 8))), "(_ bv3 8)")
+        self.ctx.addSaturationRule("(bvxor x x) -> 0")
+        self.assertEqual(self.ctx.getSaturationRules(), ["(bvxor x x) -> 0"])
+        self.assertEqual(str(self.ctx.saturate(x ^ x)), "(_ bv0 8)")
+
+
+class TestAstSimplification8(unittest.TestCase):
+
+    """Testing AST simplification of linear mixed boolean-arithmetic expressions"""
+
+    def setUp(self):
+        self.ctx = TritonContext()
+        self.ctx.setArchitecture(ARCH.X86_64)
+        self.ast = self.ctx.getAstContext()
+        self.x = self.ast.variable(self.ctx.newSymbolicVariable(32))
+        self.y = self.ast.variable(self.ctx.newSymbolicVariable(32))
+        self.z = self.ast.variable(self.ctx.newSymbolicVariable(32))
+
+    def assertEquivalent(self, a, b):
+        for i in range(64):
+            for v in [self.x, self.y, self.z]:
+                self.ctx.setConcreteVariableValue(v.getSymbolicVariable(), (i * 0x9e3779b9 + v.getSymbolicVariable().getId() * 0x7f4a7c15) & 0xffffffff)
+            self.assertEqual(a.evaluate(), b.evaluate())
+
+    def test_identities(self):
+        x, y = self.x, self.y
+        self.assertEqual(str(self.ctx.simplifyMba((x ^ y) + 2 * (x & y))), "(bvadd SymVar_0 SymVar_1)")
+        self.assertEqual(str(self.ctx.simplifyMba((x | y) - (x & y))), "(bvxor SymVar_0 SymVar_1)")
+        self.assertEqual(str(self.ctx.simplifyMba((x + y) - ((x & y) << 1))), "(bvxor SymVar_0 SymVar_1)")
+        self.assertEqual(str(self.ctx.simplifyMba(~(~x & ~y))), "(bvor SymVar_0 SymVar_1)")
+        self.assertEqual(str(self.ctx.simplifyMba(((x | y) << 1) - (x ^ y) - x - y + ~x + 1)), "(bvneg SymVar_0)")
+        self.assertEqual(str(self.ctx.simplifyMba(-x - 1)), "(bvnot SymVar_0)")
+        self.assertEqual(str(self.ctx.simplifyMba(x * 3 - x - x)), "SymVar_0")
+
+    def test_coefficients(self):
+        x, y, z = self.x, self.y, self.z
+        n = 3 * (x & ~y) + 3 * (x & y) - 2 * (x | z) + 2 * (z & ~x) + 0x1234
+        self.assertEqual(str(self.ctx.simplifyMba(n)), "(bvadd SymVar_0 (_ bv4660 32))")
+        n = 7 * (x & ~y) - 3 * (~(x | z)) + 5 * (x ^ y ^ z) - 11 * (y & z) + 0x1234
+        self.assertEquivalent(n, self.ctx.simplifyMba(n))
+
+    def test_atoms(self):
+        # Any subexpression which is not linear is an atom, equal atoms are the same variable
+        x, y, z = self.x, self.y, self.z
+        self.assertEqual(str(self.ctx.simplifyMba((x * y) + ((x * y) ^ z) - ((x * y) | z) + ((x * y) & z))), "(bvmul SymVar_0 SymVar_1)")
+        self.assertEqual(str(self.ctx.simplifyMba((x ^ 0xff) + 2 * (x & 0xff))), "(bvadd SymVar_0 (_ bv255 32))")
+        n = self.ast.extract(15, 0, (x ^ y) + 2 * (x & y))
+        self.assertEqual(str(self.ctx.simplifyMba(n)), "((_ extract 15 0) (bvadd SymVar_0 SymVar_1))")
+
+    def test_chain(self):
+        x, y = self.x, self.y
+        n = x
+        for i in range(1000):
+            n = ((n ^ y) + 2 * (n & y)) - y
+        self.assertEqual(str(self.ctx.simplifyMba(n)), "SymVar_0")
+
+    def test_many_atoms(self):
+        # Sums over too many atoms are split into smaller ones
+        x = self.x
+        n = self.ast.bv(0, 32)
+        for i in range(10):
+            v = self.ast.variable(self.ctx.newSymbolicVariable(32))
+            n = n + (((v ^ x) + 2 * (v & x)) - x)
+        s = self.ctx.simplifyMba(n)
+        self.assertEqual(str(s.getChildren()[1]), "SymVar_12")
+
+    def test_unmodified(self):
+        x, y = self.x, self.y
+        n = (x ^ y) + 2 * (x & y)
+        self.assertEqual(str(self.ctx.simplifyMba(x * y)), "(bvmul SymVar_0 SymVar_1)")
+        self.assertEqual(str(self.ctx.simplifyMba(x + y)), "(bvadd SymVar_0 SymVar_1)")
+        self.ctx.simplifyMba(n)
+        self.assertEqual(str(n), "(bvadd (bvxor SymVar_0 SymVar_1) (bvmul (_ bv2 32) (bvand SymVar_0 SymVar_1)))")
+        with self.assertRaises(TypeError):
+            self.ctx.simplifyMba(1)
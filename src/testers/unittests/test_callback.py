@@ -72,3 +72,50 @@ class TestCallback(unittest.TestCase):
         self.Triton.addCallback(CALLBACK.GET_CONCRETE_MEMORY_VALUE, self.method_callback)
         self.Triton.removeCallback(CALLBACK.GET_CONCRETE_MEMORY_VALUE, self.method_callback)
         self.assertTrue(cb_initial_refcnt == sys.getrefcount(cb))
+
+    def test_memory_area_callbacks(self):
+        self.Triton = TritonContext()
+        self.Triton.setArchitecture(ARCH.X86_64)
+        loads = []
+        stores = []
+        bytes_loaded = []
+
+        def lazy_load(ctx, addr, size):
+            loads.append((addr, size))
+            ctx.setConcreteMemoryAreaValue(0x1000, b"\x11" * 0x100)
+
+        def store(ctx, addr, values):
+            stores.append((addr, values))
+
+        def load_byte(ctx, mem):
+            bytes_loaded.append(mem.getAddress())
+
+        self.Triton.addCallback(CALLBACK.GET_CONCRETE_MEMORY_AREA_VALUE, lazy_load, 0x1000, 0x100)
+        self.Triton.addCallback(CALLBACK.SET_CONCRETE_MEMORY_AREA_VALUE, store, 0x1000, 0x100)
+        self.Triton.addCallback(CALLBACK.GET_CONCRETE_MEMORY_VALUE, load_byte, 0x2000, 1)
+
+        # One call for the whole area
+        self.assertEqual(self.Triton.getConcreteMemoryAreaValue(0xff0, 0x20), b"\x00" * 0x10 + b"\x11" * 0x10)
+        self.assertEqual(loads, [(0xff0, 0x20)])
+        self.assertEqual(stores, [(0x1000, b"\x11" * 0x100)])
+
+        # Out of the watched ranges
+        self.Triton.getConcreteMemoryAreaValue(0x3000, 0x100)
+        self.Triton.setConcreteMemoryAreaValue(0x3000, b"\x22" * 0x10)
+        self.assertEqual(len(loads), 1)
+        self.assertEqual(len(stores), 1)
+        self.assertEqual(bytes_loaded, [])
+
+        # Per-byte callbacks are only fired on watched bytes
+        self.Triton.getConcreteMemoryAreaValue(0x1ff0, 0x20)
+        self.assertEqual(bytes_loaded, [0x2000])
+
+        self.Triton.setConcreteMemoryAreaValue(0x10fe, b"\x33\x44\x55")
+        self.assertEqual(stores[-1], (0x10fe, b"\x33\x44\x55"))
+
+        self.Triton.removeCallback(CALLBACK.GET_CONCRETE_MEMORY_AREA_VALUE, lazy_load)
+        self.Triton.getConcreteMemoryAreaValue(0x1000, 1)
+        self.assertEqual(len(loads), 1)
+
+        with self.assertRaises(TypeError):
+            self.Triton.addCallback(CALLBACK.GET_CONCRETE_REGISTER_VALUE, self.cb_flag, 0x1000, 0x10)
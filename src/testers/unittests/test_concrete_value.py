@@ -2,9 +2,11 @@
 # coding: utf-8
 """Test architectures."""
 
+import os
+import tempfile
 import unittest
 
-from triton import ARCH, TritonContext
+from triton import ARCH, CPUSIZE, MemoryAccess, TritonContext
 
 
 class TestX86ConcreteRegisterValue(unittest.TestCase):
@@ -176,3 +178,134 @@ class TestX8664ConcreteMemoryValue(unittest.TestCase):
         self.Triton.setConcreteMemoryAreaValue(0x1000, b"\x11\x22\x33\x44\x55\x66")
         self.Triton.setConcreteMemoryAreaValue(0x1006, [0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc])
         self.assertEqual(self.Triton.getConcreteMemoryAreaValue(0x1000, 12), b"\x11\x22\x33\x44\x55\x66\x77\x88\x99\xaa\xbb\xcc")
+
+class TestConcreteMemoryBuffer(unittest.TestCase):
+
+    """Testing the buffer protocol and mapped areas."""
+
+    def setUp(self):
+        """Define the arch."""
+        self.Triton = TritonContext()
+        self.Triton.setArchitecture(ARCH.X86_64)
+
+    def test_buffers(self):
+        data = bytes(bytearray(range(256))) * 64
+        self.Triton.setConcreteMemoryAreaValue(0x10ff0, memoryview(data))
+        self.assertEqual(self.Triton.getConcreteMemoryAreaValue(0x10ff0, len(data)), data)
+        self.Triton.setConcreteMemoryAreaValue(0x20000, bytearray(b"\x01\x02"))
+        self.assertEqual(self.Triton.getConcreteMemoryValue(0x20001), 2)
+
+        out = bytearray(8)
+        self.assertIsNone(self.Triton.getConcreteMemoryAreaValue(0x1ffff, out))
+        self.assertEqual(out, bytearray(b"\x00\x01\x02\x00\x00\x00\x00\x00"))
+
+        with self.assertRaises(BufferError):
+            self.Triton.getConcreteMemoryAreaValue(0x1000, b"read only")
+
+    def test_mapped_area(self):
+        data = bytearray(b"\x11\x22\x33\x44\x55\x66\x77\x88")
+        self.Triton.setConcreteMemoryValue(0x4000, 0xff)
+        self.Triton.mapConcreteMemoryArea(0x4000, data)
+        self.assertEqual(self.Triton.getMappedConcreteMemoryAreas(), {0x4000: 8})
+
+        # Mapped bytes are read in place
+        self.assertEqual(self.Triton.getConcreteMemoryAreaValue(0x3fff, 10), b"\x00\x11\x22\x33\x44\x55\x66\x77\x88\x00")
+        self.assertTrue(self.Triton.isConcreteMemoryValueDefined(0x4000, 8))
+        data[1] = 0xbb
+        self.assertEqual(self.Triton.getConcreteMemoryValue(0x4001), 0xbb)
+
+        # Writes do not modify the buffer
+        self.Triton.setConcreteMemoryValue(0x4002, 0xcc)
+        self.assertEqual(self.Triton.getConcreteMemoryValue(0x4002), 0xcc)
+        self.assertEqual(data[2], 0x33)
+
+        self.Triton.clearConcreteMemoryValue(0x4003, 1)
+        self.assertFalse(self.Triton.isConcreteMemoryValueDefined(0x4003, 1))
+        self.assertEqual(self.Triton.getConcreteMemoryValue(0x4003), 0)
+
+        # Snapshots share the area
+        sid = self.Triton.takeSnapshot()
+        self.Triton.setConcreteMemoryValue(0x4004, 0)
+        self.Triton.restoreSnapshot(sid)
+        self.assertEqual(self.Triton.getConcreteMemoryValue(0x4004), 0x55)
+
+        # A rollback restores the overlay, partly defined ranges included
+        cp = self.Triton.checkpoint()
+        self.Triton.setConcreteMemoryAreaValue(0x4000, b"\xaa" * 8)
+        self.Triton.clearConcreteMemoryValue(0x4005, 2)
+        self.Triton.rollback(cp)
+        self.assertEqual(self.Triton.getConcreteMemoryAreaValue(0x4000, 8), b"\x11\xbb\xcc\x00\x55\x66\x77\x88")
+        self.assertFalse(self.Triton.isConcreteMemoryValueDefined(0x4003, 1))
+        self.assertTrue(self.Triton.isConcreteMemoryValueDefined(0x4005, 2))
+        self.Triton.clearCheckpoints()
+
+        with self.assertRaises(TypeError):
+            self.Triton.mapConcreteMemoryArea(0x4007, b"\x00\x00")
+
+        self.Triton.unmapConcreteMemoryArea(0x4000)
+        self.assertEqual(self.Triton.getMappedConcreteMemoryAreas(), {})
+        self.assertFalse(self.Triton.isConcreteMemoryValueDefined(0x4000, 1))
+        self.assertFalse(self.Triton.isConcreteMemoryValueDefined(0x4002, 1))
+
+        with self.assertRaises(TypeError):
+            self.Triton.unmapConcreteMemoryArea(0x4000)
+
+    def test_mapped_area_rollback(self):
+        big = bytearray(0x200000)
+        self.Triton.setConcreteMemoryValue(0x100000, 0x42)
+        self.Triton.symbolizeMemory(MemoryAccess(0x100010, CPUSIZE.DWORD))
+        self.Triton.symbolizeMemory(MemoryAccess(0x400000, CPUSIZE.BYTE))
+
+        # Mapping concretizes the overlapped symbolic bytes only
+        cp = self.Triton.checkpoint()
+        self.Triton.mapConcreteMemoryArea(0x100000, big)
+        self.assertEqual(self.Triton.getConcreteMemoryValue(0x100000), 0)
+        self.assertFalse(self.Triton.isMemorySymbolized(MemoryAccess(0x100010, CPUSIZE.DWORD)))
+        self.assertTrue(self.Triton.isMemorySymbolized(0x400000))
+
+        # A rollback unmaps the area and restores what it covered
+        self.Triton.rollback(cp)
+        self.assertEqual(self.Triton.getMappedConcreteMemoryAreas(), {})
+        self.assertEqual(self.Triton.getConcreteMemoryValue(0x100000), 0x42)
+        self.assertTrue(self.Triton.isMemorySymbolized(MemoryAccess(0x100010, CPUSIZE.DWORD)))
+
+        # And maps again an unmapped area
+        self.Triton.mapConcreteMemoryArea(0x100000, big)
+        cp = self.Triton.checkpoint()
+        self.Triton.unmapConcreteMemoryArea(0x100000)
+        self.Triton.rollback(cp)
+        self.assertEqual(self.Triton.getMappedConcreteMemoryAreas(), {0x100000: 0x200000})
+        self.Triton.clearCheckpoints()
+
+    def test_mapped_file(self):
+        data = bytes(bytearray(range(256))) * 32
+        fd, path = tempfile.mkstemp()
+        try:
+            with os.fdopen(fd, "wb") as f:
+                f.write(data)
+
+            # The offset does not need to be aligned on a page
+            self.Triton.mapConcreteMemoryFile(0x400000, path, 0x1001, 0x100)
+            self.assertEqual(self.Triton.getMappedConcreteMemoryAreas(), {0x400000: 0x100})
+            self.assertEqual(self.Triton.getConcreteMemoryAreaValue(0x400000, 0x100), data[0x1001:0x1101])
+
+            self.Triton.setConcreteMemoryValue(0x400000, 0xaa)
+            self.assertEqual(self.Triton.getConcreteMemoryValue(0x400000), 0xaa)
+            self.Triton.unmapConcreteMemoryArea(0x400000)
+
+            # The whole file, writes do not modify it
+            self.Triton.mapConcreteMemoryFile(0x600000, path)
+            self.assertEqual(self.Triton.getConcreteMemoryAreaValue(0x600000, len(data)), data)
+            self.Triton.setConcreteMemoryAreaValue(0x600010, b"\xff" * 16)
+            self.Triton.unmapConcreteMemoryArea(0x600000)
+            with open(path, "rb") as f:
+                self.assertEqual(f.read(), data)
+
+            with self.assertRaises(TypeError):
+                self.Triton.mapConcreteMemoryFile(0x800000, path, len(data) + 1)
+            with self.assertRaises(TypeError):
+                self.Triton.mapConcreteMemoryFile(0x800000, path, 0x10, 0xffffffffffffffff)
+            with self.assertRaises(TypeError):
+                self.Triton.mapConcreteMemoryFile(0x800000, path + ".missing")
+        finally:
+            os.remove(path)
@@ -4,6 +4,8 @@
 
 import unittest
 import os
+import struct
+import tempfile
 
 from triton import (Instruction, ARCH, CPUSIZE, MemoryAccess, MODE,
                     TritonContext, REG)
@@ -374,6 +376,26 @@ class Emu1(object):
         self.assertEqual(rdx, 0x4d2)
         self.assertEqual(rsi, 0x3669000000000000)
 
+    def test_run(self):
+        """Run the same simulation with the native loop."""
+        dump = os.path.join(os.path.dirname(__file__), "misc", "emu_1.dump")
+        with open(dump) as f:
+            regs, mems = eval(f.read())
+
+        for mem in mems:
+            if mem['memory'] is not None:
+                self.Triton.setConcreteMemoryAreaValue(mem['start'], bytearray(mem['memory']))
+
+        for reg_name in ("rax", "rbx", "rcx", "rdx", "rdi", "rsi", "rbp",
+                         "rsp", "rip", "r8", "r9", "r10", "r11", "r12", "r13",
+                         "r14", "eflags"):
+            self.Triton.setConcreteRegisterValue(self.Triton.getRegister(getattr(REG.X86_64, reg_name.upper())), regs[reg_name])
+
+        pc = self.Triton.run(regs["rip"], 0, [0x409A18])
+        self.assertEqual(pc, 0x409A18)
+        self.assertEqual(self.Triton.getConcreteRegisterValue(self.Triton.registers.rdx), 0x4d2)
+        self.assertEqual(self.Triton.getConcreteRegisterValue(self.Triton.registers.rsi), 0x3669000000000000)
+
 
 class BaseTestSimulation(DefCamp2015, SeedCoverage, Emu1):
 
@@ -510,3 +532,181 @@ class TestSymbolicEngineConstantFolding(BaseTestSimulation, unittest.TestCase):
         self.Triton.setArchitecture(ARCH.X86_64)
         self.Triton.setMode(MODE.CONSTANT_FOLDING, True)
         super(TestSymbolicEngineConstantFolding, self).setUp()
+
+
+class TestRun(unittest.TestCase):
+
+    """Testing stop addresses and hooks of the native loop."""
+
+    def setUp(self):
+        """Define the arch."""
+        self.Triton = TritonContext()
+        self.Triton.setArchitecture(ARCH.X86_64)
+
+    def test_hooks(self):
+        calls = []
+
+        def redirect(ctx, pc):
+            calls.append(pc)
+            ctx.setConcreteRegisterValue(ctx.registers.rip, 0x2000)
+            return False
+
+        def stop(ctx, pc):
+            calls.append(pc)
+            return True
+
+        def fail(ctx, pc):
+            raise ValueError("from hook")
+
+        self.assertEqual(self.Triton.run(0x1000, 0, [0x1000]), 0x1000)
+        self.assertEqual(self.Triton.run(0x1000, 0, [0x2000], {0x1000: redirect}), 0x2000)
+        self.assertEqual(self.Triton.run(0x1000, 0, [], {0x1000: redirect, 0x2000: stop}), 0x2000)
+        self.assertEqual(calls, [0x1000, 0x1000, 0x2000])
+        self.assertEqual(self.Triton.getConcreteRegisterValue(self.Triton.registers.rip), 0x2000)
+
+        # Redirections count against the instruction limit
+        def back(ctx, pc):
+            ctx.setConcreteRegisterValue(ctx.registers.rip, 0x1000)
+            return False
+        del calls[:]
+        self.assertEqual(self.Triton.run(0x1000, 5, None, {0x1000: redirect, 0x2000: back}), 0x2000)
+        self.assertEqual(calls, [0x1000, 0x1000, 0x1000])
+
+        with self.assertRaises(ValueError):
+            self.Triton.run(0x3000, 0, None, {0x3000: fail})
+
+        with self.assertRaises(TypeError):
+            self.Triton.run(0x3000, 0, None, {0x3000: 1})
+
+
+class TestTraceReplay(unittest.TestCase):
+
+    """Testing the replay of an execution trace."""
+
+    def setUp(self):
+        """Define the arch."""
+        self.Triton = TritonContext()
+        self.Triton.setArchitecture(ARCH.X86_64)
+        fd, self.path = tempfile.mkstemp()
+        os.close(fd)
+
+    def tearDown(self):
+        os.remove(self.path)
+
+    def record(self, kind, payload):
+        return struct.pack('<BI', kind, len(payload)) + payload
+
+    def sync(self, values):
+        payload = struct.pack('<II', 0, len(values))
+        for reg, value in values:
+            payload += struct.pack('<IBQ', reg.getId(), 8, value)
+        return self.record(1, payload)
+
+    def inst(self, pc, opcode, reads=[]):
+        payload = struct.pack('<QIB', pc, 0, len(opcode)) + opcode + struct.pack('<I', len(reads))
+        for addr, data in reads:
+            payload += struct.pack('<QI', addr, len(data)) + data
+        return self.record(2, payload)
+
+    def write(self, addr, data):
+        return self.record(3, struct.pack('<QI', addr, len(data)) + data)
+
+    def save(self, records):
+        with open(self.path, 'wb') as f:
+            f.write(b'TRTC' + struct.pack('<II', 1, ARCH.X86_64) + b''.join(records))
+
+    def test_replay(self):
+        regs = self.Triton.registers
+        self.save([
+            self.sync([(regs.rax, 5), (regs.rbx, 0x1000), (regs.rip, 0x400000)]),
+            self.inst(0x400000, b"\x48\x03\x03", [(0x1000, struct.pack('<Q', 7))]),  # add rax, [rbx]
+            self.inst(0x400003, b"\x48\x89\x03"),                                    # mov [rbx], rax
+            self.write(0x1000, struct.pack('<Q', 12)),
+            self.inst(0x400006, b"\x48\xff\xc0"),                                    # inc rax
+        ])
+        self.assertEqual(self.Triton.replayTrace(self.path), 3)
+        self.assertEqual(self.Triton.getConcreteRegisterValue(regs.rax), 13)
+        self.assertEqual(self.Triton.getConcreteMemoryValue(MemoryAccess(0x1000, CPUSIZE.QWORD)), 12)
+
+    def test_symbolic(self):
+        regs = self.Triton.registers
+        self.Triton.setConcreteMemoryValue(MemoryAccess(0x1000, CPUSIZE.QWORD), 7)
+        var = self.Triton.symbolizeMemory(MemoryAccess(0x1000, CPUSIZE.QWORD))
+        self.save([
+            self.sync([(regs.rax, 5), (regs.rbx, 0x1000), (regs.rip, 0x400000)]),
+            self.inst(0x400000, b"\x48\x03\x03", [(0x1000, struct.pack('<Q', 7))]),  # add rax, [rbx]
+            self.inst(0x400003, b"\x48\x89\x03"),                                    # mov [rbx], rax
+            self.write(0x1000, struct.pack('<Q', 12)),
+            self.inst(0x400006, b"\x48\xff\xc0"),                                    # inc rax
+            self.sync([(regs.rax, 13)]),
+        ])
+        self.assertEqual(self.Triton.replayTrace(self.path), 3)
+
+        # The symbolic input flows through the loads, the stores and the sync points
+        astCtxt = self.Triton.getAstContext()
+        self.assertEqual(self.Triton.getConcreteRegisterValue(regs.rax), 13)
+        self.assertIn(var.getName(), str(astCtxt.unroll(self.Triton.getSymbolicRegister(regs.rax).getAst())))
+        self.assertTrue(self.Triton.isMemorySymbolized(MemoryAccess(0x1000, CPUSIZE.QWORD)))
+        self.assertIn(var.getName(), str(astCtxt.unroll(self.Triton.getMemoryAst(MemoryAccess(0x1000, CPUSIZE.QWORD)))))
+
+    def test_sync(self):
+        regs = self.Triton.registers
+        self.Triton.setConcreteRegisterValue(regs.rax, 5)
+        self.Triton.symbolizeRegister(regs.rax)
+        self.Triton.symbolizeMemory(MemoryAccess(0x1000, CPUSIZE.BYTE))
+
+        # Agreeing values keep the symbolic state, writes only update the concrete one
+        self.save([self.sync([(regs.rax, 5), (regs.rbx, 2)]), self.write(0x1000, b"\x11")])
+        self.assertEqual(self.Triton.replayTrace(self.path), 0)
+        self.assertTrue(self.Triton.isRegisterSymbolized(regs.rax))
+        self.assertTrue(self.Triton.isMemorySymbolized(0x1000))
+        self.assertEqual(self.Triton.getConcreteMemoryValue(0x1000), 0x11)
+        self.assertEqual(self.Triton.getConcreteRegisterValue(regs.rbx), 2)
+
+        # A diverging register is concretized
+        self.save([self.sync([(regs.rax, 6)])])
+        self.Triton.replayTrace(self.path)
+        self.assertFalse(self.Triton.isRegisterSymbolized(regs.rax))
+        self.assertEqual(self.Triton.getConcreteRegisterValue(regs.rax), 6)
+
+    def test_chunks(self):
+        regs = self.Triton.registers
+        self.save([
+            self.sync([(regs.rax, 1), (regs.rbx, 2)]),
+            self.write(0x1000, b"\x11"),
+            self.sync([(regs.rax, 3)]),
+            self.write(0x2000, b"\x22"),
+        ])
+        points = self.Triton.getTraceSyncPoints(self.path)
+        self.assertEqual(len(points), 2)
+
+        self.assertEqual(self.Triton.replayTrace(self.path, points[0], points[1]), 0)
+        self.assertEqual(self.Triton.getConcreteRegisterValue(regs.rax), 1)
+        self.assertEqual(self.Triton.getConcreteRegisterValue(regs.rbx), 2)
+        self.assertEqual(self.Triton.getConcreteMemoryValue(0x1000), 0x11)
+        self.assertFalse(self.Triton.isConcreteMemoryValueDefined(0x2000, 1))
+
+        ctx = TritonContext(ARCH.X86_64)
+        ctx.replayTrace(self.path, points[1])
+        self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.rax), 3)
+        self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.rbx), 0)
+        self.assertEqual(ctx.getConcreteMemoryValue(0x2000), 0x22)
+        self.assertFalse(ctx.isConcreteMemoryValueDefined(0x1000, 1))
+
+    def test_invalid(self):
+        self.save([])
+        self.assertEqual(self.Triton.getTraceSyncPoints(self.path), [])
+        self.assertEqual(self.Triton.replayTrace(self.path), 0)
+
+        with self.assertRaises(TypeError):
+            TritonContext(ARCH.AARCH64).replayTrace(self.path)
+
+        with open(self.path, 'wb') as f:
+            f.write(b'NOPE')
+
+        with self.assertRaises(TypeError):
+            self.Triton.replayTrace(self.path)
+
+        self.save([self.record(1, b'\x00')])
+        with self.assertRaises(TypeError):
+            self.Triton.replayTrace(self.path)
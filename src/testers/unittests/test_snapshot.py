@@ -0,0 +1,215 @@
+#!/usr/bin/env python
+# coding: utf-8
+"""Test Snapshot."""
+
+import unittest
+
+from triton import *
+
+
+class TestSnapshot(unittest.TestCase):
+
+    """Testing the snapshot engine."""
+
+    def setUp(self):
+        """Define the arch."""
+        self.ctx = TritonContext()
+        self.ctx.setArchitecture(ARCH.X86_64)
+
+    def test_concrete_state(self):
+        """Check restoring registers and memory."""
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rax, 0x1234)
+        self.ctx.setConcreteMemoryAreaValue(0x1000, b"\x11\x22\x33\x44")
+
+        sid = self.ctx.takeSnapshot()
+
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rax, 0x5678)
+        self.ctx.setConcreteMemoryValue(0x1001, 0xff)
+        self.ctx.setConcreteMemoryValue(0x9000, 0xaa)
+        self.ctx.clearConcreteMemoryValue(0x1003, 1)
+
+        self.ctx.restoreSnapshot(sid)
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rax), 0x1234)
+        self.assertEqual(self.ctx.getConcreteMemoryAreaValue(0x1000, 4), b"\x11\x22\x33\x44")
+        self.assertFalse(self.ctx.isConcreteMemoryValueDefined(0x9000, 1))
+        self.assertTrue(self.ctx.isConcreteMemoryValueDefined(0x1003, 1))
+
+        # A snapshot can be restored several times
+        self.ctx.setConcreteMemoryValue(0x1000, 0x00)
+        self.ctx.restoreSnapshot(sid)
+        self.assertEqual(self.ctx.getConcreteMemoryValue(0x1000), 0x11)
+
+    def test_symbolic_state(self):
+        """Check restoring symbolic variables, expressions and path constraints."""
+        self.ctx.symbolizeMemory(MemoryAccess(0x2000, CPUSIZE.QWORD))
+        sid = self.ctx.takeSnapshot()
+        nvars = len(self.ctx.getSymbolicVariables())
+        nexprs = len(self.ctx.getSymbolicExpressions())
+
+        self.ctx.symbolizeRegister(self.ctx.registers.rbx)
+        self.ctx.concretizeMemory(0x2000)
+        self.ctx.pushPathConstraint(self.ctx.getAstContext().equal(self.ctx.getRegisterAst(self.ctx.registers.rbx), self.ctx.getAstContext().bv(1, 64)))
+
+        self.ctx.restoreSnapshot(sid)
+        self.assertEqual(len(self.ctx.getSymbolicVariables()), nvars)
+        self.assertEqual(len(self.ctx.getSymbolicExpressions()), nexprs)
+        self.assertEqual(self.ctx.getPathPredicateSize(), 0)
+        self.assertTrue(self.ctx.isMemorySymbolized(MemoryAccess(0x2000, CPUSIZE.QWORD)))
+        self.assertFalse(self.ctx.isRegisterSymbolized(self.ctx.registers.rbx))
+
+    def test_variable_values(self):
+        """Check that the evaluation of the nodes follows the restored values."""
+        var = self.ctx.newSymbolicVariable(32)
+        x = self.ctx.getAstContext().variable(var)
+        e = x + 1
+        sid = self.ctx.takeSnapshot()
+
+        self.ctx.setConcreteVariableValue(var, 5)
+        self.assertEqual(e.evaluate(), 6)
+
+        self.ctx.restoreSnapshot(sid)
+        self.assertEqual(self.ctx.getConcreteVariableValue(var), 0)
+        self.assertEqual(x.evaluate(), 0)
+        self.assertEqual(e.evaluate(), 1)
+
+    def test_shared_expressions(self):
+        """Check that expressions are shared with the snapshot."""
+        astCtxt = self.ctx.getAstContext()
+        expr = self.ctx.newSymbolicExpression(astCtxt.bv(1, 64))
+        self.ctx.assignSymbolicExpressionToRegister(expr, self.ctx.registers.rax)
+        sid = self.ctx.takeSnapshot()
+
+        self.ctx.assignSymbolicExpressionToRegister(self.ctx.newSymbolicExpression(astCtxt.bv(3, 64)), self.ctx.registers.rax)
+        expr.setAst(astCtxt.bv(2, 64))
+
+        # The assignment is restored, not the change made in place
+        self.ctx.restoreSnapshot(sid)
+        self.assertEqual(self.ctx.getSymbolicRegister(self.ctx.registers.rax).getId(), expr.getId())
+        self.assertEqual(self.ctx.getSymbolicRegister(self.ctx.registers.rax).getAst().evaluate(), 2)
+
+    def test_taint_state(self):
+        """Check restoring the taint."""
+        self.ctx.taintMemory(0x3000)
+        self.ctx.taintRegister(self.ctx.registers.rcx)
+        sid = self.ctx.takeSnapshot()
+
+        self.ctx.untaintMemory(0x3000)
+        self.ctx.untaintRegister(self.ctx.registers.rcx)
+        self.ctx.taintMemory(0x4000)
+
+        self.ctx.restoreSnapshot(sid)
+        self.assertTrue(self.ctx.isMemoryTainted(0x3000))
+        self.assertFalse(self.ctx.isMemoryTainted(0x4000))
+        self.assertTrue(self.ctx.isRegisterTainted(self.ctx.registers.rcx))
+
+    def test_snapshots(self):
+        """Check snapshot ids."""
+        self.assertEqual(self.ctx.getNumberOfSnapshots(), 0)
+        sid1 = self.ctx.takeSnapshot()
+        sid2 = self.ctx.takeSnapshot()
+        self.assertNotEqual(sid1, sid2)
+        self.assertEqual(self.ctx.getNumberOfSnapshots(), 2)
+
+        self.ctx.removeSnapshot(sid1)
+        self.assertFalse(self.ctx.isSnapshot(sid1))
+        self.assertTrue(self.ctx.isSnapshot(sid2))
+
+        with self.assertRaises(Exception):
+            self.ctx.restoreSnapshot(sid1)
+
+        # Snapshots do not survive a new architecture
+        self.ctx.setArchitecture(ARCH.X86)
+        self.assertFalse(self.ctx.isSnapshot(sid2))
+
+
+class TestCheckpoint(unittest.TestCase):
+
+    """Testing checkpoints and rollbacks."""
+
+    def setUp(self):
+        """Define the arch."""
+        self.ctx = TritonContext()
+        self.ctx.setArchitecture(ARCH.X86_64)
+
+    def test_rollback(self):
+        """Check reverting concrete, symbolic and taint changes."""
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rax, 0x1122334455667788)
+        self.ctx.setConcreteMemoryValue(0x1000, 0x11)
+        self.ctx.taintRegister(self.ctx.registers.rcx)
+        self.ctx.symbolizeMemory(MemoryAccess(0x2000, CPUSIZE.DWORD))
+        nexprs = len(self.ctx.getSymbolicExpressions())
+
+        cp = self.ctx.checkpoint()
+
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.al, 0xff)
+        self.ctx.setConcreteMemoryAreaValue(0x1000, b"\xaa\xbb")
+        self.ctx.untaintRegister(self.ctx.registers.rcx)
+        self.ctx.taintMemory(MemoryAccess(0x3000, CPUSIZE.WORD))
+        self.ctx.symbolizeRegister(self.ctx.registers.rdx)
+        self.ctx.concretizeMemory(MemoryAccess(0x2000, CPUSIZE.DWORD))
+        self.ctx.pushPathConstraint(self.ctx.getAstContext().equal(self.ctx.getRegisterAst(self.ctx.registers.rdx), self.ctx.getAstContext().bv(0, 64)))
+
+        self.ctx.rollback(cp)
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rax), 0x1122334455667788)
+        self.assertEqual(self.ctx.getConcreteMemoryValue(0x1000), 0x11)
+        self.assertFalse(self.ctx.isConcreteMemoryValueDefined(0x1001, 1))
+        self.assertTrue(self.ctx.isRegisterTainted(self.ctx.registers.rcx))
+        self.assertFalse(self.ctx.isMemoryTainted(MemoryAccess(0x3000, CPUSIZE.WORD)))
+        self.assertFalse(self.ctx.isRegisterSymbolized(self.ctx.registers.rdx))
+        self.assertTrue(self.ctx.isMemorySymbolized(MemoryAccess(0x2000, CPUSIZE.DWORD)))
+        self.assertEqual(len(self.ctx.getSymbolicExpressions()), nexprs)
+        self.assertEqual(self.ctx.getPathPredicateSize(), 0)
+
+        # The id of the reverted variable is reused
+        var = self.ctx.symbolizeMemory(MemoryAccess(0x5000, CPUSIZE.BYTE))
+        self.assertEqual(self.ctx.getMemoryAst(MemoryAccess(0x5000, CPUSIZE.BYTE)).getBitvectorSize(), 8)
+        self.assertEqual(str(self.ctx.getAstContext().variable(var)), var.getName())
+
+    def test_variable_values(self):
+        """Check reverting the values of symbolic variables."""
+        var = self.ctx.symbolizeRegister(self.ctx.registers.rbx)
+        x = self.ctx.getAstContext().variable(var)
+        self.ctx.setConcreteVariableValue(var, 5)
+
+        cp = self.ctx.checkpoint()
+        self.ctx.setConcreteVariableValue(var, 7)
+        self.ctx.setConcreteVariableValue(var, 9)
+        self.assertEqual(x.evaluate(), 9)
+
+        self.ctx.rollback(cp)
+        self.assertEqual(self.ctx.getConcreteVariableValue(var), 5)
+        self.assertEqual(x.evaluate(), 5)
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rbx), 5)
+
+        # A variable created and changed after the checkpoint is removed
+        var = self.ctx.newSymbolicVariable(8)
+        y = self.ctx.getAstContext().variable(var)
+        self.ctx.setConcreteVariableValue(var, 3)
+        self.ctx.rollback(cp)
+        self.assertEqual(len(self.ctx.getSymbolicVariables()), 1)
+
+    def test_nested(self):
+        """Check nested checkpoints."""
+        cp1 = self.ctx.checkpoint()
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rbx, 1)
+        cp2 = self.ctx.checkpoint()
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rbx, 2)
+        self.assertEqual(self.ctx.getNumberOfCheckpoints(), 2)
+
+        self.ctx.rollback(cp2)
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rbx), 1)
+
+        # The same checkpoint can be rolled back several times
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rbx, 3)
+        self.ctx.rollback(cp2)
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rbx), 1)
+
+        self.ctx.rollback(cp1)
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rbx), 0)
+        self.assertEqual(self.ctx.getNumberOfCheckpoints(), 1)
+
+        with self.assertRaises(Exception):
+            self.ctx.rollback(cp2)
+
+        self.ctx.clearCheckpoints()
+        self.assertEqual(self.ctx.getNumberOfCheckpoints(), 0)
@@ -4,7 +4,7 @@
 
 import unittest
 
-from triton import ARCH, Instruction, CPUSIZE, MemoryAccess, Immediate, TritonContext
+from triton import ARCH, AST_NODE, Instruction, CPUSIZE, MemoryAccess, Immediate, MODE, TritonContext
 
 
 class TestSymbolic(unittest.TestCase):
@@ -89,6 +89,77 @@ class TestSymbolic(unittest.TestCase):
             # Incorrect size
             self.Triton.assignSymbolicExpressionToRegister(expr1, self.Triton.registers.rax)
 
+    def test_slicing(self):
+        """Check the slices against a walk of the unrolled ASTs."""
+        a = self.astCtxt
+        x = a.variable(self.Triton.newSymbolicVariable(64))
+        exprs = [self.Triton.newSymbolicExpression(x)]
+        for i in range(200):
+            ref1 = a.reference(exprs[i * 7 % len(exprs)])
+            ref2 = a.reference(exprs[i * 13 % len(exprs)])
+            exprs.append(self.Triton.newSymbolicExpression(a.bvadd(a.bvxor(ref1, ref2), a.bvmul(ref1, a.bv(i, 64)))))
+
+        def reference(expr):
+            ids = {expr.getId()}
+            worklist = [expr.getAst()]
+            while worklist:
+                node = worklist.pop()
+                if node.getType() == AST_NODE.REFERENCE:
+                    sub = node.getSymbolicExpression()
+                    if sub.getId() not in ids:
+                        ids.add(sub.getId())
+                        worklist.append(sub.getAst())
+                    continue
+                worklist.extend(node.getChildren())
+            return ids
+
+        deps = [e.getId() for e in exprs[-1].getDependencies()]
+        self.assertEqual(deps, sorted(set(deps)))
+        self.assertEqual(exprs[0].getDependencies(), [])
+
+        for expr in exprs[::17]:
+            self.assertEqual(set(self.Triton.sliceExpressions(expr).keys()), reference(expr))
+        self.assertEqual(set(self.Triton.sliceExpressions([exprs[50], exprs[120]]).keys()), reference(exprs[50]) | reference(exprs[120]))
+        self.assertEqual(self.Triton.sliceExpressions([]), {})
+
+        # The dependencies follow a new AST
+        last = exprs[-1]
+        last.setAst(a.bvadd(a.reference(exprs[3]), a.reference(exprs[3])))
+        self.assertEqual([e.getId() for e in last.getDependencies()], [exprs[3].getId()])
+        self.assertEqual(set(self.Triton.sliceExpressions(last).keys()), reference(last))
+
+        with self.assertRaises(TypeError):
+            self.Triton.sliceExpressions([last, 1])
+        with self.assertRaises(TypeError):
+            self.Triton.sliceExpressions(1)
+
+    def test_trimming(self):
+        """Check the compaction and the trimming of the symbolic expressions."""
+        a = self.astCtxt
+        x = a.variable(self.Triton.newSymbolicVariable(64))
+        base = len(self.Triton.getSymbolicExpressions())
+
+        # The expressions which do not exist anymore
+        for i in range(100):
+            self.Triton.newSymbolicExpression(a.bvadd(x, a.bv(i, 64)))
+        self.assertGreater(self.Triton.compactSymbolicExpressions(), 0)
+        self.assertEqual(len(self.Triton.getSymbolicExpressions()), base)
+
+        # The expressions which are not reachable
+        e1 = self.Triton.newSymbolicExpression(a.bvadd(x, a.bv(1, 64)))
+        e2 = self.Triton.newSymbolicExpression(a.bvmul(a.reference(e1), a.bv(3, 64)))
+        e3 = self.Triton.newSymbolicExpression(a.bvsub(x, a.bv(1, 64)))
+        self.Triton.assignSymbolicExpressionToRegister(e2, self.Triton.registers.rax)
+        self.assertEqual(self.Triton.compactSymbolicExpressions(), 0)
+        self.assertEqual(self.Triton.trimSymbolicExpressions(), 1)
+        self.assertEqual(self.Triton.getSymbolicExpression(e1.getId()).getId(), e1.getId())
+        self.assertEqual(self.Triton.getSymbolicExpression(e2.getId()).getId(), e2.getId())
+        with self.assertRaises(TypeError):
+            self.Triton.getSymbolicExpression(e3.getId())
+        self.assertEqual(str(e3.getAst()), "(bvsub SymVar_0 (_ bv1 64))")
+        self.assertEqual(self.Triton.trimSymbolicExpressions(), 0)
+        self.assertTrue(hasattr(MODE, "TRIM_SYMBOLIC_EXPRESSIONS"))
+
 
 class TestSymbolicBuilding(unittest.TestCase):
 
@@ -130,3 +201,124 @@ class TestSymbolicBuilding(unittest.TestCase):
         node = self.Triton.getRegisterAst(self.Triton.registers.al)
         self.assertEqual(node.evaluate(), 0x88)
         self.assertEqual(node.getBitvectorSize(), CPUSIZE.BYTE_BIT)
+
+
+class TestSerialization(unittest.TestCase):
+
+    """Testing the binary serialization of ASTs, expressions and path constraints."""
+
+    def setUp(self):
+        """Define the arch."""
+        self.Triton = TritonContext()
+        self.Triton.setArchitecture(ARCH.X86_64)
+        self.astCtxt = self.Triton.getAstContext()
+
+        x = self.Triton.newSymbolicVariable(32, "x")
+        vx = self.astCtxt.variable(x)
+        self.Triton.setConcreteVariableValue(x, 0x1234)
+        e1 = self.Triton.newSymbolicExpression(vx * vx + 1, "e1")
+
+        # A DAG whose tree is exponential
+        self.node = self.astCtxt.reference(e1)
+        for i in range(64):
+            self.node = self.node + self.node
+
+        mem = MemoryAccess(0x1000, CPUSIZE.WORD)
+        self.expr = self.Triton.createSymbolicMemoryExpression(Instruction(), self.astCtxt.extract(15, 0, self.node) ^ 0xffff, mem, "e2")
+        self.Triton.pushPathConstraint(self.astCtxt.reference(self.expr) == 0)
+
+    def test_roundtrip(self):
+        data = self.Triton.serializeSymbolic([self.node], [self.expr], self.Triton.getPathConstraints())
+        self.assertLess(len(data), 1024)
+
+        ctx = TritonContext()
+        ctx.setArchitecture(ARCH.X86_64)
+        nodes, exprs, pcs = ctx.deserializeSymbolic(data)
+
+        self.assertEqual(len(nodes), 1)
+        self.assertEqual(nodes[0].evaluate(), self.node.evaluate())
+        self.assertEqual(ctx.printSmtDag(nodes[0]), self.Triton.printSmtDag(self.node))
+
+        self.assertEqual(len(exprs), 1)
+        self.assertEqual(exprs[0].getComment(), self.expr.getComment())
+        self.assertEqual(exprs[0].getOrigin().getAddress(), 0x1000)
+        self.assertEqual(ctx.printSmtDag(exprs[0].getAst()), self.Triton.printSmtDag(self.expr.getAst()))
+
+        self.assertEqual(len(pcs), 1)
+        self.assertEqual(ctx.printSmtDag(pcs[0].getTakenPredicate()), self.Triton.printSmtDag(self.Triton.getPathConstraints()[0].getTakenPredicate()))
+
+        # Variables are created with their values
+        variables = ctx.getSymbolicVariables()
+        self.assertEqual(len(variables), 1)
+        self.assertEqual(variables[0].getAlias(), "x")
+        self.assertEqual(ctx.getConcreteVariableValue(variables[0]), 0x1234)
+
+    def test_same_context(self):
+        data = self.Triton.serializeSymbolic([self.node])
+        nodes, exprs, pcs = self.Triton.deserializeSymbolic(data, True)
+        self.assertEqual(len(self.Triton.getSymbolicVariables()), 1)
+        self.assertEqual(nodes[0].evaluate(), self.node.evaluate())
+        self.assertEqual(exprs, [])
+        self.assertEqual(pcs, [])
+
+        # Without the request, variables are always created
+        nodes, exprs, pcs = self.Triton.deserializeSymbolic(data)
+        self.assertEqual(len(self.Triton.getSymbolicVariables()), 2)
+        self.assertEqual(nodes[0].evaluate(), self.node.evaluate())
+
+    def test_reuse_variables(self):
+        x = self.Triton.getSymbolicVariable("SymVar_0")
+        data = self.Triton.serializeSymbolic([self.astCtxt.variable(x) + 1])
+
+        # Another context whose first variable is unrelated, only the alias matches
+        ctx = TritonContext()
+        ctx.setArchitecture(ARCH.X86_64)
+        y = ctx.newSymbolicVariable(32, "y")
+        x = ctx.newSymbolicVariable(32, "x")
+        vx = ctx.getAstContext().variable(x)
+        ctx.setConcreteVariableValue(x, 7)
+
+        nodes, exprs, pcs = ctx.deserializeSymbolic(data, True)
+        self.assertEqual(len(ctx.getSymbolicVariables()), 2)
+        self.assertEqual(nodes[0].evaluate(), 8)
+
+        # A size mismatch creates a new variable with the saved value
+        ctx = TritonContext()
+        ctx.setArchitecture(ARCH.X86_64)
+        x = ctx.newSymbolicVariable(8, "x")
+        nodes, exprs, pcs = ctx.deserializeSymbolic(data, True)
+        self.assertEqual(len(ctx.getSymbolicVariables()), 2)
+        self.assertEqual(nodes[0].evaluate(), 0x1235)
+
+        with self.assertRaises(TypeError):
+            ctx.deserializeSymbolic(data, 1)
+
+    def test_invalid(self):
+        data = self.Triton.serializeSymbolic([self.node])
+
+        with self.assertRaises(TypeError):
+            self.Triton.deserializeSymbolic(data[:len(data) // 2])
+
+        with self.assertRaises(TypeError):
+            self.Triton.deserializeSymbolic(b"\x00" + data[1:])
+
+        ctx = TritonContext()
+        ctx.setArchitecture(ARCH.AARCH64)
+        with self.assertRaises(TypeError):
+            ctx.deserializeSymbolic(data)
+
+        # A corrupted stream raises an error or gives other nodes
+        data = self.Triton.serializeSymbolic([self.astCtxt.bv(5, 8), self.astCtxt.let("a", self.astCtxt.bv(1, 8), self.astCtxt.string("a"))])
+        for i in range(len(data)):
+            for value in [0, 1, 2, 0x7f, 0xff]:
+                try:
+                    self.Triton.deserializeSymbolic(data[:i] + bytes([value]) + data[i + 1:])
+                except TypeError:
+                    pass
+
+    def test_repeated_children(self):
+        x = self.astCtxt.variable(self.Triton.newSymbolicVariable(8))
+        b = self.astCtxt.bv(0x12, 8)
+        for node in [x + x, self.astCtxt.concat([b, b, b, b]), self.astCtxt.concat([x, x, x, x])]:
+            nodes, exprs, pcs = self.Triton.deserializeSymbolic(self.Triton.serializeSymbolic([node]), True)
+            self.assertEqual(str(nodes[0]), str(node))
@@ -38,3 +38,34 @@ class TestSymbolicOptimizations(unittest.TestCase):
         self.assertEqual(rcx.getType(), AST_NODE.REFERENCE)
         self.assertEqual(rcx.evaluate(), 1)
         return
+
+
+    def test_overlapping_writes(self):
+        self.ctx.setMode(MODE.ALIGNED_MEMORY, True)
+        astCtxt = self.ctx.getAstContext()
+
+        # The entries overlapping a write from above and from below are removed
+        for size in [CPUSIZE.BYTE, CPUSIZE.WORD, CPUSIZE.DWORD, CPUSIZE.QWORD]:
+            for offset in range(-size, CPUSIZE.QWORD + 1):
+                base = 0x1000 + (size * 0x100)
+                self.ctx.symbolizeMemory(MemoryAccess(base, size))
+                self.assertEqual(self.ctx.getMemoryAst(MemoryAccess(base, size)).getType(), AST_NODE.VARIABLE)
+
+                expr = self.ctx.newSymbolicExpression(astCtxt.bv(offset & 0xff, 8))
+                self.ctx.assignSymbolicExpressionToMemory(expr, MemoryAccess(base + offset, CPUSIZE.BYTE))
+                node = self.ctx.getMemoryAst(MemoryAccess(base, size))
+                self.assertEqual(node.getType() == AST_NODE.VARIABLE, not (0 <= offset < size))
+
+        # A concrete write removes the entries too
+        self.ctx.symbolizeMemory(MemoryAccess(0x2000, CPUSIZE.DQWORD))
+        self.ctx.setConcreteMemoryValue(0x200f, 1)
+        self.assertEqual(self.ctx.getMemoryAst(MemoryAccess(0x2000, CPUSIZE.DQWORD)).getType(), AST_NODE.CONCAT)
+
+        # Snapshots share the entries
+        self.ctx.symbolizeMemory(MemoryAccess(0x3000, CPUSIZE.QWORD))
+        snap = self.ctx.takeSnapshot()
+        self.ctx.concretizeAllMemory()
+        self.assertEqual(self.ctx.getMemoryAst(MemoryAccess(0x3000, CPUSIZE.QWORD)).getType(), AST_NODE.CONCAT)
+        self.ctx.restoreSnapshot(snap)
+        self.assertEqual(self.ctx.getMemoryAst(MemoryAccess(0x3000, CPUSIZE.QWORD)).getType(), AST_NODE.VARIABLE)
+        return
@@ -0,0 +1,99 @@
+#!/usr/bin/env python
+# coding: utf-8
+"""Testing the synthesis of expressions."""
+
+import os
+import tempfile
+import unittest
+
+from triton import ARCH, AST_NODE, TritonContext
+
+
+class TestSynthesis(unittest.TestCase):
+
+    """Testing the synthesis of expressions."""
+
+    def setUp(self):
+        """Define the arch and the variables."""
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ast = self.ctx.getAstContext()
+        self.x = self.ast.variable(self.ctx.newSymbolicVariable(32))
+        self.y = self.ast.variable(self.ctx.newSymbolicVariable(32))
+        self.z = self.ast.variable(self.ctx.newSymbolicVariable(32))
+        self.w = self.ast.variable(self.ctx.newSymbolicVariable(32))
+
+    def check(self, node, expected, constant=True):
+        """Synthesizes a node and checks the result and its equivalence."""
+        result = self.ctx.synthesize(node, constant=constant)
+        self.assertEqual(str(result), expected)
+        self.assertFalse(self.ctx.isSat(self.ast.distinct(node, result)))
+
+    def test_oracles(self):
+        """Check the expressions found in the oracle table."""
+        a, x, y, z = self.ast, self.x, self.y, self.z
+        self.check(a.bvsub(a.bvadd(a.bvor(x, y), y), a.bvand(a.bvnot(x), y)), "(bvadd SymVar_0 SymVar_1)")
+        self.check(a.bvor(a.bvand(x, a.bvnot(y)), a.bvand(a.bvnot(x), y)), "(bvxor SymVar_0 SymVar_1)")
+        self.check(a.bvadd(a.bvxor(x, y), a.bvmul(a.bv(2, 32), a.bvand(x, y))), "(bvadd SymVar_0 SymVar_1)")
+        self.check(a.bvsub(a.bvadd(x, z), a.bvadd(z, x)), "(_ bv0 32)")
+        self.check(a.bvxor(a.bvand(x, a.bvxor(y, z)), a.bvand(x, z)), "(bvand SymVar_0 SymVar_1)")
+
+    def test_constants(self):
+        """Check the expressions with a constant."""
+        a, x = self.ast, self.x
+        node = a.bvsub(a.bvor(x, a.bv(0x5c, 32)), a.bvand(x, a.bv(0x5c, 32)))
+        self.check(node, "(bvxor SymVar_0 (_ bv92 32))")
+        self.check(node, str(node), constant=False)
+        self.check(a.bvsub(a.bvadd(x, a.bv(0x11, 32)), a.bvsub(a.bv(7, 32), a.bvnot(x))), "(_ bv9 32)")
+        self.check(a.bvsub(a.bvadd(a.bvadd(x, a.bv(0x11, 32)), a.bvsub(x, a.bv(7, 32))), x), "(bvadd SymVar_0 (_ bv10 32))")
+
+    def test_subexpressions(self):
+        """Check that the subexpressions are replaced when the whole node is not."""
+        a, x, y, z, w = self.ast, self.x, self.y, self.z, self.w
+        xor = a.bvor(a.bvand(x, a.bvnot(y)), a.bvand(a.bvnot(x), y))
+        node = a.bvmul(a.bvadd(xor, a.bvudiv(z, w)), a.bvlshr(w, a.bv(3, 32)))
+        self.assertEqual(str(self.ctx.synthesize(node)), "(bvmul (bvadd (bvxor SymVar_0 SymVar_1) (bvudiv SymVar_2 SymVar_3)) (bvlshr SymVar_3 (_ bv3 32)))")
+
+        # Already minimal, unsupported or without variable
+        for node in [x, a.bvadd(x, y), a.bv(1, 32), a.bvult(x, y), a.zx(64, a.concat([x, y]))]:
+            self.assertEqual(str(self.ctx.synthesize(node)), str(node))
+
+    def test_sizes(self):
+        """Check the variables of several sizes."""
+        a = self.ast
+        for size in [1, 8, 64]:
+            x = a.variable(self.ctx.newSymbolicVariable(size))
+            y = a.variable(self.ctx.newSymbolicVariable(size))
+            node = a.bvsub(a.bvadd(a.bvor(x, y), y), a.bvand(a.bvnot(x), y))
+            result = self.ctx.synthesize(node)
+            self.assertEqual(result.getType(), AST_NODE.BVADD)
+            self.assertFalse(self.ctx.isSat(a.distinct(node, result)))
+
+    def test_file(self):
+        """Check that a saved table gives the same results."""
+        fd, path = tempfile.mkstemp()
+        os.close(fd)
+        try:
+            self.ctx.saveSynthesisOracles(path)
+            ctx = TritonContext(ARCH.X86_64)
+            ctx.loadSynthesisOracles(path)
+            a = ctx.getAstContext()
+            x = a.variable(ctx.newSymbolicVariable(32))
+            y = a.variable(ctx.newSymbolicVariable(32))
+            node = a.bvor(a.bvand(x, a.bvnot(y)), a.bvand(a.bvnot(x), y))
+            self.assertEqual(str(ctx.synthesize(node)), "(bvxor SymVar_0 SymVar_1)")
+
+            with open(path, "w") as f:
+                f.write("3\nx y foo\n")
+            with self.assertRaises(TypeError):
+                ctx.loadSynthesisOracles(path)
+            with open(path, "w") as f:
+                f.write("3\nx add\n")
+            with self.assertRaises(TypeError):
+                ctx.loadSynthesisOracles(path)
+        finally:
+            os.remove(path)
+
+        with self.assertRaises(TypeError):
+            self.ctx.loadSynthesisOracles(path)
+        with self.assertRaises(TypeError):
+            self.ctx.synthesize(1)
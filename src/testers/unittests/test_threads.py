@@ -0,0 +1,134 @@
+#!/usr/bin/env python
+# coding: utf-8
+"""Test Triton in several Python threads."""
+
+import threading
+import unittest
+
+from triton import *
+
+
+class TestGil(unittest.TestCase):
+
+    """Testing solver calls and callbacks without the GIL."""
+
+    def solve(self, results, index):
+        ctx = TritonContext()
+        ctx.setArchitecture(ARCH.X86_64)
+        ast = ctx.getAstContext()
+        x = ast.variable(ctx.newSymbolicVariable(32))
+        y = ast.variable(ctx.newSymbolicVariable(32))
+        constraint = ast.land([x * y == ast.bv(index * 7 + 1, 32), x > ast.bv(1, 32), y > ast.bv(1, 32)])
+        results[index] = (ctx.isSat(constraint), len(ctx.getModel(constraint)))
+
+    def test_models(self):
+        """Check getModel from several threads."""
+        results = [None] * 4
+        threads = [threading.Thread(target=self.solve, args=(results, i)) for i in range(4)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+        for sat, size in results:
+            self.assertTrue(sat)
+            self.assertEqual(size, 2)
+
+    def test_callback(self):
+        """Check that callbacks re-acquire the GIL."""
+        ctx = TritonContext()
+        ctx.setArchitecture(ARCH.X86_64)
+        ast = ctx.getAstContext()
+        calls = []
+
+        def cb(ctx, node):
+            calls.append(node.getType())
+            return node
+
+        def cb_raise(ctx, node):
+            raise ValueError("from callback")
+
+        ctx.addCallback(CALLBACK.SYMBOLIC_SIMPLIFICATION, cb)
+        ctx.simplify(ast.bvadd(ast.bv(1, 8), ast.bv(2, 8)))
+        self.assertTrue(len(calls) > 0)
+
+        ctx.addCallback(CALLBACK.SYMBOLIC_SIMPLIFICATION, cb_raise)
+        with self.assertRaises(ValueError):
+            ctx.simplify(ast.bv(1, 8))
+
+
+class TestStress(unittest.TestCase):
+
+    """Testing independent contexts running in parallel threads."""
+
+    THREADS = 8
+    ROUNDS  = 20
+
+    CODE = [
+        b"\x48\xc7\xc0\x01\x00\x00\x00",    # mov rax, 1
+        b"\x48\x01\xd8",                    # add rax, rbx
+        b"\x48\x31\xc8",                    # xor rax, rcx
+        b"\x48\x0f\xaf\xc3",                # imul rax, rbx
+        b"\x48\x89\x07",                    # mov [rdi], rax
+        b"\x48\x3d\x37\x13\x00\x00",        # cmp rax, 0x1337
+    ]
+
+    def run_threads(self, target):
+        errors = []
+        results = [None] * self.THREADS
+
+        def worker(index):
+            try:
+                results[index] = target(index)
+            except Exception as e:
+                errors.append(e)
+
+        threads = [threading.Thread(target=worker, args=(i,)) for i in range(self.THREADS)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+        self.assertEqual(errors, [])
+        return results
+
+    def solve(self, index):
+        archs = [ARCH.X86, ARCH.X86_64, ARCH.ARM32, ARCH.AARCH64]
+        ctx = TritonContext()
+        models = []
+        for r in range(self.ROUNDS):
+            # Re-opens the disassembler handles
+            ctx.setArchitecture(archs[(index + r) % len(archs)])
+            ast = ctx.getAstContext()
+            x = ast.variable(ctx.newSymbolicVariable(16))
+            sid = ctx.takeSnapshot()
+            e = ast.bvxor(ast.bvmul(x, ast.bv(3, 16)), ast.bv(index, 16))
+            ctx.newSymbolicVariable(16)
+            model = ctx.getModel(ctx.simplify(e, True) == ast.bv(r, 16))
+            ctx.restoreSnapshot(sid)
+            self.assertEqual(len(ctx.getSymbolicVariables()), 1)
+            models.append(((list(model.values())[0].getValue() * 3) ^ index) & 0xffff)
+        return models
+
+    def test_solver(self):
+        """Check solver and snapshot operations on several contexts in parallel."""
+        for models in self.run_threads(self.solve):
+            self.assertEqual(models, list(range(self.ROUNDS)))
+
+    def process(self, index):
+        ctx = TritonContext()
+        ctx.setArchitecture(ARCH.X86_64)
+        ctx.setConcreteRegisterValue(ctx.registers.rdi, 0x1000)
+        ctx.setConcreteRegisterValue(ctx.registers.rcx, index)
+        ctx.symbolizeRegister(ctx.registers.rbx)
+        for r in range(self.ROUNDS):
+            for opcode in self.CODE:
+                ctx.processing(Instruction(opcode))
+        rax = ctx.getSymbolicRegister(ctx.registers.rax).getAst()
+        return (ctx.getConcreteRegisterValue(ctx.registers.rax),
+                ctx.getConcreteMemoryValue(MemoryAccess(0x1000, CPUSIZE.QWORD)),
+                ctx.getConcreteRegisterValue(ctx.registers.zf),
+                str(ctx.simplify(rax, True)))
+
+    def test_processing(self):
+        """Check instruction processing on several contexts in parallel."""
+        expected = [self.process(i) for i in range(self.THREADS)]
+        self.assertEqual(self.run_threads(self.process), expected)
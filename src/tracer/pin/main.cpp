@@ -21,6 +21,7 @@
 #include "api.hpp"
 #include "bindings.hpp"
 #include "context.hpp"
+#include "recorder.hpp"
 #include "snapshot.hpp"
 #include "trigger.hpp"
 #include "utils.hpp"
@@ -186,6 +187,23 @@ is describe at this following page \ref pintool_py_api. Below, some examples.
 
 \include pin/callback_syscall.py
 
+\section Tracer_record Offline recording
+<hr>
+
+Running the engines inside the analysis callbacks slows down the traced program a lot. With the `-trace <file>` option,
+the pintool only records an execution trace of the analyzed instructions (address, opcode, bytes read and written and
+registers every `-trace-sync` instructions, see triton::utils::TraceWriter). The Python script is still used to configure
+the analysis (start and stop points, images, ...) but the Triton callbacks are not called. The trace is then replayed
+offline by any Triton context, possibly by chunks between sync points in parallel:
+
+~~~~~~~~~~~~~{.py}
+from triton import TritonContext, ARCH
+
+ctx = TritonContext(ARCH.X86_64)
+points = ctx.getTraceSyncPoints('program.trace')
+ctx.replayTrace('program.trace', points[0], points[1])
+~~~~~~~~~~~~~
+
 */
 
 
@@ -197,6 +215,12 @@ namespace tracer {
     //! Pin options: -script
     KNOB<std::string> KnobPythonModule(KNOB_MODE_WRITEONCE, "pintool", "script", "", "Python script");
 
+    //! Pin options: -trace
+    KNOB<std::string> KnobTraceFile(KNOB_MODE_WRITEONCE, "pintool", "trace", "", "Only record an execution trace into this file");
+
+    //! Pin options: -trace-sync
+    KNOB<UINT64> KnobTraceSync(KNOB_MODE_WRITEONCE, "pintool", "trace-sync", "100000", "Number of recorded instructions between two register snapshots");
+
     //! Lock / Unlock InsertCall
     Trigger analysisTrigger = Trigger();
 
@@ -222,6 +246,12 @@ namespace tracer {
       /* Analysis locked */
         return;
 
+      /* Only record the execution, the analysis is done offline */
+      if (tracer::pintool::recorder::isEnabled()) {
+        tracer::pintool::recorder::recordInstruction(reinterpret_cast<triton::__uint>(addr), size, threadId, ctx);
+        return;
+      }
+
       /* Mutex */
       PIN_LockClient();
 
@@ -280,6 +310,10 @@ namespace tracer {
       /* Analysis locked */
         return;
 
+      /* Nothing to do while recording */
+      if (tracer::pintool::recorder::isEnabled())
+        return;
+
       /* Mutex */
       PIN_LockClient();
 
@@ -310,6 +344,13 @@ namespace tracer {
 
     /* Save the memory access into the Triton instruction */
     static void saveMemoryAccess(triton::arch::Instruction* tritonInst, triton::__uint addr, triton::uint32 size) {
+      /* Save the bytes into the trace */
+      if (tracer::pintool::recorder::isEnabled()) {
+        if (tracer::pintool::analysisTrigger.getState() && PIN_ThreadId() == tracer::pintool::options::targetThreadId)
+          tracer::pintool::recorder::addRead(addr, size);
+        return;
+      }
+
       /* Mutex */
       PIN_LockClient();
 
@@ -323,6 +364,16 @@ namespace tracer {
     }
 
 
+    /* Save the area written by the instruction into the trace */
+    static void saveMemoryWrite(triton::__uint addr, triton::uint32 size, THREADID threadId) {
+      if (!tracer::pintool::analysisTrigger.getState() || threadId != tracer::pintool::options::targetThreadId)
+      /* Analysis locked */
+        return;
+
+      tracer::pintool::recorder::addWrite(addr, size);
+    }
+
+
     /* Callback to save bytes for the snapshot engine */
     static void callbackSnapshot(triton::__uint mem, triton::uint32 writeSize) {
       if (!tracer::pintool::analysisTrigger.getState())
@@ -386,6 +437,9 @@ namespace tracer {
 
     /* Callback at the end of the execution */
     static void callbackFini(int, VOID *) {
+      /* Flush the trace */
+      tracer::pintool::recorder::close();
+
       /* Execute the Python callback */
       tracer::pintool::callbacks::fini();
     }
@@ -641,6 +695,15 @@ namespace tracer {
             IARG_THREAD_ID,
             IARG_END);
 
+          /* Save memory write informations (recorded once the instruction is executed) */
+          if (tracer::pintool::recorder::isEnabled() && INS_IsMemoryWrite(ins)) {
+            INS_InsertCall(ins, IPOINT_BEFORE, (AFUNPTR)saveMemoryWrite,
+              IARG_MEMORYWRITE_EA,
+              IARG_MEMORYWRITE_SIZE,
+              IARG_THREAD_ID,
+              IARG_END);
+          }
+
           /* Callback after */
           /* Syscall after context must be catcher with INSERT_POINT.SYSCALL_EXIT */
           if (INS_IsSyscall(ins) == false) {
@@ -684,6 +747,10 @@ namespace tracer {
       else
         tracer::pintool::api.setArchitecture(triton::arch::ARCH_X86);
 
+      /* Only record an execution trace */
+      if (!KnobTraceFile.Value().empty())
+        tracer::pintool::recorder::open(KnobTraceFile.Value(), KnobTraceSync.Value());
+
       /* During the execution provide concrete values only if Triton needs them - cf #376, #632 and #645 */
       tracer::pintool::api.addCallback(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, tracer::pintool::context::needConcreteMemoryValue);
 
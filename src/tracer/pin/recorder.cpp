@@ -0,0 +1,138 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+/* pintool */
+#include "api.hpp"
+#include "context.hpp"
+#include "recorder.hpp"
+
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+/* libTriton */
+#include <triton/api.hpp>
+#include <triton/executionTrace.hpp>
+
+
+
+namespace tracer {
+  namespace pintool {
+    namespace recorder {
+
+      /* The trace file */
+      static std::ofstream file;
+
+      /* The trace writer (null if the execution is not recorded) */
+      static std::unique_ptr<triton::utils::TraceWriter> writer;
+
+      /* Registers are saved every syncInterval instructions */
+      static triton::usize syncInterval = 0;
+
+      /* Number of recorded instructions */
+      static triton::usize count = 0;
+
+      /* Bytes read by the current instruction */
+      static std::vector<triton::utils::TraceMemoryAccess> reads;
+
+      /* Areas written by the previous instruction */
+      static std::vector<std::pair<triton::__uint, triton::uint32>> writes;
+
+
+      bool isEnabled(void) {
+        return writer != nullptr;
+      }
+
+
+      void open(const std::string& path, triton::usize interval) {
+        file.open(path.c_str(), std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+          throw std::runtime_error("tracer::pintool::recorder::open(): Cannot open the trace file.");
+
+        writer.reset(new triton::utils::TraceWriter(file, tracer::pintool::api.getArchitecture()));
+        syncInterval = interval ? interval : 1;
+        count = 0;
+      }
+
+
+      /* Reads the bytes of an area of the traced program */
+      static triton::utils::TraceMemoryAccess readArea(triton::__uint addr, triton::uint32 size) {
+        triton::utils::TraceMemoryAccess area;
+
+        area.address = addr;
+        area.data.resize(size);
+        area.data.resize(PIN_SafeCopy(area.data.data(), reinterpret_cast<void*>(addr), size));
+
+        return area;
+      }
+
+
+      void addRead(triton::__uint addr, triton::uint32 size) {
+        reads.push_back(readArea(addr, size));
+      }
+
+
+      void addWrite(triton::__uint addr, triton::uint32 size) {
+        writes.push_back(std::make_pair(addr, size));
+      }
+
+
+      /* Records the bytes written by the previous instruction */
+      static void flushWrites(void) {
+        for (const auto& write : writes) {
+          auto area = readArea(write.first, write.second);
+          writer->writeMemory(area.address, area.data.data(), static_cast<triton::uint32>(area.data.size()));
+        }
+        writes.clear();
+      }
+
+
+      /* Records the values of all the registers supported by the pintool */
+      static void recordSync(THREADID threadId) {
+        std::vector<std::pair<triton::arch::Register, triton::uint512>> regs;
+
+        for (const auto* reg : tracer::pintool::api.getParentRegisters()) {
+          try {
+            regs.push_back(std::make_pair(*reg, tracer::pintool::context::getCurrentRegisterValue(*reg)));
+          }
+          catch (const std::runtime_error&) {
+            /* Not provided by Pin */
+          }
+        }
+
+        writer->writeSync(static_cast<triton::uint32>(threadId), regs);
+      }
+
+
+      void recordInstruction(triton::__uint addr, triton::uint32 size, THREADID threadId, CONTEXT* ctx) {
+        flushWrites();
+
+        if (count % syncInterval == 0) {
+          tracer::pintool::context::lastContext = ctx;
+          recordSync(threadId);
+        }
+
+        writer->writeInstruction(addr, static_cast<triton::uint32>(threadId), reinterpret_cast<const triton::uint8*>(addr), size, reads);
+        reads.clear();
+        count++;
+      }
+
+
+      void close(void) {
+        if (writer == nullptr)
+          return;
+
+        flushWrites();
+        writer.reset();
+        file.close();
+      }
+
+    };
+  };
+};
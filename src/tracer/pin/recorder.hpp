@@ -0,0 +1,74 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_PIN_RECORDER_H
+#define TRITON_PIN_RECORDER_H
+
+#include <string>
+
+#include <pin.H>
+
+/* libTriton */
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Tracer namespace
+namespace tracer {
+/*!
+ *  \addtogroup tracer
+ *  @{
+ */
+
+  //! The Pintool namespace
+  namespace pintool {
+  /*!
+   *  \ingroup tracer
+   *  \addtogroup pintool
+   *  @{
+   */
+
+    /*! \brief The Recorder namespace
+     *
+     *  \details
+     *  When the pintool is launched with `-trace <file>`, the analysis callbacks only record an execution
+     *  trace (see triton::utils::TraceWriter) instead of running the Triton engines. The trace is replayed
+     *  offline with triton::API::replayTrace().
+     */
+    namespace recorder {
+    /*!
+     *  \ingroup pintool
+     *  \addtogroup recorder
+     *  @{
+     */
+
+      //! Returns true if the execution is recorded.
+      bool isEnabled(void);
+
+      //! Starts recording into `path`. Registers are saved every `syncInterval` instructions.
+      void open(const std::string& path, triton::usize syncInterval);
+
+      //! Saves the bytes about to be read by the current instruction.
+      void addRead(triton::__uint addr, triton::uint32 size);
+
+      //! Saves the area about to be written by the current instruction. Its bytes are recorded once written.
+      void addWrite(triton::__uint addr, triton::uint32 size);
+
+      //! Records an instruction with the bytes it reads.
+      void recordInstruction(triton::__uint addr, triton::uint32 size, THREADID threadId, CONTEXT* ctx);
+
+      //! Flushes and closes the trace.
+      void close(void);
+
+    /*! @} End of recorder namespace */
+    };
+  /*! @} End of pintool namespace */
+  };
+/*! @} End of tracer namespace */
+};
+
+#endif // TRITON_PIN_RECORDER_H